@@ -1568,6 +1568,16 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF(PropertyInfo(Variant::INT, "display/window/size/window_height_override", PROPERTY_HINT_RANGE, "0,4320,1,or_greater"), 0); // 8K resolution
 
 	GLOBAL_DEF("display/window/energy_saving/keep_screen_on", true);
+	GLOBAL_DEF("animation/lod/enabled", false);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "animation/lod/medium_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), 20.0);
+	GLOBAL_DEF(PropertyInfo(Variant::FLOAT, "animation/lod/far_distance", PROPERTY_HINT_RANGE, "0,1000,0.01,or_greater,suffix:m"), 50.0);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/medium_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), 2);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/far_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), 4);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "animation/lod/offscreen_update_interval", PROPERTY_HINT_RANGE, "1,60,1,or_greater"), 8);
+	GLOBAL_DEF("animation/lod/reduce_far_tracks", true);
+	GLOBAL_DEF("animation/lod/interpolate_poses", true);
+	GLOBAL_DEF("animation/mixer/multithreaded_blending", false);
+	GLOBAL_DEF("animation/skeleton/multithreaded_update", false);
 	GLOBAL_DEF("animation/warnings/check_invalid_track_paths", true);
 	GLOBAL_DEF("animation/warnings/check_angle_interpolation_type_conflicting", true);
 
@@ -1688,6 +1698,8 @@ ProjectSettings::ProjectSettings() {
 	GLOBAL_DEF("navigation/avoidance/thread_model/avoidance_use_high_priority_threads", true);
 
 	GLOBAL_DEF("navigation/pathfinding/max_threads", 4);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/pathfinding/max_async_queries_per_step", PROPERTY_HINT_RANGE, "-1,4096,1,or_greater"), 256);
+	GLOBAL_DEF(PropertyInfo(Variant::INT, "navigation/pathfinding/path_cache_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), 0);
 
 	GLOBAL_DEF("navigation/baking/use_crash_prevention_checks", true);
 	GLOBAL_DEF("navigation/baking/thread_model/baking_use_multiple_threads", true);
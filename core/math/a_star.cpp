@@ -57,11 +57,11 @@ void AStar3D::add_point(int64_t p_id, const Vector3 &p_pos, real_t p_weight_scal
 		pt->id = p_id;
 		pt->pos = p_pos;
 		pt->weight_scale = p_weight_scale;
-		pt->prev_point = nullptr;
-		pt->open_pass = 0;
-		pt->closed_pass = 0;
 		pt->enabled = true;
+		pt->index = point_list.size();
 		points.set(p_id, pt);
+		point_list.push_back(pt);
+		compact_graph_dirty.set();
 	} else {
 		found_pt->pos = p_pos;
 		found_pt->weight_scale = p_weight_scale;
@@ -122,6 +122,13 @@ void AStar3D::remove_point(int64_t p_id) {
 		(*it.value)->unlinked_neighbours.remove(p->id);
 	}
 
+	// Move the last point into the freed index to keep the point list dense.
+	Point *last = point_list[point_list.size() - 1];
+	last->index = p->index;
+	point_list[p->index] = last;
+	point_list.resize(point_list.size() - 1);
+	compact_graph_dirty.set();
+
 	memdelete(p);
 	points.remove(p_id);
 	last_free_id = p_id;
@@ -163,6 +170,7 @@ void AStar3D::connect_points(int64_t p_id, int64_t p_with_id, bool bidirectional
 	}
 
 	segments.insert(s);
+	compact_graph_dirty.set();
 }
 
 void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectional) {
@@ -202,6 +210,7 @@ void AStar3D::disconnect_points(int64_t p_id, int64_t p_with_id, bool bidirectio
 		if (s.direction != Segment::NONE) {
 			segments.insert(s);
 		}
+		compact_graph_dirty.set();
 	}
 }
 
@@ -248,6 +257,8 @@ void AStar3D::clear() {
 	}
 	segments.clear();
 	points.clear();
+	point_list.clear();
+	compact_graph_dirty.set();
 }
 
 int64_t AStar3D::get_point_count() const {
@@ -261,6 +272,7 @@ int64_t AStar3D::get_point_capacity() const {
 void AStar3D::reserve_space(int64_t p_num_nodes) {
 	ERR_FAIL_COND_MSG(p_num_nodes <= 0, vformat("New capacity must be greater than 0, new was: %d.", p_num_nodes));
 	points.reserve(p_num_nodes);
+	point_list.reserve(p_num_nodes);
 }
 
 int64_t AStar3D::get_closest_point(const Vector3 &p_point, bool p_include_disabled) const {
@@ -312,71 +324,217 @@ Vector3 AStar3D::get_closest_position_in_segment(const Vector3 &p_point) const {
 	return closest_point;
 }
 
-bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+void AStar3D::set_bidirectional_search_enabled(bool p_enabled) {
+	bidirectional_search_enabled = p_enabled;
+}
+
+bool AStar3D::is_bidirectional_search_enabled() const {
+	return bidirectional_search_enabled;
+}
+
+void AStar3D::_update_compact_graph() {
+	if (!compact_graph_dirty.is_set()) {
+		return;
+	}
+
+	MutexLock lock(compact_graph_mutex);
+	if (!compact_graph_dirty.is_set()) {
+		return; // Updated by another query in the meantime.
+	}
+
+	const uint32_t point_count = point_list.size();
+	neighbor_offsets.resize(point_count + 1);
+	compact_neighbors.clear();
+	reverse_neighbor_offsets.resize(point_count + 1);
+	for (uint32_t &offset : reverse_neighbor_offsets) {
+		offset = 0;
+	}
+
+	// Keep the order of the neighbor maps, so that paths with equal costs are chosen the same way.
+	for (uint32_t i = 0; i < point_count; i++) {
+		neighbor_offsets[i] = compact_neighbors.size();
+		const OAHashMap<int64_t, Point *> &neighbors = point_list[i]->neighbors;
+		for (OAHashMap<int64_t, Point *>::Iterator it = neighbors.iter(); it.valid; it = neighbors.next_iter(it)) {
+			compact_neighbors.push_back(*it.value);
+			reverse_neighbor_offsets[(*it.value)->index + 1]++;
+		}
+	}
+	neighbor_offsets[point_count] = compact_neighbors.size();
+
+	for (uint32_t i = 0; i < point_count; i++) {
+		reverse_neighbor_offsets[i + 1] += reverse_neighbor_offsets[i];
+	}
+
+	// The points connected to each point, used by bidirectional searches.
+	LocalVector<uint32_t> reverse_neighbor_ends;
+	reverse_neighbor_ends.resize(point_count);
+	for (uint32_t i = 0; i < point_count; i++) {
+		reverse_neighbor_ends[i] = reverse_neighbor_offsets[i];
+	}
+	reverse_compact_neighbors.resize(compact_neighbors.size());
+	for (uint32_t i = 0; i < point_count; i++) {
+		for (uint32_t j = neighbor_offsets[i]; j < neighbor_offsets[i + 1]; j++) {
+			reverse_compact_neighbors[reverse_neighbor_ends[compact_neighbors[j]->index]++] = point_list[i];
+		}
+	}
+
+	compact_graph_dirty.clear();
+}
+
+AStar3D::SolveState *AStar3D::_acquire_solve_state() {
+	SolveState *state = nullptr;
+	{
+		MutexLock lock(solve_states_mutex);
+		if (!solve_states.is_empty()) {
+			state = solve_states[solve_states.size() - 1];
+			solve_states.remove_at(solve_states.size() - 1);
+		}
+	}
+
+	if (!state) {
+		state = memnew(SolveState);
+	}
+	if (state->point_states.size() < point_list.size()) {
+		state->point_states.resize(point_list.size());
+	}
+	return state;
+}
+
+void AStar3D::_release_solve_state(SolveState *p_state) {
+	MutexLock lock(solve_states_mutex);
+	solve_states.push_back(p_state);
+}
+
+void AStar3D::_clear_solve_states() {
+	MutexLock lock(solve_states_mutex);
+	for (SolveState *state : solve_states) {
+		memdelete(state);
+	}
+	solve_states.clear();
+}
+
+// Same as SortArray::push_heap(), but keeps track of the positions of the points in the open list.
+void AStar3D::_open_list_push_heap(LocalVector<Point *> &r_open_list, PointState *p_point_states, int64_t p_hole_idx, Point *p_value) {
+	Point **open_list = r_open_list.ptr();
+	const SortPoints compare = { p_point_states };
+
+	int64_t parent = (p_hole_idx - 1) / 2;
+	while (p_hole_idx > 0 && compare(open_list[parent], p_value)) {
+		open_list[p_hole_idx] = open_list[parent];
+		p_point_states[open_list[p_hole_idx]->index].open_list_index = p_hole_idx;
+		p_hole_idx = parent;
+		parent = (p_hole_idx - 1) / 2;
+	}
+	open_list[p_hole_idx] = p_value;
+	p_point_states[p_value->index].open_list_index = p_hole_idx;
+}
+
+// Same as SortArray::pop_heap() followed by removing the last point, but keeps track of the positions of the points in the open list.
+void AStar3D::_open_list_pop_heap(LocalVector<Point *> &r_open_list, PointState *p_point_states) {
+	Point **open_list = r_open_list.ptr();
+	const SortPoints compare = { p_point_states };
+
+	const int64_t len = r_open_list.size() - 1;
+	Point *value = open_list[len];
+	int64_t hole_idx = 0;
+	int64_t second_child = 2;
+
+	while (second_child < len) {
+		if (compare(open_list[second_child], open_list[second_child - 1])) {
+			second_child--;
+		}
+
+		open_list[hole_idx] = open_list[second_child];
+		p_point_states[open_list[hole_idx]->index].open_list_index = hole_idx;
+		hole_idx = second_child;
+		second_child = 2 * (second_child + 1);
+	}
+
+	if (second_child == len) {
+		open_list[hole_idx] = open_list[second_child - 1];
+		p_point_states[open_list[hole_idx]->index].open_list_index = hole_idx;
+		hole_idx = second_child - 1;
+	}
+	_open_list_push_heap(r_open_list, p_point_states, hole_idx, value);
+	r_open_list.resize(len);
+}
+
+template <typename T>
+bool AStar3D::_solve(T *p_owner, SolveState &r_state, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
+	r_state.last_closest_point = nullptr;
+	r_state.pass++;
 
-	if (!end_point->enabled && !p_allow_partial_path) {
+	if (!p_end_point->enabled && !p_allow_partial_path) {
 		return false;
 	}
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
+	const uint64_t pass = r_state.pass;
+	PointState *point_states = r_state.point_states.ptr();
+	LocalVector<Point *> &open_list = r_state.open_list;
+	open_list.clear();
 
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
+	PointState &begin_state = point_states[p_begin_point->index];
+	begin_state.g_score = 0;
+	begin_state.f_score = p_owner->_estimate_cost(p_begin_point->id, p_end_point->id);
+	begin_state.abs_g_score = 0;
+	begin_state.abs_f_score = p_owner->_estimate_cost(p_begin_point->id, p_end_point->id);
+	begin_state.open_list_index = 0;
+	open_list.push_back(p_begin_point);
 
 	while (!open_list.is_empty()) {
 		Point *p = open_list[0]; // The currently processed point.
+		PointState &p_state = point_states[p->index];
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		if (r_state.last_closest_point == nullptr) {
+			r_state.last_closest_point = p;
+		} else {
+			const PointState &closest_state = point_states[r_state.last_closest_point->index];
+			if (closest_state.abs_f_score > p_state.abs_f_score || (closest_state.abs_f_score >= p_state.abs_f_score && closest_state.abs_g_score > p_state.abs_g_score)) {
+				r_state.last_closest_point = p;
+			}
 		}
 
-		if (p == end_point) {
+		if (p == p_end_point) {
 			found_route = true;
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		_open_list_pop_heap(open_list, point_states); // Remove the current point from the open list.
+		p_state.closed_pass = pass; // Mark the point as closed.
 
-		for (OAHashMap<int64_t, Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			Point *e = *(it.value); // The neighbor point.
+		for (uint32_t i = neighbor_offsets[p->index]; i < neighbor_offsets[p->index + 1]; i++) {
+			Point *e = compact_neighbors[i]; // The neighbor point.
+			PointState &e_state = point_states[e->index];
 
-			if (!e->enabled || e->closed_pass == pass) {
+			if (!e->enabled || e_state.closed_pass == pass) {
 				continue;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
+			real_t tentative_g_score = p_state.g_score + p_owner->_compute_cost(p->id, e->id) * e->weight_scale;
 
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
+			if (e_state.open_pass != pass) { // The point wasn't inside the open list.
+				e_state.open_pass = pass;
 				open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= e_state.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			e_state.prev_point = p;
+			e_state.g_score = tentative_g_score;
+			e_state.f_score = e_state.g_score + p_owner->_estimate_cost(e->id, p_end_point->id);
+			e_state.abs_g_score = tentative_g_score;
+			e_state.abs_f_score = e_state.f_score - e_state.g_score;
 
 			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+				_open_list_push_heap(open_list, point_states, open_list.size() - 1, e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+				_open_list_push_heap(open_list, point_states, e_state.open_list_index, e);
 			}
 		}
 	}
@@ -384,6 +542,187 @@ bool AStar3D::_solve(Point *begin_point, Point *end_point, bool p_allow_partial_
 	return found_route;
 }
 
+// Searches from both ends at once and returns the point where the best path found by both searches meets.
+// The backward search follows the connections in reverse, its previous points lead to the end point.
+template <typename T>
+AStar3D::Point *AStar3D::_solve_bidirectional(T *p_owner, SolveState &r_state, Point *p_begin_point, Point *p_end_point) {
+	r_state.last_closest_point = nullptr;
+	r_state.pass++;
+
+	if (!p_end_point->enabled) {
+		return nullptr;
+	}
+
+	if (r_state.reverse_point_states.size() < r_state.point_states.size()) {
+		r_state.reverse_point_states.resize(r_state.point_states.size());
+	}
+
+	const uint64_t pass = r_state.pass;
+	PointState *forward_states = r_state.point_states.ptr();
+	PointState *backward_states = r_state.reverse_point_states.ptr();
+	LocalVector<Point *> &forward_open_list = r_state.open_list;
+	LocalVector<Point *> &backward_open_list = r_state.reverse_open_list;
+	forward_open_list.clear();
+	backward_open_list.clear();
+
+	// Both searches use the average of the estimates to the end point and from the begin point,
+	// so that the first path found where they meet can be proven the shortest sooner.
+	PointState &begin_state = forward_states[p_begin_point->index];
+	begin_state.g_score = 0;
+	begin_state.f_score = (p_owner->_estimate_cost(p_begin_point->id, p_end_point->id) - p_owner->_estimate_cost(p_begin_point->id, p_begin_point->id)) * 0.5;
+	begin_state.open_pass = pass;
+	begin_state.open_list_index = 0;
+	forward_open_list.push_back(p_begin_point);
+
+	PointState &end_state = backward_states[p_end_point->index];
+	end_state.g_score = 0;
+	end_state.f_score = (p_owner->_estimate_cost(p_begin_point->id, p_end_point->id) - p_owner->_estimate_cost(p_end_point->id, p_end_point->id)) * 0.5;
+	end_state.open_pass = pass;
+	end_state.open_list_index = 0;
+	backward_open_list.push_back(p_end_point);
+
+	Point *meeting_point = nullptr;
+	real_t meeting_cost = 0;
+
+	while (!forward_open_list.is_empty() && !backward_open_list.is_empty()) {
+		// No path through the remaining open points of both searches can be cheaper than the one found.
+		if (meeting_point && forward_states[forward_open_list[0]->index].f_score + backward_states[backward_open_list[0]->index].f_score >= meeting_cost) {
+			break;
+		}
+
+		// Expand the search with the smallest frontier.
+		const bool forward = forward_open_list.size() <= backward_open_list.size();
+		LocalVector<Point *> &open_list = forward ? forward_open_list : backward_open_list;
+		PointState *point_states = forward ? forward_states : backward_states;
+		const PointState *other_point_states = forward ? backward_states : forward_states;
+		const LocalVector<uint32_t> &offsets = forward ? neighbor_offsets : reverse_neighbor_offsets;
+		const LocalVector<Point *> &neighbors = forward ? compact_neighbors : reverse_compact_neighbors;
+
+		Point *p = open_list[0]; // The currently processed point.
+		PointState &p_state = point_states[p->index];
+
+		_open_list_pop_heap(open_list, point_states); // Remove the current point from the open list.
+		p_state.closed_pass = pass; // Mark the point as closed.
+
+		for (uint32_t i = offsets[p->index]; i < offsets[p->index + 1]; i++) {
+			Point *e = neighbors[i]; // The neighbor point.
+			PointState &e_state = point_states[e->index];
+
+			// Like in the forward search, the begin point may be disabled.
+			if ((!e->enabled && (forward || e != p_begin_point)) || e_state.closed_pass == pass) {
+				continue;
+			}
+
+			real_t tentative_g_score;
+			if (forward) {
+				tentative_g_score = p_state.g_score + p_owner->_compute_cost(p->id, e->id) * e->weight_scale;
+			} else {
+				tentative_g_score = p_state.g_score + p_owner->_compute_cost(e->id, p->id) * p->weight_scale;
+			}
+
+			bool new_point = false;
+
+			if (e_state.open_pass != pass) { // The point wasn't inside the open list.
+				e_state.open_pass = pass;
+				open_list.push_back(e);
+				new_point = true;
+			} else if (tentative_g_score >= e_state.g_score) { // The new path is worse than the previous.
+				continue;
+			}
+
+			e_state.prev_point = p;
+			e_state.g_score = tentative_g_score;
+			const real_t estimate = (p_owner->_estimate_cost(e->id, p_end_point->id) - p_owner->_estimate_cost(p_begin_point->id, e->id)) * 0.5;
+			e_state.f_score = e_state.g_score + (forward ? estimate : -estimate);
+
+			if (new_point) { // The position of the new points is already known.
+				_open_list_push_heap(open_list, point_states, open_list.size() - 1, e);
+			} else {
+				_open_list_push_heap(open_list, point_states, e_state.open_list_index, e);
+			}
+
+			// The point was reached by both searches, so the paths can be joined there.
+			const PointState &e_other_state = other_point_states[e->index];
+			if (e_other_state.open_pass == pass) {
+				real_t cost = e_state.g_score + e_other_state.g_score;
+				if (meeting_point == nullptr || cost < meeting_cost) {
+					meeting_point = e;
+					meeting_cost = cost;
+				}
+			}
+		}
+	}
+
+	return meeting_point;
+}
+
+template <typename T>
+void AStar3D::_get_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<Point *> &r_path) {
+	_update_compact_graph();
+	SolveState *state = _acquire_solve_state();
+
+	if (bidirectional_search_enabled && !p_allow_partial_path) {
+		Point *meeting_point = _solve_bidirectional(p_owner, *state, p_begin_point, p_end_point);
+		if (meeting_point) {
+			Point *p = meeting_point;
+			int64_t pc = 1; // Begin point
+			while (p != p_begin_point) {
+				pc++;
+				p = state->point_states[p->index].prev_point;
+			}
+
+			r_path.resize(pc);
+			p = meeting_point;
+			int64_t idx = pc - 1;
+			while (p != p_begin_point) {
+				r_path[idx--] = p;
+				p = state->point_states[p->index].prev_point;
+			}
+			r_path[0] = p; // Assign first
+
+			p = meeting_point;
+			while (p != p_end_point) {
+				p = state->reverse_point_states[p->index].prev_point;
+				r_path.push_back(p);
+			}
+		}
+
+		_release_solve_state(state);
+		return;
+	}
+
+	Point *end_point = p_end_point;
+
+	bool found_route = _solve(p_owner, *state, p_begin_point, p_end_point, p_allow_partial_path);
+	if (!found_route) {
+		if (!p_allow_partial_path || state->last_closest_point == nullptr) {
+			_release_solve_state(state);
+			return;
+		}
+
+		// Use closest point instead.
+		end_point = state->last_closest_point;
+	}
+
+	Point *p = end_point;
+	int64_t pc = 1; // Begin point
+	while (p != p_begin_point) {
+		pc++;
+		p = state->point_states[p->index].prev_point;
+	}
+
+	r_path.resize(pc);
+	p = end_point;
+	int64_t idx = pc - 1;
+	while (p != p_begin_point) {
+		r_path[idx--] = p;
+		p = state->point_states[p->index].prev_point;
+	}
+	r_path[0] = p; // Assign first
+
+	_release_solve_state(state);
+}
+
 real_t AStar3D::_estimate_cost(int64_t p_from_id, int64_t p_end_id) {
 	real_t scost;
 	if (GDVIRTUAL_CALL(_estimate_cost, p_from_id, p_end_id, scost)) {
@@ -433,40 +772,14 @@ Vector<Vector3> AStar3D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector3>();
-		}
-
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
-
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
+	LocalVector<Point *> path_points;
+	_get_path(this, a, b, p_allow_partial_path, path_points);
 
 	Vector<Vector3> path;
-	path.resize(pc);
-
-	{
-		Vector3 *w = path.ptrw();
-
-		Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = p2->pos;
-			p2 = p2->prev_point;
-		}
-
-		w[0] = p2->pos; // Assign first
+	path.resize(path_points.size());
+	Vector3 *w = path.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		w[i] = path_points[i]->pos;
 	}
 
 	return path;
@@ -487,40 +800,14 @@ Vector<int64_t> AStar3D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<int64_t>();
-		}
-
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
-
-	Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
+	LocalVector<Point *> path_points;
+	_get_path(this, a, b, p_allow_partial_path, path_points);
 
 	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
+	path.resize(path_points.size());
+	int64_t *w = path.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		w[i] = path_points[i]->id;
 	}
 
 	return path;
@@ -566,6 +853,9 @@ void AStar3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar3D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar3D::clear);
 
+	ClassDB::bind_method(D_METHOD("set_bidirectional_search_enabled", "enabled"), &AStar3D::set_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("is_bidirectional_search_enabled"), &AStar3D::is_bidirectional_search_enabled);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar3D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar3D::get_closest_position_in_segment);
 
@@ -574,10 +864,13 @@ void AStar3D::_bind_methods() {
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bidirectional_search_enabled"), "set_bidirectional_search_enabled", "is_bidirectional_search_enabled");
 }
 
 AStar3D::~AStar3D() {
 	clear();
+	_clear_solve_states();
 }
 
 /////////////////////////////////////////////////////////////
@@ -659,6 +952,14 @@ void AStar2D::reserve_space(int64_t p_num_nodes) {
 	astar.reserve_space(p_num_nodes);
 }
 
+void AStar2D::set_bidirectional_search_enabled(bool p_enabled) {
+	astar.set_bidirectional_search_enabled(p_enabled);
+}
+
+bool AStar2D::is_bidirectional_search_enabled() const {
+	return astar.is_bidirectional_search_enabled();
+}
+
 int64_t AStar2D::get_closest_point(const Vector2 &p_point, bool p_include_disabled) const {
 	return astar.get_closest_point(Vector3(p_point.x, p_point.y, 0), p_include_disabled);
 }
@@ -716,40 +1017,14 @@ Vector<Vector2> AStar2D::get_point_path(int64_t p_from_id, int64_t p_to_id, bool
 		return ret;
 	}
 
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<Vector2>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
+	LocalVector<AStar3D::Point *> path_points;
+	astar._get_path(this, a, b, p_allow_partial_path, path_points);
 
 	Vector<Vector2> path;
-	path.resize(pc);
-
-	{
-		Vector2 *w = path.ptrw();
-
-		AStar3D::Point *p2 = end_point;
-		int64_t idx = pc - 1;
-		while (p2 != begin_point) {
-			w[idx--] = Vector2(p2->pos.x, p2->pos.y);
-			p2 = p2->prev_point;
-		}
-
-		w[0] = Vector2(p2->pos.x, p2->pos.y); // Assign first
+	path.resize(path_points.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		w[i] = Vector2(path_points[i]->pos.x, path_points[i]->pos.y);
 	}
 
 	return path;
@@ -770,117 +1045,19 @@ Vector<int64_t> AStar2D::get_id_path(int64_t p_from_id, int64_t p_to_id, bool p_
 		return ret;
 	}
 
-	AStar3D::Point *begin_point = a;
-	AStar3D::Point *end_point = b;
-
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || astar.last_closest_point == nullptr) {
-			return Vector<int64_t>();
-		}
-
-		// Use closest point instead.
-		end_point = astar.last_closest_point;
-	}
-
-	AStar3D::Point *p = end_point;
-	int64_t pc = 1; // Begin point
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
-	}
+	LocalVector<AStar3D::Point *> path_points;
+	astar._get_path(this, a, b, p_allow_partial_path, path_points);
 
 	Vector<int64_t> path;
-	path.resize(pc);
-
-	{
-		int64_t *w = path.ptrw();
-
-		p = end_point;
-		int64_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->id;
-			p = p->prev_point;
-		}
-
-		w[0] = p->id; // Assign first
+	path.resize(path_points.size());
+	int64_t *w = path.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		w[i] = path_points[i]->id;
 	}
 
 	return path;
 }
 
-bool AStar2D::_solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path) {
-	astar.last_closest_point = nullptr;
-	astar.pass++;
-
-	if (!end_point->enabled && !p_allow_partial_path) {
-		return false;
-	}
-
-	bool found_route = false;
-
-	LocalVector<AStar3D::Point *> open_list;
-	SortArray<AStar3D::Point *, AStar3D::SortPoints> sorter;
-
-	begin_point->g_score = 0;
-	begin_point->f_score = _estimate_cost(begin_point->id, end_point->id);
-	begin_point->abs_g_score = 0;
-	begin_point->abs_f_score = _estimate_cost(begin_point->id, end_point->id);
-	open_list.push_back(begin_point);
-
-	while (!open_list.is_empty()) {
-		AStar3D::Point *p = open_list[0]; // The currently processed point.
-
-		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (astar.last_closest_point == nullptr || astar.last_closest_point->abs_f_score > p->abs_f_score || (astar.last_closest_point->abs_f_score >= p->abs_f_score && astar.last_closest_point->abs_g_score > p->abs_g_score)) {
-			astar.last_closest_point = p;
-		}
-
-		if (p == end_point) {
-			found_route = true;
-			break;
-		}
-
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = astar.pass; // Mark the point as closed.
-
-		for (OAHashMap<int64_t, AStar3D::Point *>::Iterator it = p->neighbors.iter(); it.valid; it = p->neighbors.next_iter(it)) {
-			AStar3D::Point *e = *(it.value); // The neighbor point.
-
-			if (!e->enabled || e->closed_pass == astar.pass) {
-				continue;
-			}
-
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * e->weight_scale;
-
-			bool new_point = false;
-
-			if (e->open_pass != astar.pass) { // The point wasn't inside the open list.
-				e->open_pass = astar.pass;
-				open_list.push_back(e);
-				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
-				continue;
-			}
-
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, end_point->id);
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
-
-			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
-			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
-			}
-		}
-	}
-
-	return found_route;
-}
-
 void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_available_point_id"), &AStar2D::get_available_point_id);
 	ClassDB::bind_method(D_METHOD("add_point", "id", "position", "weight_scale"), &AStar2D::add_point, DEFVAL(1.0));
@@ -905,6 +1082,9 @@ void AStar2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("reserve_space", "num_nodes"), &AStar2D::reserve_space);
 	ClassDB::bind_method(D_METHOD("clear"), &AStar2D::clear);
 
+	ClassDB::bind_method(D_METHOD("set_bidirectional_search_enabled", "enabled"), &AStar2D::set_bidirectional_search_enabled);
+	ClassDB::bind_method(D_METHOD("is_bidirectional_search_enabled"), &AStar2D::is_bidirectional_search_enabled);
+
 	ClassDB::bind_method(D_METHOD("get_closest_point", "to_position", "include_disabled"), &AStar2D::get_closest_point, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_closest_position_in_segment", "to_position"), &AStar2D::get_closest_position_in_segment);
 
@@ -913,4 +1093,6 @@ void AStar2D::_bind_methods() {
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
+
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "bidirectional_search_enabled"), "set_bidirectional_search_enabled", "is_bidirectional_search_enabled");
 }
@@ -32,7 +32,10 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/oa_hash_map.h"
+#include "core/templates/safe_refcount.h"
 
 /**
 	A* pathfinding algorithm.
@@ -50,29 +53,51 @@ class AStar3D : public RefCounted {
 		real_t weight_scale = 0;
 		bool enabled = false;
 
+		// Position in the point list, which indexes the compact graph and the pathfinding data of queries.
+		uint32_t index = 0;
+
 		OAHashMap<int64_t, Point *> neighbors = 4u;
 		OAHashMap<int64_t, Point *> unlinked_neighbours = 4u;
+	};
 
-		// Used for pathfinding.
+	// The pathfinding data of a point, kept apart from the point so that multiple queries can run at once.
+	struct PointState {
 		Point *prev_point = nullptr;
 		real_t g_score = 0;
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
+		uint32_t open_list_index = 0;
 
 		// Used for getting closest_point_of_last_pathing_call.
 		real_t abs_g_score = 0;
 		real_t abs_f_score = 0;
 	};
 
+	struct SolveState {
+		LocalVector<PointState> point_states;
+		LocalVector<Point *> open_list;
+		uint64_t pass = 1;
+
+		Point *last_closest_point = nullptr;
+
+		// Used by bidirectional searches, where prev_point leads to the end point.
+		LocalVector<PointState> reverse_point_states;
+		LocalVector<Point *> reverse_open_list;
+	};
+
 	struct SortPoints {
+		const PointState *point_states = nullptr;
+
 		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+			const PointState &a = point_states[A->index];
+			const PointState &b = point_states[B->index];
+			if (a.f_score > b.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (a.f_score < b.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return a.g_score < b.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
@@ -108,13 +133,39 @@ class AStar3D : public RefCounted {
 	};
 
 	mutable int64_t last_free_id = 0;
-	uint64_t pass = 1;
+	bool bidirectional_search_enabled = false;
 
 	OAHashMap<int64_t, Point *> points;
 	HashSet<Segment, Segment> segments;
-	Point *last_closest_point = nullptr;
 
-	bool _solve(Point *begin_point, Point *end_point, bool p_allow_partial_path);
+	// The points by index, and their connections stored contiguously, built again after connections change.
+	// The neighbors of a point are in the range given by its offset and the offset of the next point.
+	LocalVector<Point *> point_list;
+	LocalVector<uint32_t> neighbor_offsets;
+	LocalVector<Point *> compact_neighbors;
+	LocalVector<uint32_t> reverse_neighbor_offsets;
+	LocalVector<Point *> reverse_compact_neighbors;
+	SafeFlag compact_graph_dirty;
+	Mutex compact_graph_mutex;
+
+	LocalVector<SolveState *> solve_states;
+	Mutex solve_states_mutex;
+
+	void _update_compact_graph();
+
+	SolveState *_acquire_solve_state();
+	void _release_solve_state(SolveState *p_state);
+	void _clear_solve_states();
+
+	static void _open_list_push_heap(LocalVector<Point *> &r_open_list, PointState *p_point_states, int64_t p_hole_idx, Point *p_value);
+	static void _open_list_pop_heap(LocalVector<Point *> &r_open_list, PointState *p_point_states);
+
+	template <typename T>
+	bool _solve(T *p_owner, SolveState &r_state, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	template <typename T>
+	Point *_solve_bidirectional(T *p_owner, SolveState &r_state, Point *p_begin_point, Point *p_end_point);
+	template <typename T>
+	void _get_path(T *p_owner, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path, LocalVector<Point *> &r_path);
 
 protected:
 	static void _bind_methods();
@@ -156,6 +207,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void set_bidirectional_search_enabled(bool p_enabled);
+	bool is_bidirectional_search_enabled() const;
+
 	int64_t get_closest_point(const Vector3 &p_point, bool p_include_disabled = false) const;
 	Vector3 get_closest_position_in_segment(const Vector3 &p_point) const;
 
@@ -168,10 +222,9 @@ public:
 
 class AStar2D : public RefCounted {
 	GDCLASS(AStar2D, RefCounted);
+	friend class AStar3D;
 	AStar3D astar;
 
-	bool _solve(AStar3D::Point *begin_point, AStar3D::Point *end_point, bool p_allow_partial_path);
-
 protected:
 	static void _bind_methods();
 
@@ -212,6 +265,9 @@ public:
 	void reserve_space(int64_t p_num_nodes);
 	void clear();
 
+	void set_bidirectional_search_enabled(bool p_enabled);
+	bool is_bidirectional_search_enabled() const;
+
 	int64_t get_closest_point(const Vector2 &p_point, bool p_include_disabled = false) const;
 	Vector2 get_closest_position_in_segment(const Vector2 &p_point) const;
 
@@ -31,6 +31,7 @@
 #include "a_star_grid_2d.h"
 #include "a_star_grid_2d.compat.inc"
 
+#include "core/object/worker_thread_pool.h"
 #include "core/variant/typed_array.h"
 
 static real_t heuristic_euclidean(const Vector2i &p_from, const Vector2i &p_to) {
@@ -60,6 +61,13 @@ static real_t heuristic_chebyshev(const Vector2i &p_from, const Vector2i &p_to)
 
 static real_t (*heuristics[AStarGrid2D::HEURISTIC_MAX])(const Vector2i &, const Vector2i &) = { heuristic_euclidean, heuristic_manhattan, heuristic_octile, heuristic_chebyshev };
 
+static _FORCE_INLINE_ uint32_t jump_direction(int32_t p_dx, int32_t p_dy) {
+	if (p_dx != 0) {
+		return p_dx > 0 ? 0 : 1;
+	}
+	return p_dy > 0 ? 2 : 3;
+}
+
 void AStarGrid2D::set_region(const Rect2i &p_region) {
 	ERR_FAIL_COND(p_region.size.x < 0 || p_region.size.y < 0);
 	if (p_region != region) {
@@ -128,17 +136,28 @@ void AStarGrid2D::update() {
 
 	points.clear();
 	solid_mask.clear();
+	jump_distances.clear();
+	jump_distances_dirty.set();
+	_clear_solve_states();
 
 	const int32_t end_x = region.get_end().x;
 	const int32_t end_y = region.get_end().y;
 	const Vector2 half_cell_size = cell_size / 2;
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
+
+	const size_t mask_size = size_t(region.size.x + 2) * size_t(region.size.y + 2);
+	solid_mask.resize((mask_size + 63) >> 6);
+	for (uint64_t &bits : solid_mask) {
+		bits = 0;
 	}
 
+	for (int32_t x = region.position.x - 1; x < end_x + 1; x++) {
+		_set_solid_unchecked(x, region.position.y - 1, true);
+		_set_solid_unchecked(x, end_y, true);
+	}
+
+	points.reserve(region.size.x * region.size.y);
 	for (int32_t y = region.position.y; y < end_y; y++) {
-		LocalVector<Point> line;
-		solid_mask.push_back(true);
+		_set_solid_unchecked(region.position.x - 1, y, true);
 		for (int32_t x = region.position.x; x < end_x; x++) {
 			Vector2 v = offset;
 			switch (cell_shape) {
@@ -154,15 +173,9 @@ void AStarGrid2D::update() {
 				default:
 					break;
 			}
-			line.push_back(Point(Vector2i(x, y), v));
-			solid_mask.push_back(false);
+			points.push_back(Point(Vector2i(x, y), v));
 		}
-		solid_mask.push_back(true);
-		points.push_back(line);
-	}
-
-	for (int32_t x = region.position.x; x < end_x + 2; x++) {
-		solid_mask.push_back(true);
+		_set_solid_unchecked(end_x, y, true);
 	}
 
 	dirty = false;
@@ -218,7 +231,13 @@ AStarGrid2D::Heuristic AStarGrid2D::get_default_estimate_heuristic() const {
 void AStarGrid2D::set_point_solid(const Vector2i &p_id, bool p_solid) {
 	ERR_FAIL_COND_MSG(dirty, "Grid is not initialized. Call the update method.");
 	ERR_FAIL_COND_MSG(!is_in_boundsv(p_id), vformat("Can't set if point is disabled. Point %s out of bounds %s.", p_id, region));
+	if (_get_solid_unchecked(p_id) == p_solid) {
+		return;
+	}
 	_set_solid_unchecked(p_id, p_solid);
+	if (!jump_distances_dirty.is_set()) {
+		_update_jump_distances_around(p_id.x, p_id.y);
+	}
 }
 
 bool AStarGrid2D::is_point_solid(const Vector2i &p_id) const {
@@ -252,6 +271,10 @@ void AStarGrid2D::fill_solid_region(const Rect2i &p_region, bool p_solid) {
 			_set_solid_unchecked(x, y, p_solid);
 		}
 	}
+
+	if (safe_region.has_area()) {
+		jump_distances_dirty.set();
+	}
 }
 
 void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weight_scale) {
@@ -269,7 +292,7 @@ void AStarGrid2D::fill_weight_scale_region(const Rect2i &p_region, real_t p_weig
 	}
 }
 
-AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
+AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to, Point *p_end) {
 	int32_t from_x = p_from->id.x;
 	int32_t from_y = p_from->id.y;
 
@@ -281,19 +304,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	if (diagonal_mode == DIAGONAL_MODE_ALWAYS || diagonal_mode == DIAGONAL_MODE_AT_LEAST_ONE_WALKABLE) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(to_x, to_y, dx, dy);
+			return _forced_successor(to_x, to_y, dx, dy, p_end);
 		}
 
 		while (_is_walkable(to_x, to_y) && (diagonal_mode == DIAGONAL_MODE_ALWAYS || _is_walkable(to_x, to_y - dy) || _is_walkable(to_x - dx, to_y))) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end->id.x == to_x && p_end->id.y == to_y) {
+				return p_end;
 			}
 
 			if ((_is_walkable(to_x - dx, to_y + dy) && !_is_walkable(to_x - dx, to_y)) || (_is_walkable(to_x + dx, to_y - dy) && !_is_walkable(to_x, to_y - dy))) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x + dx, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y + dy, 0, dy) != nullptr) {
+			if (_forced_successor(to_x + dx, to_y, dx, 0, p_end) != nullptr || _forced_successor(to_x, to_y + dy, 0, dy, p_end) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -303,19 +326,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else if (diagonal_mode == DIAGONAL_MODE_ONLY_IF_NO_OBSTACLES) {
 		if (dx == 0 || dy == 0) {
-			return _forced_successor(from_x, from_y, dx, dy, true);
+			return _forced_successor(from_x, from_y, dx, dy, p_end, true);
 		}
 
 		while (_is_walkable(to_x, to_y) && _is_walkable(to_x, to_y - dy) && _is_walkable(to_x - dx, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end->id.x == to_x && p_end->id.y == to_y) {
+				return p_end;
 			}
 
 			if ((_is_walkable(to_x + dx, to_y + dy) && !_is_walkable(to_x, to_y + dy)) || !_is_walkable(to_x + dx, to_y)) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x, to_y, dx, 0) != nullptr || _forced_successor(to_x, to_y, 0, dy) != nullptr) {
+			if (_forced_successor(to_x, to_y, dx, 0, p_end) != nullptr || _forced_successor(to_x, to_y, 0, dy, p_end) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -325,19 +348,19 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 
 	} else { // DIAGONAL_MODE_NEVER
 		if (dy == 0) {
-			return _forced_successor(from_x, from_y, dx, 0, true);
+			return _forced_successor(from_x, from_y, dx, 0, p_end, true);
 		}
 
 		while (_is_walkable(to_x, to_y)) {
-			if (end->id.x == to_x && end->id.y == to_y) {
-				return end;
+			if (p_end->id.x == to_x && p_end->id.y == to_y) {
+				return p_end;
 			}
 
 			if ((_is_walkable(to_x - 1, to_y) && !_is_walkable(to_x - 1, to_y - dy)) || (_is_walkable(to_x + 1, to_y) && !_is_walkable(to_x + 1, to_y - dy))) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
-			if (_forced_successor(to_x, to_y, 1, 0, true) != nullptr || _forced_successor(to_x, to_y, -1, 0, true) != nullptr) {
+			if (_forced_successor(to_x, to_y, 1, 0, p_end, true) != nullptr || _forced_successor(to_x, to_y, -1, 0, p_end, true) != nullptr) {
 				return _get_point_unchecked(to_x, to_y);
 			}
 
@@ -348,43 +371,138 @@ AStarGrid2D::Point *AStarGrid2D::_jump(Point *p_from, Point *p_to) {
 	return nullptr;
 }
 
-AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive) {
-	// Remembering previous results can improve performance.
-	bool l_prev = false, r_prev = false, l = false, r = false;
-
+AStarGrid2D::Point *AStarGrid2D::_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, Point *p_end, bool p_inclusive) {
 	int32_t o_x = p_x, o_y = p_y;
 	if (p_inclusive) {
 		o_x += p_dx;
 		o_y += p_dy;
 	}
 
-	int32_t l_x = p_x - p_dy, l_y = p_y - p_dx;
-	int32_t r_x = p_x + p_dy, r_y = p_y + p_dx;
+	if (!region.has_point(Vector2i(o_x, o_y))) {
+		return nullptr;
+	}
+
+	const int32_t distance = jump_distances[_to_point_index(o_x, o_y) * 8 + (p_inclusive ? 4 : 0) + jump_direction(p_dx, p_dy)];
+	const int32_t walkable_count = distance >= 0 ? distance + 1 : -distance - 1;
 
-	while (_is_walkable(o_x, o_y)) {
-		if (end->id.x == o_x && end->id.y == o_y) {
-			return end;
+	// The end point is returned if it is reached before the forced successor.
+	const int32_t end_dx = p_end->id.x - o_x;
+	const int32_t end_dy = p_end->id.y - o_y;
+	if ((p_dx == 0 ? end_dx : end_dy) == 0) {
+		const int32_t end_distance = end_dx * p_dx + end_dy * p_dy;
+		if (end_distance >= 0 && end_distance < walkable_count) {
+			return p_end;
 		}
+	}
+
+	if (distance < 0) {
+		return nullptr;
+	}
+	return _get_point_unchecked(o_x + distance * p_dx, o_y + distance * p_dy);
+}
+
+void AStarGrid2D::_update_jump_distances_line(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy) {
+	const uint32_t direction = jump_direction(p_dx, p_dy);
+
+	// Walk the line backwards from its last point, so that each point can continue the distances of the next one.
+	int32_t x = p_dx > 0 ? region.get_end().x - 1 : (p_dx < 0 ? region.position.x : p_x);
+	int32_t y = p_dy > 0 ? region.get_end().y - 1 : (p_dy < 0 ? region.position.y : p_y);
+	int32_t distance = -1;
+	int32_t inclusive_distance = -1;
+
+	while (region.has_point(Vector2i(x, y))) {
+		if (!_is_walkable(x, y)) {
+			distance = -1;
+			inclusive_distance = -1;
+		} else {
+			const bool l = _is_walkable(x - p_dy, y - p_dx);
+			const bool r = _is_walkable(x + p_dy, y + p_dx);
+
+			// A side that opens up right after this point.
+			if ((!l && _is_walkable(x - p_dy + p_dx, y - p_dx + p_dy)) || (!r && _is_walkable(x + p_dy + p_dx, y + p_dx + p_dy))) {
+				distance = 0;
+			} else {
+				distance = distance >= 0 ? distance + 1 : distance - 1;
+			}
+
+			// A side that opens up at this point.
+			if ((l && !_is_walkable(x - p_dy - p_dx, y - p_dx - p_dy)) || (r && !_is_walkable(x + p_dy - p_dx, y + p_dx - p_dy))) {
+				inclusive_distance = 0;
+			} else {
+				inclusive_distance = inclusive_distance >= 0 ? inclusive_distance + 1 : inclusive_distance - 1;
+			}
+		}
+
+		const uint32_t index = _to_point_index(x, y) * 8 + direction;
+		jump_distances[index] = distance;
+		jump_distances[index + 4] = inclusive_distance;
+
+		x -= p_dx;
+		y -= p_dy;
+	}
+}
 
-		l_prev = l || _is_walkable(l_x, l_y);
-		r_prev = r || _is_walkable(r_x, r_y);
+void AStarGrid2D::_update_jump_distances_around(int32_t p_x, int32_t p_y) {
+	// The forced neighbors of a point depend on the points on both sides of its line.
+	for (int32_t y = MAX(p_y - 1, region.position.y); y < MIN(p_y + 2, region.get_end().y); y++) {
+		_update_jump_distances_line(p_x, y, 1, 0);
+		_update_jump_distances_line(p_x, y, -1, 0);
+	}
+	for (int32_t x = MAX(p_x - 1, region.position.x); x < MIN(p_x + 2, region.get_end().x); x++) {
+		_update_jump_distances_line(x, p_y, 0, 1);
+		_update_jump_distances_line(x, p_y, 0, -1);
+	}
+}
+
+void AStarGrid2D::_update_jump_distances() {
+	if (!jump_distances_dirty.is_set()) {
+		return;
+	}
+
+	MutexLock lock(jump_distances_mutex);
+	if (!jump_distances_dirty.is_set()) {
+		return; // Updated by another query in the meantime.
+	}
 
-		l_x += p_dx;
-		l_y += p_dy;
-		r_x += p_dx;
-		r_y += p_dy;
+	jump_distances.resize(points.size() * 8);
+	for (int32_t y = region.position.y; y < region.get_end().y; y++) {
+		_update_jump_distances_line(region.position.x, y, 1, 0);
+		_update_jump_distances_line(region.position.x, y, -1, 0);
+	}
+	for (int32_t x = region.position.x; x < region.get_end().x; x++) {
+		_update_jump_distances_line(x, region.position.y, 0, 1);
+		_update_jump_distances_line(x, region.position.y, 0, -1);
+	}
 
-		l = _is_walkable(l_x, l_y);
-		r = _is_walkable(r_x, r_y);
+	jump_distances_dirty.clear();
+}
 
-		if ((l && !l_prev) || (r && !r_prev)) {
-			return _get_point_unchecked(o_x, o_y);
+AStarGrid2D::SolveState *AStarGrid2D::_acquire_solve_state() {
+	{
+		MutexLock lock(solve_states_mutex);
+		if (!solve_states.is_empty()) {
+			SolveState *state = solve_states[solve_states.size() - 1];
+			solve_states.remove_at(solve_states.size() - 1);
+			return state;
 		}
+	}
 
-		o_x += p_dx;
-		o_y += p_dy;
+	SolveState *state = memnew(SolveState);
+	state->point_states.resize(points.size());
+	return state;
+}
+
+void AStarGrid2D::_release_solve_state(SolveState *p_state) {
+	MutexLock lock(solve_states_mutex);
+	solve_states.push_back(p_state);
+}
+
+void AStarGrid2D::_clear_solve_states() {
+	MutexLock lock(solve_states_mutex);
+	for (SolveState *state : solve_states) {
+		memdelete(state);
 	}
-	return nullptr;
+	solve_states.clear();
 }
 
 void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
@@ -491,9 +609,55 @@ void AStarGrid2D::_get_nbors(Point *p_point, LocalVector<Point *> &r_nbors) {
 	}
 }
 
-bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
-	last_closest_point = nullptr;
-	pass++;
+// Same as SortArray::push_heap(), but keeps track of the positions of the points in the open list.
+void AStarGrid2D::_open_list_push_heap(SolveState &r_state, int64_t p_hole_idx, Point *p_value) const {
+	Point **open_list = r_state.open_list.ptr();
+	const SortPoints compare = { points.ptr(), r_state.point_states.ptr() };
+
+	int64_t parent = (p_hole_idx - 1) / 2;
+	while (p_hole_idx > 0 && compare(open_list[parent], p_value)) {
+		open_list[p_hole_idx] = open_list[parent];
+		_get_point_state(r_state, open_list[p_hole_idx]).open_list_index = p_hole_idx;
+		p_hole_idx = parent;
+		parent = (p_hole_idx - 1) / 2;
+	}
+	open_list[p_hole_idx] = p_value;
+	_get_point_state(r_state, p_value).open_list_index = p_hole_idx;
+}
+
+// Same as SortArray::pop_heap() followed by removing the last point, but keeps track of the positions of the points in the open list.
+void AStarGrid2D::_open_list_pop_heap(SolveState &r_state) const {
+	Point **open_list = r_state.open_list.ptr();
+	const SortPoints compare = { points.ptr(), r_state.point_states.ptr() };
+
+	const int64_t len = r_state.open_list.size() - 1;
+	Point *value = open_list[len];
+	int64_t hole_idx = 0;
+	int64_t second_child = 2;
+
+	while (second_child < len) {
+		if (compare(open_list[second_child], open_list[second_child - 1])) {
+			second_child--;
+		}
+
+		open_list[hole_idx] = open_list[second_child];
+		_get_point_state(r_state, open_list[hole_idx]).open_list_index = hole_idx;
+		hole_idx = second_child;
+		second_child = 2 * (second_child + 1);
+	}
+
+	if (second_child == len) {
+		open_list[hole_idx] = open_list[second_child - 1];
+		_get_point_state(r_state, open_list[hole_idx]).open_list_index = hole_idx;
+		hole_idx = second_child - 1;
+	}
+	_open_list_push_heap(r_state, hole_idx, value);
+	r_state.open_list.resize(len);
+}
+
+bool AStarGrid2D::_solve(SolveState &r_state, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path) {
+	r_state.last_closest_point = nullptr;
+	r_state.pass++;
 
 	if (_get_solid_unchecked(p_end_point->id) && !p_allow_partial_path) {
 		return false;
@@ -501,23 +665,31 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 
 	bool found_route = false;
 
-	LocalVector<Point *> open_list;
-	SortArray<Point *, SortPoints> sorter;
-	LocalVector<Point *> nbors;
-
-	p_begin_point->g_score = 0;
-	p_begin_point->f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
-	p_begin_point->abs_g_score = 0;
-	p_begin_point->abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	const uint64_t pass = r_state.pass;
+	LocalVector<Point *> &open_list = r_state.open_list;
+	LocalVector<Point *> &nbors = r_state.nbors;
+	open_list.clear();
+
+	PointState &begin_state = _get_point_state(r_state, p_begin_point);
+	begin_state.g_score = 0;
+	begin_state.f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	begin_state.abs_g_score = 0;
+	begin_state.abs_f_score = _estimate_cost(p_begin_point->id, p_end_point->id);
+	begin_state.open_list_index = 0;
 	open_list.push_back(p_begin_point);
-	end = p_end_point;
 
 	while (!open_list.is_empty()) {
 		Point *p = open_list[0]; // The currently processed point.
+		PointState &p_state = _get_point_state(r_state, p);
 
 		// Find point closer to end_point, or same distance to end_point but closer to begin_point.
-		if (last_closest_point == nullptr || last_closest_point->abs_f_score > p->abs_f_score || (last_closest_point->abs_f_score >= p->abs_f_score && last_closest_point->abs_g_score > p->abs_g_score)) {
-			last_closest_point = p;
+		if (r_state.last_closest_point == nullptr) {
+			r_state.last_closest_point = p;
+		} else {
+			const PointState &closest_state = _get_point_state(r_state, r_state.last_closest_point);
+			if (closest_state.abs_f_score > p_state.abs_f_score || (closest_state.abs_f_score >= p_state.abs_f_score && closest_state.abs_g_score > p_state.abs_g_score)) {
+				r_state.last_closest_point = p;
+			}
 		}
 
 		if (p == p_end_point) {
@@ -525,9 +697,8 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 			break;
 		}
 
-		sorter.pop_heap(0, open_list.size(), open_list.ptr()); // Remove the current point from the open list.
-		open_list.remove_at(open_list.size() - 1);
-		p->closed_pass = pass; // Mark the point as closed.
+		_open_list_pop_heap(r_state); // Remove the current point from the open list.
+		p_state.closed_pass = pass; // Mark the point as closed.
 
 		nbors.clear();
 		_get_nbors(p, nbors);
@@ -537,39 +708,40 @@ bool AStarGrid2D::_solve(Point *p_begin_point, Point *p_end_point, bool p_allow_
 
 			if (jumping_enabled) {
 				// TODO: Make it works with weight_scale.
-				e = _jump(p, e);
-				if (!e || e->closed_pass == pass) {
+				e = _jump(p, e, p_end_point);
+				if (!e || _get_point_state(r_state, e).closed_pass == pass) {
 					continue;
 				}
 			} else {
-				if (_get_solid_unchecked(e->id) || e->closed_pass == pass) {
+				if (_get_solid_unchecked(e->id) || _get_point_state(r_state, e).closed_pass == pass) {
 					continue;
 				}
 				weight_scale = e->weight_scale;
 			}
 
-			real_t tentative_g_score = p->g_score + _compute_cost(p->id, e->id) * weight_scale;
+			PointState &e_state = _get_point_state(r_state, e);
+			real_t tentative_g_score = p_state.g_score + _compute_cost(p->id, e->id) * weight_scale;
 			bool new_point = false;
 
-			if (e->open_pass != pass) { // The point wasn't inside the open list.
-				e->open_pass = pass;
+			if (e_state.open_pass != pass) { // The point wasn't inside the open list.
+				e_state.open_pass = pass;
 				open_list.push_back(e);
 				new_point = true;
-			} else if (tentative_g_score >= e->g_score) { // The new path is worse than the previous.
+			} else if (tentative_g_score >= e_state.g_score) { // The new path is worse than the previous.
 				continue;
 			}
 
-			e->prev_point = p;
-			e->g_score = tentative_g_score;
-			e->f_score = e->g_score + _estimate_cost(e->id, p_end_point->id);
+			e_state.prev_point = p;
+			e_state.g_score = tentative_g_score;
+			e_state.f_score = e_state.g_score + _estimate_cost(e->id, p_end_point->id);
 
-			e->abs_g_score = tentative_g_score;
-			e->abs_f_score = e->f_score - e->g_score;
+			e_state.abs_g_score = tentative_g_score;
+			e_state.abs_f_score = e_state.f_score - e_state.g_score;
 
 			if (new_point) { // The position of the new points is already known.
-				sorter.push_heap(0, open_list.size() - 1, 0, e, open_list.ptr());
+				_open_list_push_heap(r_state, open_list.size() - 1, e);
 			} else {
-				sorter.push_heap(0, open_list.find(e), 0, e, open_list.ptr());
+				_open_list_push_heap(r_state, e_state.open_list_index, e);
 			}
 		}
 	}
@@ -595,6 +767,9 @@ real_t AStarGrid2D::_compute_cost(const Vector2i &p_from_id, const Vector2i &p_t
 
 void AStarGrid2D::clear() {
 	points.clear();
+	jump_distances.clear();
+	jump_distances_dirty.set();
+	_clear_solve_states();
 	region = Rect2i();
 }
 
@@ -617,7 +792,7 @@ TypedArray<Dictionary> AStarGrid2D::get_point_data_in_region(const Rect2i &p_reg
 
 	for (int32_t y = start_y; y < end_y; y++) {
 		for (int32_t x = start_x; x < end_x; x++) {
-			const Point &p = points[y][x];
+			const Point &p = points[y * region.size.x + x];
 
 			Dictionary dict;
 			dict["id"] = p.id;
@@ -631,54 +806,109 @@ TypedArray<Dictionary> AStarGrid2D::get_point_data_in_region(const Rect2i &p_reg
 	return data;
 }
 
-Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
-	ERR_FAIL_COND_V_MSG(dirty, Vector<Vector2>(), "Grid is not initialized. Call the update method.");
-	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
-	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
-
+void AStarGrid2D::_get_path(SolveState &r_state, const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<Point *> &r_path) {
 	Point *a = _get_point(p_from_id.x, p_from_id.y);
 	Point *b = _get_point(p_to_id.x, p_to_id.y);
 
 	if (a == b) {
-		Vector<Vector2> ret;
-		ret.push_back(a->pos);
-		return ret;
+		r_path.push_back(a);
+		return;
+	}
+
+	if (jumping_enabled) {
+		_update_jump_distances();
 	}
 
 	Point *begin_point = a;
 	Point *end_point = b;
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
+	bool found_route = _solve(r_state, begin_point, end_point, p_allow_partial_path);
 	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return Vector<Vector2>();
+		if (!p_allow_partial_path || r_state.last_closest_point == nullptr) {
+			return;
 		}
 
 		// Use closest point instead.
-		end_point = last_closest_point;
+		end_point = r_state.last_closest_point;
 	}
 
 	Point *p = end_point;
 	int32_t pc = 1;
 	while (p != begin_point) {
 		pc++;
-		p = p->prev_point;
+		p = _get_point_state(r_state, p).prev_point;
 	}
 
-	Vector<Vector2> path;
-	path.resize(pc);
+	r_path.resize(pc);
 
-	{
-		Vector2 *w = path.ptrw();
+	p = end_point;
+	int32_t idx = pc - 1;
+	while (p != begin_point) {
+		r_path[idx--] = p;
+		p = _get_point_state(r_state, p).prev_point;
+	}
 
-		p = end_point;
-		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			w[idx--] = p->pos;
-			p = p->prev_point;
+	r_path[0] = p;
+}
+
+void AStarGrid2D::_solve_bulk_query(uint32_t p_index, BulkQuery *p_query) {
+	const Vector2i &from_id = p_query->from_ids[p_index];
+	const Vector2i &to_id = p_query->to_ids[p_index];
+	if (!is_in_boundsv(from_id) || !is_in_boundsv(to_id)) {
+		return;
+	}
+
+	SolveState *state = _acquire_solve_state();
+	_get_path(*state, from_id, to_id, p_query->allow_partial_path, p_query->paths[p_index]);
+	_release_solve_state(state);
+}
+
+void AStarGrid2D::_get_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path, BulkQuery &r_query) {
+	const uint32_t query_count = p_from_ids.size();
+	r_query.allow_partial_path = p_allow_partial_path;
+	r_query.from_ids.resize(query_count);
+	r_query.to_ids.resize(query_count);
+	r_query.paths.resize(query_count);
+
+	for (uint32_t i = 0; i < query_count; i++) {
+		r_query.from_ids[i] = p_from_ids[i];
+		r_query.to_ids[i] = p_to_ids[i];
+		if (!is_in_boundsv(r_query.from_ids[i]) || !is_in_boundsv(r_query.to_ids[i])) {
+			ERR_PRINT(vformat("Can't get path %d. Point %s or %s out of bounds %s.", i, r_query.from_ids[i], r_query.to_ids[i], region));
 		}
+	}
+
+	if (jumping_enabled) {
+		_update_jump_distances();
+	}
+
+	// Costs that are computed by scripts can only be evaluated on the calling thread.
+	const bool use_threads = query_count > 1 && get_script_instance() == nullptr && !GDVIRTUAL_IS_OVERRIDDEN(_estimate_cost) && !GDVIRTUAL_IS_OVERRIDDEN(_compute_cost);
+	if (use_threads) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &AStarGrid2D::_solve_bulk_query, &r_query, query_count, -1, true, SNAME("AStarGrid2DPaths"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < query_count; i++) {
+			_solve_bulk_query(i, &r_query);
+		}
+	}
+}
+
+Vector<Vector2> AStarGrid2D::get_point_path(const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, Vector<Vector2>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
+	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), Vector<Vector2>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-		w[0] = p->pos;
+	LocalVector<Point *> path_points;
+	SolveState *state = _acquire_solve_state();
+	_get_path(*state, p_from_id, p_to_id, p_allow_partial_path, path_points);
+	_release_solve_state(state);
+
+	Vector<Vector2> path;
+	path.resize(path_points.size());
+	Vector2 *w = path.ptrw();
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		w[i] = path_points[i]->pos;
 	}
 
 	return path;
@@ -689,50 +919,67 @@ TypedArray<Vector2i> AStarGrid2D::get_id_path(const Vector2i &p_from_id, const V
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_from_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_from_id, region));
 	ERR_FAIL_COND_V_MSG(!is_in_boundsv(p_to_id), TypedArray<Vector2i>(), vformat("Can't get id path. Point %s out of bounds %s.", p_to_id, region));
 
-	Point *a = _get_point(p_from_id.x, p_from_id.y);
-	Point *b = _get_point(p_to_id.x, p_to_id.y);
+	LocalVector<Point *> path_points;
+	SolveState *state = _acquire_solve_state();
+	_get_path(*state, p_from_id, p_to_id, p_allow_partial_path, path_points);
+	_release_solve_state(state);
 
-	if (a == b) {
-		TypedArray<Vector2i> ret;
-		ret.push_back(a->id);
-		return ret;
+	TypedArray<Vector2i> path;
+	path.resize(path_points.size());
+	for (uint32_t i = 0; i < path_points.size(); i++) {
+		path[i] = path_points[i]->id;
 	}
 
-	Point *begin_point = a;
-	Point *end_point = b;
+	return path;
+}
 
-	bool found_route = _solve(begin_point, end_point, p_allow_partial_path);
-	if (!found_route) {
-		if (!p_allow_partial_path || last_closest_point == nullptr) {
-			return TypedArray<Vector2i>();
-		}
+TypedArray<PackedVector2Array> AStarGrid2D::get_point_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<PackedVector2Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<PackedVector2Array>(), vformat("Can't get point paths. The number of start points (%d) doesn't match the number of end points (%d).", p_from_ids.size(), p_to_ids.size()));
 
-		// Use closest point instead.
-		end_point = last_closest_point;
-	}
+	BulkQuery query;
+	_get_paths(p_from_ids, p_to_ids, p_allow_partial_path, query);
 
-	Point *p = end_point;
-	int32_t pc = 1;
-	while (p != begin_point) {
-		pc++;
-		p = p->prev_point;
+	TypedArray<PackedVector2Array> paths;
+	paths.resize(query.paths.size());
+	for (uint32_t i = 0; i < query.paths.size(); i++) {
+		const LocalVector<Point *> &path_points = query.paths[i];
+		PackedVector2Array path;
+		path.resize(path_points.size());
+		Vector2 *w = path.ptrw();
+		for (uint32_t j = 0; j < path_points.size(); j++) {
+			w[j] = path_points[j]->pos;
+		}
+		paths[i] = path;
 	}
 
-	TypedArray<Vector2i> path;
-	path.resize(pc);
+	return paths;
+}
 
-	{
-		p = end_point;
-		int32_t idx = pc - 1;
-		while (p != begin_point) {
-			path[idx--] = p->id;
-			p = p->prev_point;
+TypedArray<Array> AStarGrid2D::get_id_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path) {
+	ERR_FAIL_COND_V_MSG(dirty, TypedArray<Array>(), "Grid is not initialized. Call the update method.");
+	ERR_FAIL_COND_V_MSG(p_from_ids.size() != p_to_ids.size(), TypedArray<Array>(), vformat("Can't get id paths. The number of start points (%d) doesn't match the number of end points (%d).", p_from_ids.size(), p_to_ids.size()));
+
+	BulkQuery query;
+	_get_paths(p_from_ids, p_to_ids, p_allow_partial_path, query);
+
+	TypedArray<Array> paths;
+	paths.resize(query.paths.size());
+	for (uint32_t i = 0; i < query.paths.size(); i++) {
+		const LocalVector<Point *> &path_points = query.paths[i];
+		TypedArray<Vector2i> path;
+		path.resize(path_points.size());
+		for (uint32_t j = 0; j < path_points.size(); j++) {
+			path[j] = path_points[j]->id;
 		}
-
-		path[0] = p->id;
+		paths[i] = path;
 	}
 
-	return path;
+	return paths;
+}
+
+AStarGrid2D::~AStarGrid2D() {
+	_clear_solve_states();
 }
 
 void AStarGrid2D::_bind_methods() {
@@ -770,6 +1017,8 @@ void AStarGrid2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_point_data_in_region", "region"), &AStarGrid2D::get_point_data_in_region);
 	ClassDB::bind_method(D_METHOD("get_point_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_point_path, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("get_id_path", "from_id", "to_id", "allow_partial_path"), &AStarGrid2D::get_id_path, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_point_paths", "from_ids", "to_ids", "allow_partial_path"), &AStarGrid2D::get_point_paths, DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_id_paths", "from_ids", "to_ids", "allow_partial_path"), &AStarGrid2D::get_id_paths, DEFVAL(false));
 
 	GDVIRTUAL_BIND(_estimate_cost, "from_id", "end_id")
 	GDVIRTUAL_BIND(_compute_cost, "from_id", "to_id")
@@ -32,7 +32,9 @@
 
 #include "core/object/gdvirtual.gen.inc"
 #include "core/object/ref_counted.h"
+#include "core/os/mutex.h"
 #include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 
 class AStarGrid2D : public RefCounted {
 	GDCLASS(AStarGrid2D, RefCounted);
@@ -79,86 +81,153 @@ private:
 		Vector2 pos;
 		real_t weight_scale = 1.0;
 
-		// Used for pathfinding.
+		Point() {}
+
+		Point(const Vector2i &p_id, const Vector2 &p_pos) :
+				id(p_id), pos(p_pos) {}
+	};
+
+	// The pathfinding data of a point, kept apart from the point so that multiple queries can run at once.
+	struct PointState {
 		Point *prev_point = nullptr;
 		real_t g_score = 0;
 		real_t f_score = 0;
 		uint64_t open_pass = 0;
 		uint64_t closed_pass = 0;
+		uint32_t open_list_index = 0;
 
 		// Used for getting last_closest_point.
 		real_t abs_g_score = 0;
 		real_t abs_f_score = 0;
+	};
 
-		Point() {}
+	struct SolveState {
+		LocalVector<PointState> point_states;
+		uint64_t pass = 1;
 
-		Point(const Vector2i &p_id, const Vector2 &p_pos) :
-				id(p_id), pos(p_pos) {}
+		Point *last_closest_point = nullptr;
+
+		LocalVector<Point *> open_list;
+		LocalVector<Point *> nbors;
 	};
 
 	struct SortPoints {
+		const Point *points = nullptr;
+		const PointState *point_states = nullptr;
+
 		_FORCE_INLINE_ bool operator()(const Point *A, const Point *B) const { // Returns true when the Point A is worse than Point B.
-			if (A->f_score > B->f_score) {
+			const PointState &a = point_states[A - points];
+			const PointState &b = point_states[B - points];
+			if (a.f_score > b.f_score) {
 				return true;
-			} else if (A->f_score < B->f_score) {
+			} else if (a.f_score < b.f_score) {
 				return false;
 			} else {
-				return A->g_score < B->g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
+				return a.g_score < b.g_score; // If the f_costs are the same then prioritize the points that are further away from the start.
 			}
 		}
 	};
 
-	LocalVector<bool> solid_mask;
-	LocalVector<LocalVector<Point>> points;
-	Point *end = nullptr;
-	Point *last_closest_point = nullptr;
+	struct BulkQuery {
+		LocalVector<Vector2i> from_ids;
+		LocalVector<Vector2i> to_ids;
+		bool allow_partial_path = false;
+
+		LocalVector<LocalVector<Point *>> paths;
+	};
+
+	// One bit per point, with a border of solid points around the region.
+	LocalVector<uint64_t> solid_mask;
+	LocalVector<Point> points;
 
-	uint64_t pass = 1;
+	// For each point and straight direction, the distance to the next jump point, or the negated number
+	// of walkable points before the next solid one minus one. The first four directions are for lines that
+	// start at the point, the last four for lines that start past it and look back at it for forced neighbors.
+	LocalVector<int32_t> jump_distances;
+	SafeFlag jump_distances_dirty;
+	Mutex jump_distances_mutex;
+
+	LocalVector<SolveState *> solve_states;
+	Mutex solve_states_mutex;
 
 private: // Internal routines.
 	_FORCE_INLINE_ size_t _to_mask_index(int32_t p_x, int32_t p_y) const {
 		return ((p_y - region.position.y + 1) * (region.size.x + 2)) + p_x - region.position.x + 1;
 	}
 
+	_FORCE_INLINE_ uint32_t _to_point_index(int32_t p_x, int32_t p_y) const {
+		return (p_y - region.position.y) * region.size.x + p_x - region.position.x;
+	}
+
+	_FORCE_INLINE_ bool _get_mask_bit(size_t p_index) const {
+		return (solid_mask[p_index >> 6] >> (p_index & 63)) & 1;
+	}
+
+	_FORCE_INLINE_ void _set_mask_bit(size_t p_index, bool p_solid) {
+		if (p_solid) {
+			solid_mask[p_index >> 6] |= uint64_t(1) << (p_index & 63);
+		} else {
+			solid_mask[p_index >> 6] &= ~(uint64_t(1) << (p_index & 63));
+		}
+	}
+
 	_FORCE_INLINE_ bool _is_walkable(int32_t p_x, int32_t p_y) const {
-		return !solid_mask[_to_mask_index(p_x, p_y)];
+		return !_get_mask_bit(_to_mask_index(p_x, p_y));
 	}
 
 	_FORCE_INLINE_ Point *_get_point(int32_t p_x, int32_t p_y) {
 		if (region.has_point(Vector2i(p_x, p_y))) {
-			return &points[p_y - region.position.y][p_x - region.position.x];
+			return &points[_to_point_index(p_x, p_y)];
 		}
 		return nullptr;
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(int32_t p_x, int32_t p_y, bool p_solid) {
-		solid_mask[_to_mask_index(p_x, p_y)] = p_solid;
+		_set_mask_bit(_to_mask_index(p_x, p_y), p_solid);
 	}
 
 	_FORCE_INLINE_ void _set_solid_unchecked(const Vector2i &p_id, bool p_solid) {
-		solid_mask[_to_mask_index(p_id.x, p_id.y)] = p_solid;
+		_set_mask_bit(_to_mask_index(p_id.x, p_id.y), p_solid);
 	}
 
 	_FORCE_INLINE_ bool _get_solid_unchecked(const Vector2i &p_id) const {
-		return solid_mask[_to_mask_index(p_id.x, p_id.y)];
+		return _get_mask_bit(_to_mask_index(p_id.x, p_id.y));
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(int32_t p_x, int32_t p_y) {
-		return &points[p_y - region.position.y][p_x - region.position.x];
+		return &points[_to_point_index(p_x, p_y)];
 	}
 
 	_FORCE_INLINE_ Point *_get_point_unchecked(const Vector2i &p_id) {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_to_point_index(p_id.x, p_id.y)];
 	}
 
 	_FORCE_INLINE_ const Point *_get_point_unchecked(const Vector2i &p_id) const {
-		return &points[p_id.y - region.position.y][p_id.x - region.position.x];
+		return &points[_to_point_index(p_id.x, p_id.y)];
+	}
+
+	_FORCE_INLINE_ PointState &_get_point_state(SolveState &r_state, const Point *p_point) const {
+		return r_state.point_states[p_point - points.ptr()];
 	}
 
+	void _update_jump_distances_line(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy);
+	void _update_jump_distances_around(int32_t p_x, int32_t p_y);
+	void _update_jump_distances();
+
+	SolveState *_acquire_solve_state();
+	void _release_solve_state(SolveState *p_state);
+	void _clear_solve_states();
+
+	void _open_list_push_heap(SolveState &r_state, int64_t p_hole_idx, Point *p_value) const;
+	void _open_list_pop_heap(SolveState &r_state) const;
+
 	void _get_nbors(Point *p_point, LocalVector<Point *> &r_nbors);
-	Point *_jump(Point *p_from, Point *p_to);
-	bool _solve(Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
-	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, bool p_inclusive = false);
+	Point *_jump(Point *p_from, Point *p_to, Point *p_end);
+	bool _solve(SolveState &r_state, Point *p_begin_point, Point *p_end_point, bool p_allow_partial_path);
+	Point *_forced_successor(int32_t p_x, int32_t p_y, int32_t p_dx, int32_t p_dy, Point *p_end, bool p_inclusive = false);
+	void _get_path(SolveState &r_state, const Vector2i &p_from_id, const Vector2i &p_to_id, bool p_allow_partial_path, LocalVector<Point *> &r_path);
+	void _get_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path, BulkQuery &r_query);
+	void _solve_bulk_query(uint32_t p_index, BulkQuery *p_query);
 
 protected:
 	static void _bind_methods();
@@ -224,6 +293,10 @@ public:
 	TypedArray<Dictionary> get_point_data_in_region(const Rect2i &p_region) const;
 	Vector<Vector2> get_point_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
 	TypedArray<Vector2i> get_id_path(const Vector2i &p_from, const Vector2i &p_to, bool p_allow_partial_path = false);
+	TypedArray<PackedVector2Array> get_point_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path = false);
+	TypedArray<Array> get_id_paths(const TypedArray<Vector2i> &p_from_ids, const TypedArray<Vector2i> &p_to_ids, bool p_allow_partial_path = false);
+
+	~AStarGrid2D();
 };
 
 VARIANT_ENUM_CAST(AStarGrid2D::DiagonalMode);
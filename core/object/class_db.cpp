@@ -640,6 +640,21 @@ Object *ClassDB::instantiate_without_postinitialization(const StringName &p_clas
 	return _instantiate_internal(p_class, true, false);
 }
 
+ClassDB::CreationFunc ClassDB::get_native_creation_func(const StringName &p_class) {
+	Locker::Lock lock(Locker::STATE_READ);
+	ClassInfo *ti = classes.getptr(p_class);
+	// Extension, runtime and editor classes are created through instantiate(), which handles their special cases.
+	if (!_can_instantiate(ti) || ti->gdextension || ti->is_runtime) {
+		return nullptr;
+	}
+#ifdef TOOLS_ENABLED
+	if (ti->api == API_EDITOR && !Engine::get_singleton()->is_editor_hint()) {
+		return nullptr;
+	}
+#endif
+	return ti->creation_func;
+}
+
 #ifdef TOOLS_ENABLED
 ObjectGDExtension *ClassDB::get_placeholder_extension(const StringName &p_class) {
 	ObjectGDExtension *placeholder_extension = placeholder_extensions.getptr(p_class);
@@ -1769,6 +1784,21 @@ StringName ClassDB::get_property_setter(const StringName &p_class, const StringN
 	return StringName();
 }
 
+const ClassDB::PropertySetGet *ClassDB::get_property_setget(const StringName &p_class, const StringName &p_property) {
+	ClassInfo *type = classes.getptr(p_class);
+	ClassInfo *check = type;
+	while (check) {
+		const PropertySetGet *psg = check->property_setget.getptr(p_property);
+		if (psg) {
+			return psg;
+		}
+
+		check = check->inherits_ptr;
+	}
+
+	return nullptr;
+}
+
 StringName ClassDB::get_property_getter(const StringName &p_class, const StringName &p_property) {
 	ClassInfo *type = classes.getptr(p_class);
 	ClassInfo *check = type;
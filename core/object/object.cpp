@@ -1207,14 +1207,50 @@ Error Object::_emit_signal(const Variant **p_args, int p_argcount, Callable::Cal
 	return emit_signalp(signal, args, argc);
 }
 
+void Object::SignalData::clear_emit_slots() {
+	if (emit_slots && emit_slots->refcount.unref()) {
+		memdelete(emit_slots);
+	}
+	emit_slots = nullptr;
+}
+
+Object::SignalData::EmitSlots *Object::_build_emit_slots(const SignalData &p_signal) {
+	SignalData::EmitSlots *slots = memnew(SignalData::EmitSlots);
+	slots->refcount.init();
+
+	uint32_t slot_count = p_signal.slot_map.size();
+	slots->callables.resize(slot_count);
+	slots->flags.resize(slot_count);
+	slots->method_binds.resize(slot_count);
+
+	uint32_t i = 0;
+	for (const KeyValue<Callable, SignalData::Slot> &slot_kv : p_signal.slot_map) {
+		const Callable &callable = slot_kv.value.conn.callable;
+		slots->callables[i] = callable;
+		slots->flags[i] = slot_kv.value.conn.flags;
+		slots->has_one_shot = slots->has_one_shot || (slots->flags[i] & CONNECT_ONE_SHOT);
+
+		// Same lookup as Object::callp(), done once instead of on every emission.
+		MethodBind *method_bind = nullptr;
+		if (callable.is_standard() && callable.get_method() != CoreStringName(free_)) {
+			Object *target = callable.get_object();
+			if (target) {
+				method_bind = ClassDB::get_method(target->get_class_name(), callable.get_method());
+			}
+		}
+		slots->method_binds[i] = method_bind;
+		i++;
+	}
+
+	return slots;
+}
+
 Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int p_argcount) {
 	if (_block_signals) {
 		return ERR_CANT_ACQUIRE_RESOURCE; //no emit, signals blocked
 	}
 
-	Callable *slot_callables = nullptr;
-	uint32_t *slot_flags = nullptr;
-	uint32_t slot_count = 0;
+	SignalData::EmitSlots *slots = nullptr;
 
 	{
 		OBJ_SIGNAL_LOCK
@@ -1230,34 +1266,35 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 			return ERR_UNAVAILABLE;
 		}
 
+		if (s->slot_map.is_empty()) {
+			return OK;
+		}
+
 		// If this is a ref-counted object, prevent it from being destroyed during signal emission,
 		// which is needed in certain edge cases; e.g., https://github.com/godotengine/godot/issues/73889.
 		Ref<RefCounted> rc = Ref<RefCounted>(Object::cast_to<RefCounted>(this));
 
 		// Ensure that disconnecting the signal or even deleting the object
 		// will not affect the signal calling.
-		slot_callables = (Callable *)alloca(sizeof(Callable) * s->slot_map.size());
-		slot_flags = (uint32_t *)alloca(sizeof(uint32_t) * s->slot_map.size());
-
-		for (const KeyValue<Callable, SignalData::Slot> &slot_kv : s->slot_map) {
-			memnew_placement(&slot_callables[slot_count], Callable(slot_kv.value.conn.callable));
-			slot_flags[slot_count] = slot_kv.value.conn.flags;
-			++slot_count;
+		if (!s->emit_slots) {
+			s->emit_slots = _build_emit_slots(*s);
 		}
-
-		DEV_ASSERT(slot_count == s->slot_map.size());
+		slots = s->emit_slots;
+		slots->refcount.ref();
 
 		// Disconnect all one-shot connections before emitting to prevent recursion.
-		for (uint32_t i = 0; i < slot_count; ++i) {
-			bool disconnect = slot_flags[i] & CONNECT_ONE_SHOT;
+		if (slots->has_one_shot) {
+			for (uint32_t i = 0; i < slots->flags.size(); ++i) {
+				bool disconnect = slots->flags[i] & CONNECT_ONE_SHOT;
 #ifdef TOOLS_ENABLED
-			if (disconnect && (slot_flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
-				// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
-				disconnect = false;
-			}
+				if (disconnect && (slots->flags[i] & CONNECT_PERSIST) && Engine::get_singleton()->is_editor_hint()) {
+					// This signal was connected from the editor, and is being edited. Just don't disconnect for now.
+					disconnect = false;
+				}
 #endif
-			if (disconnect) {
-				_disconnect(p_name, slot_callables[i]);
+				if (disconnect) {
+					_disconnect(p_name, slots->callables[i]);
+				}
 			}
 		}
 	}
@@ -1266,25 +1303,45 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 
 	Error err = OK;
 
+	uint32_t slot_count = slots->callables.size();
 	for (uint32_t i = 0; i < slot_count; ++i) {
-		const Callable &callable = slot_callables[i];
-		const uint32_t &flags = slot_flags[i];
+		const Callable &callable = slots->callables[i];
+		const uint32_t &flags = slots->flags[i];
+		MethodBind *method_bind = slots->method_binds[i];
+
+		const Variant **args = p_args;
+		int argc = p_argcount;
 
-		if (!callable.is_valid()) {
+		// Methods of native classes are called directly, unless a script may override them.
+		Object *target = nullptr;
+		if (method_bind) {
+			target = ObjectDB::get_instance(callable.get_object_id());
+			if (!target) {
+				// Target might have been deleted during signal callback, this is expected and OK.
+				continue;
+			}
+			if (target->get_script_instance()) {
+				method_bind = nullptr;
+			}
+		} else if (!callable.is_valid()) {
 			// Target might have been deleted during signal callback, this is expected and OK.
 			continue;
 		}
 
-		const Variant **args = p_args;
-		int argc = p_argcount;
-
 		if (flags & CONNECT_DEFERRED) {
 			MessageQueue::get_singleton()->push_callablep(callable, args, argc, true);
 		} else {
 			Callable::CallError ce;
 			_emitting = true;
-			Variant ret;
-			callable.callp(args, argc, ret, ce);
+			if (method_bind) {
+#ifdef DEBUG_ENABLED
+				_ObjectDebugLock target_lock(target);
+#endif
+				method_bind->call(target, args, argc, ce);
+			} else {
+				Variant ret;
+				callable.callp(args, argc, ret, ce);
+			}
 			_emitting = false;
 
 			if (ce.error != Callable::CallError::CALL_OK) {
@@ -1293,7 +1350,7 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 					continue;
 				}
 #endif
-				Object *target = callable.get_object();
+				target = callable.get_object();
 				if (ce.error == Callable::CallError::CALL_ERROR_INVALID_METHOD && target && !ClassDB::class_exists(target->get_class_name())) {
 					//most likely object is not initialized yet, do not throw error.
 				} else {
@@ -1304,8 +1361,8 @@ Error Object::emit_signalp(const StringName &p_name, const Variant **p_args, int
 		}
 	}
 
-	for (uint32_t i = 0; i < slot_count; ++i) {
-		slot_callables[i].~Callable();
+	if (slots->refcount.unref()) {
+		memdelete(slots);
 	}
 
 	return err;
@@ -1533,6 +1590,7 @@ Error Object::connect(const StringName &p_signal, const Callable &p_callable, ui
 
 	//use callable version as key, so binds can be ignored
 	s->slot_map[*p_callable.get_base_comparator()] = slot;
+	s->clear_emit_slots();
 
 	return OK;
 }
@@ -1613,6 +1671,7 @@ bool Object::_disconnect(const StringName &p_signal, const Callable &p_callable,
 	}
 
 	s->slot_map.erase(*p_callable.get_base_comparator());
+	s->clear_emit_slots();
 
 	if (s->slot_map.is_empty() && ClassDB::has_signal(get_class_name(), p_signal)) {
 		//not user signal, delete
@@ -39,6 +39,7 @@
 #include "core/templates/hash_map.h"
 #include "core/templates/hash_set.h"
 #include "core/templates/list.h"
+#include "core/templates/local_vector.h"
 #include "core/templates/rb_map.h"
 #include "core/templates/safe_refcount.h"
 #include "core/variant/callable_bind.h"
@@ -606,10 +607,37 @@ private:
 			List<Connection>::Element *cE = nullptr;
 		};
 
+		// Slots copied to contiguous arrays for emission, shared by emissions until the connections change.
+		// Each emission holds a reference, so connecting or disconnecting while emitting is safe.
+		struct EmitSlots {
+			SafeRefCount refcount;
+			LocalVector<Callable> callables;
+			LocalVector<uint32_t> flags;
+			LocalVector<MethodBind *> method_binds; // Methods of native classes, called directly when the target has no script.
+			bool has_one_shot = false;
+		};
+
 		MethodInfo user;
 		HashMap<Callable, Slot, HashableHasher<Callable>> slot_map;
 		bool removable = false;
+		EmitSlots *emit_slots = nullptr;
+
+		void clear_emit_slots();
+
+		SignalData() {}
+		SignalData(const SignalData &p_other) :
+				user(p_other.user), slot_map(p_other.slot_map), removable(p_other.removable) {}
+		SignalData &operator=(const SignalData &p_other) {
+			clear_emit_slots();
+			user = p_other.user;
+			slot_map = p_other.slot_map;
+			removable = p_other.removable;
+			return *this;
+		}
+		~SignalData() { clear_emit_slots(); }
 	};
+
+	static SignalData::EmitSlots *_build_emit_slots(const SignalData &p_signal);
 	friend struct _ObjectSignalLock;
 	mutable Mutex *signal_mutex = nullptr;
 	HashMap<StringName, SignalData> signal_map;
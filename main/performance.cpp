@@ -32,8 +32,10 @@
 
 #include "core/os/os.h"
 #include "core/variant/typed_array.h"
+#include "scene/animation/animation_mixer.h"
 #include "scene/main/node.h"
 #include "scene/main/scene_tree.h"
+#include "scene/resources/packed_scene.h"
 #include "servers/audio_server.h"
 #ifndef NAVIGATION_2D_DISABLED
 #include "servers/navigation_server_2d.h"
@@ -129,6 +131,16 @@ void Performance::_bind_methods() {
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(NAVIGATION_3D_OBSTACLE_COUNT);
 #endif // NAVIGATION_3D_DISABLED
+#ifndef NAVIGATION_2D_DISABLED
+	BIND_ENUM_CONSTANT(NAVIGATION_2D_ITERATION_BUILD_TIME);
+#endif // NAVIGATION_2D_DISABLED
+#ifndef NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(NAVIGATION_3D_ITERATION_BUILD_TIME);
+#endif // NAVIGATION_3D_DISABLED
+	BIND_ENUM_CONSTANT(ANIMATION_MIXERS_UPDATED);
+	BIND_ENUM_CONSTANT(ANIMATION_MIXERS_SKIPPED);
+	BIND_ENUM_CONSTANT(OBJECT_POOLED_INSTANCES);
+	BIND_ENUM_CONSTANT(OBJECT_REUSED_INSTANCES);
 	BIND_ENUM_CONSTANT(MONITOR_MAX);
 }
 
@@ -209,6 +221,16 @@ String Performance::get_monitor_name(Monitor p_monitor) const {
 		PNAME("navigation_3d/edges_free"),
 		PNAME("navigation_3d/obstacles"),
 #endif // NAVIGATION_3D_DISABLED
+#ifndef NAVIGATION_2D_DISABLED
+		PNAME("navigation_2d/iteration_build_time"),
+#endif // NAVIGATION_2D_DISABLED
+#ifndef NAVIGATION_3D_DISABLED
+		PNAME("navigation_3d/iteration_build_time"),
+#endif // NAVIGATION_3D_DISABLED
+		PNAME("animation/mixers_updated"),
+		PNAME("animation/mixers_skipped"),
+		PNAME("object/pooled_instances"),
+		PNAME("object/reused_instances"),
 	};
 	static_assert(std::size(names) == MONITOR_MAX);
 
@@ -408,6 +430,8 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer2D::get_singleton()->get_process_info(NavigationServer2D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_2D_OBSTACLE_COUNT:
 			return NavigationServer2D::get_singleton()->get_process_info(NavigationServer2D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_2D_ITERATION_BUILD_TIME:
+			return NavigationServer2D::get_singleton()->get_process_info(NavigationServer2D::INFO_ITERATION_BUILD_TIME) / 1000000.0;
 #endif // NAVIGATION_2D_DISABLED
 
 #ifndef NAVIGATION_3D_DISABLED
@@ -431,7 +455,17 @@ double Performance::get_monitor(Monitor p_monitor) const {
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT);
 		case NAVIGATION_3D_OBSTACLE_COUNT:
 			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_OBSTACLE_COUNT);
+		case NAVIGATION_3D_ITERATION_BUILD_TIME:
+			return NavigationServer3D::get_singleton()->get_process_info(NavigationServer3D::INFO_ITERATION_BUILD_TIME) / 1000000.0;
 #endif // NAVIGATION_3D_DISABLED
+		case ANIMATION_MIXERS_UPDATED:
+			return AnimationMixer::get_lod_updated_mixer_count();
+		case ANIMATION_MIXERS_SKIPPED:
+			return AnimationMixer::get_lod_skipped_mixer_count();
+		case OBJECT_POOLED_INSTANCES:
+			return PackedScene::get_total_pooled_instance_count();
+		case OBJECT_REUSED_INSTANCES:
+			return PackedScene::get_total_reused_instance_count();
 
 		default: {
 		}
@@ -503,6 +537,12 @@ Performance::MonitorType Performance::get_monitor_type(Monitor p_monitor) const
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
 		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_TIME,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
+		MONITOR_TYPE_QUANTITY,
 
 	};
 	static_assert((sizeof(types) / sizeof(MonitorType)) == MONITOR_MAX);
@@ -125,6 +125,12 @@ public:
 		NAVIGATION_3D_EDGE_CONNECTION_COUNT,
 		NAVIGATION_3D_EDGE_FREE_COUNT,
 		NAVIGATION_3D_OBSTACLE_COUNT,
+		NAVIGATION_2D_ITERATION_BUILD_TIME,
+		NAVIGATION_3D_ITERATION_BUILD_TIME,
+		ANIMATION_MIXERS_UPDATED,
+		ANIMATION_MIXERS_SKIPPED,
+		OBJECT_POOLED_INSTANCES,
+		OBJECT_REUSED_INSTANCES,
 		MONITOR_MAX
 	};
 
@@ -105,6 +105,11 @@ class GodotBody2D : public GodotCollisionObject2D {
 	virtual void _shapes_changed() override;
 	Transform2D new_transform;
 
+	// Set by the thread-safe integration passes, applied to the broadphase afterwards.
+	Vector2 pending_motion;
+	bool pending_motion_update = false;
+	bool pending_shapes_update = false;
+
 	List<Pair<GodotConstraint2D *, int>> constraint_list;
 
 	struct AreaCMP {
@@ -315,8 +320,12 @@ public:
 	_FORCE_INLINE_ real_t get_friction() const { return friction; }
 	_FORCE_INLINE_ real_t get_bounce() const { return bounce; }
 
+	// Integration only touches the body itself and can run on multiple threads.
+	// The post_integrate_*() counterparts update the broadphase and the space lists, and must be called serially.
 	void integrate_forces(real_t p_step);
+	void post_integrate_forces();
 	void integrate_velocities(real_t p_step);
+	void post_integrate_velocities();
 
 	_FORCE_INLINE_ Vector2 get_velocity_in_local_point(const Vector2 &rel_pos) const {
 		return linear_velocity + Vector2(-angular_velocity * rel_pos.y, angular_velocity * rel_pos.x);
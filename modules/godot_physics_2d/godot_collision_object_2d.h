@@ -74,9 +74,8 @@ private:
 
 	SelfList<GodotCollisionObject2D> pending_shape_update_list;
 
-	void _update_shapes();
-
 protected:
+	void _update_shapes();
 	void _update_shapes_with_motion(const Vector2 &p_motion);
 	void _unregister_shapes();
 
@@ -39,6 +39,15 @@
 #define ISLAND_COUNT_RESERVE 128
 #define ISLAND_SIZE_RESERVE 512
 #define CONSTRAINT_COUNT_RESERVE 1024
+#define ACTIVE_BODY_COUNT_RESERVE 1024
+
+void GodotStep2D::_integrate_forces(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_forces(delta);
+}
+
+void GodotStep2D::_integrate_velocities(uint32_t p_body_index, void *p_userdata) {
+	active_bodies[p_body_index]->integrate_velocities(delta);
+}
 
 void GodotStep2D::_populate_island(GodotBody2D *p_body, LocalVector<GodotBody2D *> &p_body_island, LocalVector<GodotConstraint2D *> &p_constraint_island) {
 	p_body->set_island_step(_step);
@@ -143,16 +152,25 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	uint64_t profile_begtime = OS::get_singleton()->get_ticks_usec();
 	uint64_t profile_endtime = 0;
 
-	int active_count = 0;
+	active_bodies.clear();
 
 	const SelfList<GodotBody2D> *b = body_list->first();
 	while (b) {
-		b->self()->integrate_forces(p_delta);
+		active_bodies.push_back(b->self());
 		b = b->next();
-		active_count++;
 	}
 
-	p_space->set_active_objects(active_count);
+	uint32_t active_count = active_bodies.size();
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_forces, nullptr, active_count, -1, true, SNAME("Physics2DIntegrateForces"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// WARNING: Broadphase updates aren't thread-safe, so they are applied after integration.
+	for (uint32_t body_index = 0; body_index < active_count; ++body_index) {
+		active_bodies[body_index]->post_integrate_forces();
+	}
+
+	p_space->set_active_objects((int)active_count);
 
 	// Update the broadphase to register collision pairs.
 	p_space->update();
@@ -241,7 +259,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics2DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -272,11 +290,23 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 
 	/* INTEGRATE VELOCITIES */
 
+	// Bodies can be activated while pairing, so the active list is gathered again.
+	active_bodies.clear();
+
 	b = body_list->first();
 	while (b) {
-		const SelfList<GodotBody2D> *n = b->next();
-		b->self()->integrate_velocities(p_delta);
-		b = n; // in case it shuts itself down
+		active_bodies.push_back(b->self());
+		b = b->next();
+	}
+
+	active_count = active_bodies.size();
+
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep2D::_integrate_velocities, nullptr, active_count, -1, true, SNAME("Physics2DIntegrateVelocities"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// WARNING: This doesn't run on threads, because it updates the broadphase and can deactivate bodies.
+	for (uint32_t body_index = 0; body_index < active_count; ++body_index) {
+		active_bodies[body_index]->post_integrate_velocities();
 	}
 
 	/* SLEEP / WAKE UP ISLANDS */
@@ -298,6 +328,7 @@ void GodotStep2D::step(GodotSpace2D *p_space, real_t p_delta) {
 }
 
 GodotStep2D::GodotStep2D() {
+	active_bodies.reserve(ACTIVE_BODY_COUNT_RESERVE);
 	body_islands.reserve(BODY_ISLAND_COUNT_RESERVE);
 	constraint_islands.reserve(ISLAND_COUNT_RESERVE);
 	all_constraints.reserve(CONSTRAINT_COUNT_RESERVE);
@@ -165,6 +165,7 @@ void GodotBodyPair3D::validate_contacts() {
 // weaker than it should for a bounce!
 // Process: Only proceed if body A's motion is high relative to its size.
 // Cast forward along motion vector to see if A is going to enter/pass B's collider next frame, only proceed if it does.
+// If none of the rays hit, sweep A's shape along the motion instead, so thin geometry isn't missed.
 // Adjust the velocity of A down so that it will just slightly intersect the collider instead of blowing right past it.
 bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A, const Transform3D &p_xform_A, GodotBody3D *p_B, int p_shape_B, const Transform3D &p_xform_B) {
 	GodotShape3D *shape_A_ptr = p_A->get_shape(p_shape_A);
@@ -232,9 +233,28 @@ bool GodotBodyPair3D::_test_ccd(real_t p_step, GodotBody3D *p_A, int p_shape_A,
 	}
 
 	if (segment_support_idx == -1) {
-		// There was no hit. Since the segment is the length of per-frame motion, this means the bodies will not
-		// actually collide yet on next frame. We'll probably check again next frame once they're closer.
-		return false;
+		// The rays can miss geometry that is thinner than A or edges that are not right in front of the support points,
+		// so sweep the whole shape along its motion relative to B before giving up.
+		PhysicsServer3D::ShapeType type_A = shape_A_ptr->get_type();
+		if (shape_A_ptr->is_concave() || type_A == PhysicsServer3D::SHAPE_WORLD_BOUNDARY || type_A == PhysicsServer3D::SHAPE_SEPARATION_RAY) {
+			return false;
+		}
+
+		Vector3 relative_motion = motion - p_B->get_linear_velocity() * p_step;
+		real_t safe = 1.0, unsafe = 1.0;
+		if (!GodotCollisionSolver3D::cast_motion(shape_A_ptr, p_xform_A, relative_motion, p_B->get_shape(p_shape_B), p_xform_B, (max - min) * 0.01, safe, unsafe)) {
+			// There was no hit. Since the sweep is the length of per-frame motion, this means the bodies will not
+			// actually collide yet on next frame. We'll probably check again next frame once they're closer.
+			return false;
+		}
+
+		// The fractions are of the motion relative to B, so when B moves too they don't apply to A's own motion.
+		// Shorten the relative motion to just past the first contact instead, and let A keep B's velocity on top of it.
+		real_t relative_len = relative_motion.length();
+		real_t newlen = relative_len * unsafe + (max - min) * 0.01;
+		p_A->set_linear_velocity(p_B->get_linear_velocity() + (relative_motion / relative_len) * newlen / p_step);
+
+		return true;
 	}
 
 	Vector3 hitpos = predicted_xform_B.xform(segment_hit_local);
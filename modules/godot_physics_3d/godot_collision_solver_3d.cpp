@@ -587,3 +587,58 @@ bool GodotCollisionSolver3D::solve_distance(const GodotShape3D *p_shape_A, const
 		return gjk_epa_calculate_distance(p_shape_A, p_transform_A, p_shape_B, p_transform_B, r_point_A, r_point_B); //should pass sepaxis..
 	}
 }
+
+// Sweeps convex shape A along its motion and finds the fraction of the motion at which it starts touching shape B.
+// The search stops once the interval between the last safe and the first unsafe fraction is shorter than p_tolerance.
+// Returns false if A doesn't hit B during the motion, or already overlaps it at the start.
+bool GodotCollisionSolver3D::cast_motion(const GodotShape3D *p_shape_A, const Transform3D &p_transform_A, const Vector3 &p_motion_A, const GodotShape3D *p_shape_B, const Transform3D &p_transform_B, real_t p_tolerance, real_t &r_safe, real_t &r_unsafe) {
+	ERR_FAIL_COND_V(p_shape_A->is_concave(), false);
+
+	real_t motion_length = p_motion_A.length();
+	if (motion_length < CMP_EPSILON) {
+		return false;
+	}
+
+	AABB aabb = p_transform_A.xform(p_shape_A->get_aabb());
+	aabb = aabb.merge(AABB(aabb.position + p_motion_A, aabb.size));
+
+	Transform3D xform_inv = p_transform_A.affine_inverse();
+	GodotMotionShape3D mshape;
+	mshape.shape = const_cast<GodotShape3D *>(p_shape_A);
+	mshape.motion = xform_inv.basis.xform(p_motion_A);
+
+	Vector3 motion_normal = p_motion_A / motion_length;
+
+	// Does it collide if going all the way?
+	Vector3 point_A, point_B;
+	Vector3 sep_axis = motion_normal;
+	if (solve_distance(&mshape, p_transform_A, p_shape_B, p_transform_B, point_A, point_B, aabb, &sep_axis)) {
+		return false;
+	}
+
+	// Ignore shapes it's already inside of, they are handled by regular contacts.
+	sep_axis = motion_normal;
+	if (!solve_distance(p_shape_A, p_transform_A, p_shape_B, p_transform_B, point_A, point_B, aabb, &sep_axis)) {
+		return false;
+	}
+
+	real_t low = 0.0;
+	real_t hi = 1.0;
+	static const int max_steps = 16;
+	for (int i = 0; i < max_steps && (hi - low) * motion_length > p_tolerance; i++) {
+		real_t fraction = (low + hi) * 0.5;
+
+		mshape.motion = xform_inv.basis.xform(p_motion_A * fraction);
+
+		sep_axis = motion_normal;
+		if (solve_distance(&mshape, p_transform_A, p_shape_B, p_transform_B, point_A, point_B, aabb, &sep_axis)) {
+			low = fraction;
+		} else {
+			hi = fraction;
+		}
+	}
+
+	r_safe = low;
+	r_unsafe = hi;
+	return true;
+}
@@ -1273,11 +1273,16 @@ Vector<Vector3> GodotConcavePolygonShape3D::get_faces() const {
 	Vector<Vector3> rfaces;
 	rfaces.resize(faces.size() * 3);
 
+	Vector3 *rfacesw = rfaces.ptrw();
+	const Face *fr = faces.ptr();
+	const Vector3 *vr = vertices.ptr();
+
 	for (int i = 0; i < faces.size(); i++) {
-		Face f = faces.get(i);
+		const Face &f = fr[i];
+		int src_index = face_source_index[i];
 
 		for (int j = 0; j < 3; j++) {
-			rfaces.set(i * 3 + j, vertices.get(f.indices[j]));
+			rfacesw[src_index * 3 + j] = vr[f.indices[j]];
 		}
 	}
 
@@ -1330,16 +1335,23 @@ Vector3 GodotConcavePolygonShape3D::get_support(const Vector3 &p_normal) const {
 	return vptr[vert_support_idx];
 }
 
-void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+void GodotConcavePolygonShape3D::_quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const {
+	Vector3 min = (p_aabb.position - bvh_origin) * bvh_quantize_scale;
+	Vector3 max = (p_aabb.position + p_aabb.size - bvh_origin) * bvh_quantize_scale;
 
-	if (!params_bvh->aabb.intersects_segment(p_params->from, p_params->to)) {
-		return;
+	// Round outwards, with an extra step to absorb floating point error on the way back.
+	for (int i = 0; i < 3; i++) {
+		r_min[i] = (uint16_t)CLAMP(Math::floor(min[i]) - 1.0, 0.0, 65535.0);
+		r_max[i] = (uint16_t)CLAMP(Math::ceil(max[i]) + 1.0, 0.0, 65535.0);
 	}
+}
+
+void GodotConcavePolygonShape3D::_cull_segment_leaf(const BVH &p_node, _SegmentCullParams *p_params) const {
+	GodotFaceShape3D *face = p_params->face;
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
+	for (uint32_t i = 0; i < p_node.face_count; i++) {
+		int face_index = p_node.index + i;
+		const Face *f = &p_params->faces[face_index];
 		face->normal = f->normal;
 		face->vertex[0] = p_params->vertices[f->indices[0]];
 		face->vertex[1] = p_params->vertices[f->indices[1]];
@@ -1347,24 +1359,16 @@ void GodotConcavePolygonShape3D::_cull_segment(int p_idx, _SegmentCullParams *p_
 
 		Vector3 res;
 		Vector3 normal;
-		int face_index = params_bvh->face_index;
 		if (face->intersect_segment(p_params->from, p_params->to, res, normal, face_index, true)) {
 			real_t d = p_params->dir.dot(res) - p_params->dir.dot(p_params->from);
 			if ((d > 0) && (d < p_params->min_d)) {
 				p_params->min_d = d;
 				p_params->result = res;
 				p_params->normal = normal;
-				p_params->face_index = face_index;
+				p_params->face_index = face_source_index[p_node.index + i];
 				p_params->collisions++;
 			}
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			_cull_segment(params_bvh->left, p_params);
-		}
-		if (params_bvh->right >= 0) {
-			_cull_segment(params_bvh->right, p_params);
-		}
 	}
 }
 
@@ -1388,12 +1392,35 @@ bool GodotConcavePolygonShape3D::intersect_segment(const Vector3 &p_begin, const
 
 	params.faces = fr;
 	params.vertices = vr;
-	params.bvh = br;
 
 	params.face = &face;
 
-	// cull
-	_cull_segment(0, &params);
+	// Nodes are only tested against the part of the segment in front of the closest hit found so far.
+	Vector3 cull_to = p_end;
+
+	uint32_t stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const BVH &node = br[stack[--stack_size]];
+
+		if (!_get_bvh_aabb(node).intersects_segment(p_begin, cull_to)) {
+			continue;
+		}
+
+		if (node.face_count > 0) {
+			int collisions = params.collisions;
+			_cull_segment_leaf(node, &params);
+			if (params.collisions != collisions) {
+				cull_to = params.result;
+			}
+		} else {
+			uint32_t node_index = &node - br;
+			stack[stack_size++] = node.index;
+			stack[stack_size++] = node_index + 1;
+		}
+	}
 
 	if (params.collisions > 0) {
 		r_result = params.result;
@@ -1413,35 +1440,29 @@ Vector3 GodotConcavePolygonShape3D::get_closest_point_to(const Vector3 &p_point)
 	return Vector3();
 }
 
-bool GodotConcavePolygonShape3D::_cull(int p_idx, _CullParams *p_params) const {
-	const BVH *params_bvh = &p_params->bvh[p_idx];
+bool GodotConcavePolygonShape3D::_cull_leaf(const BVH &p_node, _CullParams *p_params) const {
+	GodotFaceShape3D *face = p_params->face;
 
-	if (!p_params->aabb.intersects(params_bvh->aabb)) {
-		return false;
-	}
+	for (uint32_t i = 0; i < p_node.face_count; i++) {
+		const Face *f = &p_params->faces[p_node.index + i];
+		const Vector3 &v0 = p_params->vertices[f->indices[0]];
+		const Vector3 &v1 = p_params->vertices[f->indices[1]];
+		const Vector3 &v2 = p_params->vertices[f->indices[2]];
+
+		AABB face_aabb(v0, Vector3());
+		face_aabb.expand_to(v1);
+		face_aabb.expand_to(v2);
+		if (!p_params->aabb.intersects(face_aabb)) {
+			continue;
+		}
 
-	if (params_bvh->face_index >= 0) {
-		const Face *f = &p_params->faces[params_bvh->face_index];
-		GodotFaceShape3D *face = p_params->face;
 		face->normal = f->normal;
-		face->vertex[0] = p_params->vertices[f->indices[0]];
-		face->vertex[1] = p_params->vertices[f->indices[1]];
-		face->vertex[2] = p_params->vertices[f->indices[2]];
+		face->vertex[0] = v0;
+		face->vertex[1] = v1;
+		face->vertex[2] = v2;
 		if (p_params->callback(p_params->userdata, face)) {
 			return true;
 		}
-	} else {
-		if (params_bvh->left >= 0) {
-			if (_cull(params_bvh->left, p_params)) {
-				return true;
-			}
-		}
-
-		if (params_bvh->right >= 0) {
-			if (_cull(params_bvh->right, p_params)) {
-				return true;
-			}
-		}
 	}
 
 	return false;
@@ -1454,6 +1475,9 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	}
 
 	AABB local_aabb = p_local_aabb;
+	if (!local_aabb.intersects(get_aabb())) {
+		return;
+	}
 
 	// unlock data
 	const Face *fr = faces.ptr();
@@ -1469,12 +1493,36 @@ void GodotConcavePolygonShape3D::cull(const AABB &p_local_aabb, QueryCallback p_
 	params.face = &face;
 	params.faces = fr;
 	params.vertices = vr;
-	params.bvh = br;
 	params.callback = p_callback;
 	params.userdata = p_userdata;
 
+	// Internal nodes are tested in quantized space, which only needs integer comparisons.
+	_quantize_aabb(local_aabb, params.min, params.max);
+
 	// cull
-	_cull(0, &params);
+	uint32_t stack[BVH_MAX_DEPTH];
+	int stack_size = 0;
+	stack[stack_size++] = 0;
+
+	while (stack_size > 0) {
+		const BVH &node = br[stack[--stack_size]];
+
+		if (node.min[0] > params.max[0] || node.max[0] < params.min[0] ||
+				node.min[1] > params.max[1] || node.max[1] < params.min[1] ||
+				node.min[2] > params.max[2] || node.max[2] < params.min[2]) {
+			continue;
+		}
+
+		if (node.face_count > 0) {
+			if (_cull_leaf(node, &params)) {
+				return;
+			}
+		} else {
+			uint32_t node_index = &node - br;
+			stack[stack_size++] = node.index;
+			stack[stack_size++] = node_index + 1;
+		}
+	}
 }
 
 Vector3 GodotConcavePolygonShape3D::get_moment_of_inertia(real_t p_mass) const {
@@ -1511,90 +1559,58 @@ struct _Volume_BVH_CompareZ {
 	}
 };
 
-struct _Volume_BVH {
-	AABB aabb;
-	_Volume_BVH *left = nullptr;
-	_Volume_BVH *right = nullptr;
+uint32_t GodotConcavePolygonShape3D::_build_bvh(_Volume_BVH_Element *p_elements, uint32_t p_offset, uint32_t p_size) {
+	uint32_t node_index = bvh.size();
+	bvh.push_back(BVH());
 
-	int face_index = 0;
-};
+	_Volume_BVH_Element *elements = &p_elements[p_offset];
 
-_Volume_BVH *_volume_build_bvh(_Volume_BVH_Element *p_elements, int p_size, int &count) {
-	_Volume_BVH *bvh = memnew(_Volume_BVH);
+	AABB aabb = elements[0].aabb;
+	AABB center_aabb(elements[0].center, Vector3());
+	for (uint32_t i = 1; i < p_size; i++) {
+		aabb.merge_with(elements[i].aabb);
+		center_aabb.expand_to(elements[i].center);
+	}
+	_quantize_aabb(aabb, bvh[node_index].min, bvh[node_index].max);
 
-	if (p_size == 1) {
+	if (p_size <= BVH_LEAF_SIZE) {
 		//leaf
-		bvh->aabb = p_elements[0].aabb;
-		bvh->left = nullptr;
-		bvh->right = nullptr;
-		bvh->face_index = p_elements->face_index;
-		count++;
-		return bvh;
-	} else {
-		bvh->face_index = -1;
+		bvh[node_index].index = p_offset;
+		bvh[node_index].face_count = p_size;
+		return node_index;
 	}
 
-	AABB aabb;
-	for (int i = 0; i < p_size; i++) {
-		if (i == 0) {
-			aabb = p_elements[i].aabb;
-		} else {
-			aabb.merge_with(p_elements[i].aabb);
-		}
-	}
-	bvh->aabb = aabb;
-	switch (aabb.get_longest_axis_index()) {
+	// Median split along the axis in which face centers are spread the most.
+	// Selecting the median is enough, no need to fully sort the elements.
+	uint32_t split = p_size / 2;
+	switch (center_aabb.get_longest_axis_index()) {
 		case 0: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareX> sort_x;
-			sort_x.sort(p_elements, p_size);
-
+			sort_x.nth_element(0, p_size, split, elements);
 		} break;
 		case 1: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareY> sort_y;
-			sort_y.sort(p_elements, p_size);
+			sort_y.nth_element(0, p_size, split, elements);
 		} break;
 		case 2: {
 			SortArray<_Volume_BVH_Element, _Volume_BVH_CompareZ> sort_z;
-			sort_z.sort(p_elements, p_size);
+			sort_z.nth_element(0, p_size, split, elements);
 		} break;
 	}
 
-	int split = p_size / 2;
-	bvh->left = _volume_build_bvh(p_elements, split, count);
-	bvh->right = _volume_build_bvh(&p_elements[split], p_size - split, count);
-
-	//printf("branch at %p - %i: %i\n",bvh,count,bvh->face_index);
-	count++;
-	return bvh;
-}
-
-void GodotConcavePolygonShape3D::_fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx) {
-	int idx = p_idx;
-
-	p_bvh_array[idx].aabb = p_bvh_tree->aabb;
-	p_bvh_array[idx].face_index = p_bvh_tree->face_index;
-	//printf("%p - %i: %i(%p)  -- %p:%p\n",%p_bvh_array[idx],p_idx,p_bvh_array[i]->face_index,&p_bvh_tree->face_index,p_bvh_tree->left,p_bvh_tree->right);
-
-	if (p_bvh_tree->left) {
-		p_bvh_array[idx].left = ++p_idx;
-		_fill_bvh(p_bvh_tree->left, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].left = -1;
-	}
-
-	if (p_bvh_tree->right) {
-		p_bvh_array[idx].right = ++p_idx;
-		_fill_bvh(p_bvh_tree->right, p_bvh_array, p_idx);
-
-	} else {
-		p_bvh_array[p_idx].right = -1;
-	}
+	_build_bvh(p_elements, p_offset, split);
+	uint32_t right = _build_bvh(p_elements, p_offset + split, p_size - split);
+	bvh[node_index].index = right;
 
-	memdelete(p_bvh_tree);
+	return node_index;
 }
 
 void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_backface_collision) {
+	faces.clear();
+	vertices.clear();
+	face_source_index.clear();
+	bvh.clear();
+
 	int src_face_count = p_faces.size();
 	if (src_face_count == 0) {
 		configure(AABB());
@@ -1605,26 +1621,47 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 
 	const Vector3 *facesr = p_faces.ptr();
 
-	Vector<_Volume_BVH_Element> bvh_array;
-	bvh_array.resize(src_face_count);
+	LocalVector<_Volume_BVH_Element> bvh_elements;
+	bvh_elements.resize(src_face_count);
+
+	AABB _aabb;
+
+	for (int i = 0; i < src_face_count; i++) {
+		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+
+		bvh_elements[i].aabb = face.get_aabb();
+		bvh_elements[i].center = bvh_elements[i].aabb.get_center();
+		bvh_elements[i].face_index = i;
+		if (i == 0) {
+			_aabb = bvh_elements[i].aabb;
+		} else {
+			_aabb.merge_with(bvh_elements[i].aabb);
+		}
+	}
+
+	bvh_origin = _aabb.position;
+	for (int i = 0; i < 3; i++) {
+		bvh_quantize_scale[i] = _aabb.size[i] > CMP_EPSILON ? 65535.0 / _aabb.size[i] : 0.0;
+		bvh_dequantize_scale[i] = _aabb.size[i] / 65535.0;
+	}
 
-	_Volume_BVH_Element *bvh_arrayw = bvh_array.ptrw();
+	// Two children per internal node, so at most twice as many nodes as leaves.
+	bvh.reserve(2 * (src_face_count / BVH_LEAF_SIZE + 1));
+	_build_bvh(bvh_elements.ptr(), 0, src_face_count);
 
+	// Store faces in leaf order.
 	faces.resize(src_face_count);
 	Face *facesw = faces.ptrw();
 
 	vertices.resize(src_face_count * 3);
-
 	Vector3 *verticesw = vertices.ptrw();
 
-	AABB _aabb;
+	face_source_index.resize(src_face_count);
 
 	for (int i = 0; i < src_face_count; i++) {
-		Face3 face(facesr[i * 3 + 0], facesr[i * 3 + 1], facesr[i * 3 + 2]);
+		int src_index = bvh_elements[i].face_index;
+		Face3 face(facesr[src_index * 3 + 0], facesr[src_index * 3 + 1], facesr[src_index * 3 + 2]);
 
-		bvh_arrayw[i].aabb = face.get_aabb();
-		bvh_arrayw[i].center = bvh_arrayw[i].aabb.get_center();
-		bvh_arrayw[i].face_index = i;
 		facesw[i].indices[0] = i * 3 + 0;
 		facesw[i].indices[1] = i * 3 + 1;
 		facesw[i].indices[2] = i * 3 + 2;
@@ -1632,23 +1669,9 @@ void GodotConcavePolygonShape3D::_setup(const Vector<Vector3> &p_faces, bool p_b
 		verticesw[i * 3 + 0] = face.vertex[0];
 		verticesw[i * 3 + 1] = face.vertex[1];
 		verticesw[i * 3 + 2] = face.vertex[2];
-		if (i == 0) {
-			_aabb = bvh_arrayw[i].aabb;
-		} else {
-			_aabb.merge_with(bvh_arrayw[i].aabb);
-		}
+		face_source_index[i] = src_index;
 	}
 
-	int count = 0;
-	_Volume_BVH *bvh_tree = _volume_build_bvh(bvh_arrayw, src_face_count, count);
-
-	bvh.resize(count + 1);
-
-	BVH *bvh_arrayw2 = bvh.ptrw();
-
-	int idx = 0;
-	_fill_bvh(bvh_tree, bvh_arrayw2, idx);
-
 	backface_collision = p_backface_collision;
 
 	configure(_aabb); // this type of shape has no margin
@@ -1754,39 +1777,39 @@ _FORCE_INLINE_ bool _heightmap_cell_cull_segment(_HeightmapSegmentCullParams &p_
 	return false;
 }
 
-_FORCE_INLINE_ bool _heightmap_chunk_cull_segment(_HeightmapSegmentCullParams &p_params, const _HeightmapGridCullState &p_state) {
-	const GodotHeightMapShape3D::Range &chunk = p_params.heightmap->_get_bounds_chunk(p_state.x, p_state.z);
+// Returns the range of the segment parameter (0 to 1) that lies within the AABB.
+_FORCE_INLINE_ bool _heightmap_clip_segment(const AABB &p_aabb, const Vector3 &p_from, const Vector3 &p_to, real_t &r_enter, real_t &r_exit) {
+	r_enter = 0.0;
+	r_exit = 1.0;
 
-	Vector3 enter_pos;
-	Vector3 exit_pos;
-
-	if (p_state.length_flat > CMP_EPSILON) {
-		real_t flat_to_3d = p_state.length / p_state.length_flat;
-		real_t enter_param = p_state.prev_dist * flat_to_3d;
-		real_t exit_param = p_state.dist * flat_to_3d;
-		enter_pos = p_params.from + p_params.dir * enter_param;
-		exit_pos = p_params.from + p_params.dir * exit_param;
-	} else {
-		// Consider the ray vertical.
-		// (though we shouldn't reach this often because there is an early check up-front)
-		enter_pos = p_params.from;
-		exit_pos = p_params.to;
-	}
+	for (int i = 0; i < 3; i++) {
+		real_t seg_from = p_from[i];
+		real_t seg_to = p_to[i];
+		real_t box_begin = p_aabb.position[i];
+		real_t box_end = box_begin + p_aabb.size[i];
+
+		if (Math::is_equal_approx(seg_from, seg_to)) {
+			if (seg_from < box_begin || seg_from > box_end) {
+				return false;
+			}
+			continue;
+		}
 
-	// Transform positions to heightmap space.
-	enter_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
-	exit_pos *= GodotHeightMapShape3D::BOUNDS_CHUNK_SIZE;
+		real_t inv_length = 1.0 / (seg_to - seg_from);
+		real_t t0 = (box_begin - seg_from) * inv_length;
+		real_t t1 = (box_end - seg_from) * inv_length;
+		if (t0 > t1) {
+			SWAP(t0, t1);
+		}
 
-	// We did enter the flat projection of the AABB,
-	// but we have to check if we intersect it on the vertical axis.
-	if ((enter_pos.y > chunk.max) && (exit_pos.y > chunk.max)) {
-		return false;
-	}
-	if ((enter_pos.y < chunk.min) && (exit_pos.y < chunk.min)) {
-		return false;
+		r_enter = MAX(r_enter, t0);
+		r_exit = MIN(r_exit, t1);
+		if (r_enter > r_exit) {
+			return false;
+		}
 	}
 
-	return p_params.heightmap->_intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, p_params.heightmap->width, p_params.heightmap->depth, p_params.heightmap->local_origin, p_params.result, p_params.normal);
+	return true;
 }
 
 template <typename ProcessFunction>
@@ -1930,6 +1953,56 @@ bool GodotHeightMapShape3D::_intersect_grid_segment(ProcessFunction &p_process,
 	return false;
 }
 
+bool GodotHeightMapShape3D::_intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const {
+	const BoundsLevel &level = bounds_levels[p_level];
+	const Range &range = _get_bounds_chunk(p_level, p_x, p_z);
+
+	int cell_begin_x = p_x * level.chunk_size;
+	int cell_begin_z = p_z * level.chunk_size;
+	int cell_end_x = MIN(cell_begin_x + level.chunk_size, width - 1);
+	int cell_end_z = MIN(cell_begin_z + level.chunk_size, depth - 1);
+
+	AABB chunk_aabb;
+	chunk_aabb.position = Vector3(cell_begin_x, range.min, cell_begin_z) - local_origin;
+	chunk_aabb.size = Vector3(cell_end_x - cell_begin_x, range.max - range.min, cell_end_z - cell_begin_z);
+
+	real_t enter_param;
+	real_t exit_param;
+	if (!_heightmap_clip_segment(chunk_aabb, p_begin, p_end, enter_param, exit_param)) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		// Walk the cells of this chunk only, slightly extending the clipped segment
+		// so faces lying on the chunk borders are not missed.
+		Vector3 delta = p_end - p_begin;
+		Vector3 enter_pos = p_begin + delta * MAX(enter_param - CMP_EPSILON, (real_t)0.0);
+		Vector3 exit_pos = p_begin + delta * MIN(exit_param + CMP_EPSILON, (real_t)1.0);
+		return _intersect_grid_segment(_heightmap_cell_cull_segment, enter_pos, exit_pos, width, depth, local_origin, r_point, r_normal);
+	}
+
+	// Visit children front to back, so the first hit found is the closest one.
+	// The segment is monotonic on both axes, so it can't cross the two diagonal children in the wrong order.
+	static const int child_order[4][2] = { { 0, 0 }, { 1, 0 }, { 0, 1 }, { 1, 1 } };
+	int flip_x = (p_end.x < p_begin.x) ? 1 : 0;
+	int flip_z = (p_end.z < p_begin.z) ? 1 : 0;
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int child_x = p_x * 2 + (child_order[i][0] ^ flip_x);
+		int child_z = p_z * 2 + (child_order[i][1] ^ flip_z);
+		if (child_x >= child_level.width || child_z >= child_level.depth) {
+			continue;
+		}
+
+		if (_intersect_bounds_segment(p_level - 1, child_x, child_z, p_begin, p_end, r_point, r_normal)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal, int &r_face_index, bool p_hit_back_faces) const {
 	if (heights.is_empty()) {
 		return false;
@@ -1966,7 +2039,7 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			r_normal = params.normal;
 			return true;
 		}
-	} else if (bounds_grid.is_empty()) {
+	} else if (bounds_levels.is_empty()) {
 		// Process all cells intersecting the flat projection of the ray.
 		return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 	} else {
@@ -1976,15 +2049,8 @@ bool GodotHeightMapShape3D::intersect_segment(const Vector3 &p_begin, const Vect
 			// Don't use chunks, the ray is too short in the plane.
 			return _intersect_grid_segment(_heightmap_cell_cull_segment, p_begin, p_end, width, depth, local_origin, r_point, r_normal);
 		} else {
-			// The ray is long, run raycast on a higher-level grid.
-			Vector3 bounds_from = p_begin / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_to = p_end / BOUNDS_CHUNK_SIZE;
-			Vector3 bounds_offset = local_origin / BOUNDS_CHUNK_SIZE;
-			// Plus 1 here to width and depth of the chunk because _intersect_grid_segment() is used by cell level as well,
-			// and in _intersect_grid_segment() the loop will exit 1 early because for cell point triangle lookup, it dose x + 1, z + 1 etc for the vertex.
-			int bounds_width = bounds_grid_width + 1;
-			int bounds_depth = bounds_grid_depth + 1;
-			return _intersect_grid_segment(_heightmap_chunk_cull_segment, bounds_from, bounds_to, bounds_width, bounds_depth, bounds_offset, r_point, r_normal);
+			// The ray is long, descend the min/max pyramid to only walk the cells of chunks it can hit.
+			return _intersect_bounds_segment(bounds_levels.size() - 1, 0, 0, p_begin, p_end, r_point, r_normal);
 		}
 	}
 
@@ -2012,6 +2078,81 @@ void GodotHeightMapShape3D::_get_cell(const Vector3 &p_point, int &r_x, int &r_y
 	r_z = (clamped_point.z < 0.0) ? (clamped_point.z - 0.5) : (clamped_point.z + 0.5);
 }
 
+bool GodotHeightMapShape3D::_cull_cell(int p_x, int p_z, const _CullParams &p_params) const {
+	GodotFaceShape3D *face = p_params.face;
+
+	// Both triangles of the cell lie within the height range of its corners.
+	real_t h00 = _get_height(p_x, p_z);
+	real_t h10 = _get_height(p_x + 1, p_z);
+	real_t h01 = _get_height(p_x, p_z + 1);
+	real_t h11 = _get_height(p_x + 1, p_z + 1);
+	if (MAX(MAX(h00, h10), MAX(h01, h11)) < p_params.min_y || MIN(MIN(h00, h10), MIN(h01, h11)) > p_params.max_y) {
+		return false;
+	}
+
+	// First triangle.
+	_get_point(p_x, p_z, face->vertex[0]);
+	_get_point(p_x + 1, p_z, face->vertex[1]);
+	_get_point(p_x, p_z + 1, face->vertex[2]);
+	face->normal = Plane(face->vertex[0], face->vertex[1], face->vertex[2]).normal;
+	if (p_params.callback(p_params.userdata, face)) {
+		return true;
+	}
+
+	// Second triangle.
+	face->vertex[0] = face->vertex[1];
+	_get_point(p_x + 1, p_z + 1, face->vertex[1]);
+	face->normal = Plane(face->vertex[0], face->vertex[1], face->vertex[2]).normal;
+	if (p_params.callback(p_params.userdata, face)) {
+		return true;
+	}
+
+	return false;
+}
+
+bool GodotHeightMapShape3D::_cull_bounds(int p_level, int p_x, int p_z, const _CullParams &p_params) const {
+	const BoundsLevel &level = bounds_levels[p_level];
+	const Range &range = _get_bounds_chunk(p_level, p_x, p_z);
+
+	if (range.max < p_params.min_y || range.min > p_params.max_y) {
+		return false;
+	}
+
+	int cell_begin_x = MAX(p_x * level.chunk_size, p_params.start_x);
+	int cell_begin_z = MAX(p_z * level.chunk_size, p_params.start_z);
+	int cell_end_x = MIN((p_x + 1) * level.chunk_size, p_params.end_x);
+	int cell_end_z = MIN((p_z + 1) * level.chunk_size, p_params.end_z);
+	if (cell_begin_x >= cell_end_x || cell_begin_z >= cell_end_z) {
+		return false;
+	}
+
+	if (p_level == 0) {
+		for (int z = cell_begin_z; z < cell_end_z; z++) {
+			for (int x = cell_begin_x; x < cell_end_x; x++) {
+				if (_cull_cell(x, z, p_params)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	const BoundsLevel &child_level = bounds_levels[p_level - 1];
+	for (int i = 0; i < 4; i++) {
+		int child_x = p_x * 2 + (i & 1);
+		int child_z = p_z * 2 + (i >> 1);
+		if (child_x >= child_level.width || child_z >= child_level.depth) {
+			continue;
+		}
+
+		if (_cull_bounds(p_level - 1, child_x, child_z, p_params)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
 void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callback, void *p_userdata, bool p_invert_backface_collision) const {
 	if (heights.is_empty()) {
 		return;
@@ -2042,22 +2183,25 @@ void GodotHeightMapShape3D::cull(const AABB &p_local_aabb, QueryCallback p_callb
 	face.backface_collision = !p_invert_backface_collision;
 	face.invert_backface_collision = p_invert_backface_collision;
 
+	_CullParams params;
+	params.start_x = start_x;
+	params.end_x = end_x;
+	params.start_z = start_z;
+	params.end_z = end_z;
+	params.min_y = local_aabb.position.y;
+	params.max_y = local_aabb.position.y + local_aabb.size.y;
+	params.callback = p_callback;
+	params.userdata = p_userdata;
+	params.face = &face;
+
+	if (!bounds_levels.is_empty()) {
+		_cull_bounds(bounds_levels.size() - 1, 0, 0, params);
+		return;
+	}
+
 	for (int z = start_z; z < end_z; z++) {
 		for (int x = start_x; x < end_x; x++) {
-			// First triangle.
-			_get_point(x, z, face.vertex[0]);
-			_get_point(x + 1, z, face.vertex[1]);
-			_get_point(x, z + 1, face.vertex[2]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
-				return;
-			}
-
-			// Second triangle.
-			face.vertex[0] = face.vertex[1];
-			_get_point(x + 1, z + 1, face.vertex[1]);
-			face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
-			if (p_callback(p_userdata, &face)) {
+			if (_cull_cell(x, z, params)) {
 				return;
 			}
 		}
@@ -2075,33 +2219,28 @@ Vector3 GodotHeightMapShape3D::get_moment_of_inertia(real_t p_mass) const {
 }
 
 void GodotHeightMapShape3D::_build_accelerator() {
-	bounds_grid.clear();
-
-	bounds_grid_width = width / BOUNDS_CHUNK_SIZE;
-	bounds_grid_depth = depth / BOUNDS_CHUNK_SIZE;
-
-	if (width % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_width; // In case terrain size isn't dividable by chunk size.
-	}
+	bounds_levels.clear();
 
-	if (depth % BOUNDS_CHUNK_SIZE > 0) {
-		++bounds_grid_depth;
-	}
+	int cells_width = width - 1;
+	int cells_depth = depth - 1;
 
-	uint32_t bound_grid_size = (uint32_t)(bounds_grid_width * bounds_grid_depth);
+	BoundsLevel base;
+	base.chunk_size = BOUNDS_CHUNK_SIZE;
+	base.width = (cells_width + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE; // In case terrain size isn't dividable by chunk size.
+	base.depth = (cells_depth + BOUNDS_CHUNK_SIZE - 1) / BOUNDS_CHUNK_SIZE;
 
-	if (bound_grid_size < 2) {
+	if (base.width * base.depth < 2) {
 		// Grid is empty or just one chunk.
 		return;
 	}
 
-	bounds_grid.resize(bound_grid_size);
+	base.ranges.resize(base.width * base.depth);
 
 	// Compute min and max height for all chunks.
-	for (int cz = 0; cz < bounds_grid_depth; ++cz) {
+	for (int cz = 0; cz < base.depth; ++cz) {
 		int z0 = cz * BOUNDS_CHUNK_SIZE;
 
-		for (int cx = 0; cx < bounds_grid_width; ++cx) {
+		for (int cx = 0; cx < base.width; ++cx) {
 			int x0 = cx * BOUNDS_CHUNK_SIZE;
 
 			Range r;
@@ -2138,8 +2277,40 @@ void GodotHeightMapShape3D::_build_accelerator() {
 				}
 			}
 
-			bounds_grid[cx + cz * bounds_grid_width] = r;
+			base.ranges[cx + cz * base.width] = r;
+		}
+	}
+
+	bounds_levels.push_back(base);
+
+	// Merge 2x2 chunks into the next level until a single root chunk covers the whole grid.
+	while (bounds_levels[bounds_levels.size() - 1].width > 1 || bounds_levels[bounds_levels.size() - 1].depth > 1) {
+		const BoundsLevel &prev = bounds_levels[bounds_levels.size() - 1];
+
+		BoundsLevel level;
+		level.chunk_size = prev.chunk_size * 2;
+		level.width = (prev.width + 1) / 2;
+		level.depth = (prev.depth + 1) / 2;
+		level.ranges.resize(level.width * level.depth);
+
+		for (int cz = 0; cz < level.depth; ++cz) {
+			for (int cx = 0; cx < level.width; ++cx) {
+				Range r = prev.ranges[(cz * 2) * prev.width + cx * 2];
+				for (int i = 1; i < 4; i++) {
+					int child_x = cx * 2 + (i & 1);
+					int child_z = cz * 2 + (i >> 1);
+					if (child_x >= prev.width || child_z >= prev.depth) {
+						continue;
+					}
+					const Range &child = prev.ranges[child_z * prev.width + child_x];
+					r.min = MIN(r.min, child.min);
+					r.max = MAX(r.max, child.max);
+				}
+				level.ranges[cz * level.width + cx] = r;
+			}
 		}
+
+		bounds_levels.push_back(level);
 	}
 }
 
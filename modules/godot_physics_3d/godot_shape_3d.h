@@ -301,7 +301,7 @@ public:
 	GodotConvexPolygonShape3D();
 };
 
-struct _Volume_BVH;
+struct _Volume_BVH_Element;
 struct GodotFaceShape3D;
 
 struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
@@ -312,26 +312,41 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		int indices[3] = {};
 	};
 
+	// Faces and vertices are stored in BVH leaf order, so the triangles of a leaf are contiguous in memory.
+	// face_source_index maps them back to the order they were provided in.
 	Vector<Face> faces;
 	Vector<Vector3> vertices;
+	LocalVector<int> face_source_index;
 
-	struct BVH {
-		AABB aabb;
-		int left = 0;
-		int right = 0;
+	// Maximum amount of faces stored in a single BVH leaf.
+	static const int BVH_LEAF_SIZE = 4;
+	// Upper bound for the BVH depth, median splits keep it below log2 of the face count.
+	static const int BVH_MAX_DEPTH = 64;
 
-		int face_index = 0;
+	// Flattened BVH in depth-first order: the first child of an internal node always directly follows it.
+	// Bounds are quantized to 16 bits per axis relative to the shape AABB, rounded outwards.
+	struct BVH {
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
+		// Index of the second child for internal nodes, first face for leaves.
+		uint32_t index = 0;
+		// Amount of faces for leaves, zero for internal nodes.
+		uint32_t face_count = 0;
 	};
 
-	Vector<BVH> bvh;
+	LocalVector<BVH> bvh;
+	Vector3 bvh_origin;
+	Vector3 bvh_quantize_scale;
+	Vector3 bvh_dequantize_scale;
 
 	struct _CullParams {
 		AABB aabb;
+		uint16_t min[3] = {};
+		uint16_t max[3] = {};
 		QueryCallback callback = nullptr;
 		void *userdata = nullptr;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
 		GodotFaceShape3D *face = nullptr;
 	};
 
@@ -341,7 +356,6 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 		Vector3 dir;
 		const Face *faces = nullptr;
 		const Vector3 *vertices = nullptr;
-		const BVH *bvh = nullptr;
 		GodotFaceShape3D *face = nullptr;
 
 		Vector3 result;
@@ -353,10 +367,18 @@ struct GodotConcavePolygonShape3D : public GodotConcaveShape3D {
 
 	bool backface_collision = false;
 
-	void _cull_segment(int p_idx, _SegmentCullParams *p_params) const;
-	bool _cull(int p_idx, _CullParams *p_params) const;
+	_FORCE_INLINE_ AABB _get_bvh_aabb(const BVH &p_node) const {
+		Vector3 min = bvh_origin + Vector3(p_node.min[0], p_node.min[1], p_node.min[2]) * bvh_dequantize_scale;
+		Vector3 max = bvh_origin + Vector3(p_node.max[0], p_node.max[1], p_node.max[2]) * bvh_dequantize_scale;
+		return AABB(min, max - min);
+	}
 
-	void _fill_bvh(_Volume_BVH *p_bvh_tree, BVH *p_bvh_array, int &p_idx);
+	void _quantize_aabb(const AABB &p_aabb, uint16_t r_min[3], uint16_t r_max[3]) const;
+
+	void _cull_segment_leaf(const BVH &p_node, _SegmentCullParams *p_params) const;
+	bool _cull_leaf(const BVH &p_node, _CullParams *p_params) const;
+
+	uint32_t _build_bvh(_Volume_BVH_Element *p_elements, uint32_t p_offset, uint32_t p_size);
 
 	void _setup(const Vector<Vector3> &p_faces, bool p_backface_collision);
 
@@ -388,19 +410,38 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 	int depth = 0;
 	Vector3 local_origin;
 
-	// Accelerator.
+	// Accelerator: min/max height pyramid over the cells of the grid.
+	// Level 0 holds the height range of each block of BOUNDS_CHUNK_SIZE x BOUNDS_CHUNK_SIZE cells,
+	// every following level merges 2x2 blocks of the previous one, up to a single root block.
 	struct Range {
 		real_t min = 0.0;
 		real_t max = 0.0;
 	};
-	LocalVector<Range> bounds_grid;
-	int bounds_grid_width = 0;
-	int bounds_grid_depth = 0;
+	struct BoundsLevel {
+		LocalVector<Range> ranges;
+		int width = 0;
+		int depth = 0;
+		int chunk_size = 0; // In cells.
+	};
+	LocalVector<BoundsLevel> bounds_levels;
 
-	static const int BOUNDS_CHUNK_SIZE = 16;
+	static const int BOUNDS_CHUNK_SIZE = 8;
 
-	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_x, int p_z) const {
-		return bounds_grid[(p_z * bounds_grid_width) + p_x];
+	struct _CullParams {
+		int start_x = 0;
+		int end_x = 0;
+		int start_z = 0;
+		int end_z = 0;
+		real_t min_y = 0.0;
+		real_t max_y = 0.0;
+		QueryCallback callback = nullptr;
+		void *userdata = nullptr;
+		GodotFaceShape3D *face = nullptr;
+	};
+
+	_FORCE_INLINE_ const Range &_get_bounds_chunk(int p_level, int p_x, int p_z) const {
+		const BoundsLevel &level = bounds_levels[p_level];
+		return level.ranges[(p_z * level.width) + p_x];
 	}
 
 	_FORCE_INLINE_ real_t _get_height(int p_x, int p_z) const {
@@ -419,6 +460,10 @@ struct GodotHeightMapShape3D : public GodotConcaveShape3D {
 
 	template <typename ProcessFunction>
 	bool _intersect_grid_segment(ProcessFunction &p_process, const Vector3 &p_begin, const Vector3 &p_end, int p_width, int p_depth, const Vector3 &offset, Vector3 &r_point, Vector3 &r_normal) const;
+	bool _intersect_bounds_segment(int p_level, int p_x, int p_z, const Vector3 &p_begin, const Vector3 &p_end, Vector3 &r_point, Vector3 &r_normal) const;
+
+	bool _cull_cell(int p_x, int p_z, const _CullParams &p_params) const;
+	bool _cull_bounds(int p_level, int p_x, int p_z, const _CullParams &p_params) const;
 
 	void _setup(const Vector<real_t> &p_heights, int p_width, int p_depth, real_t p_min_height, real_t p_max_height);
 
@@ -191,6 +191,10 @@ void GodotSoftBody3D::update_normals_and_centroids() {
 }
 
 void GodotSoftBody3D::update_bounds() {
+	update_bounds_shape(update_bounds_aabb());
+}
+
+bool GodotSoftBody3D::update_bounds_aabb() {
 	AABB prev_bounds = bounds;
 	prev_bounds.grow_by(collision_margin);
 
@@ -198,8 +202,7 @@ void GodotSoftBody3D::update_bounds() {
 
 	const uint32_t nodes_count = nodes.size();
 	if (nodes_count == 0) {
-		deinitialize_shape();
-		return;
+		return false;
 	}
 
 	bool first = true;
@@ -217,8 +220,17 @@ void GodotSoftBody3D::update_bounds() {
 		}
 	}
 
+	return moved;
+}
+
+void GodotSoftBody3D::update_bounds_shape(bool p_moved) {
+	if (nodes.is_empty()) {
+		deinitialize_shape();
+		return;
+	}
+
 	if (get_space()) {
-		initialize_shape(moved);
+		initialize_shape(p_moved);
 	}
 }
 
@@ -1044,8 +1056,9 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 		node.f = Vector3();
 	}
 
-	// Bounds and tree update.
-	update_bounds();
+	// Bounds update, the shape is updated in post_predict_motion().
+	pending_bounds_moved = update_bounds_aabb();
+	pending_bounds_update = true;
 
 	// Node tree update.
 	for (const Node &node : nodes) {
@@ -1066,6 +1079,13 @@ void GodotSoftBody3D::predict_motion(real_t p_delta) {
 	face_tree.optimize_incremental(1);
 }
 
+void GodotSoftBody3D::post_predict_motion() {
+	if (pending_bounds_update) {
+		update_bounds_shape(pending_bounds_moved);
+		pending_bounds_update = false;
+	}
+}
+
 void GodotSoftBody3D::solve_constraints(real_t p_delta) {
 	const real_t inv_delta = 1.0 / p_delta;
 
@@ -110,6 +110,10 @@ class GodotSoftBody3D : public GodotCollisionObject3D {
 
 	uint64_t island_step = 0;
 
+	// Set by predict_motion(), the shape is updated afterwards in post_predict_motion().
+	bool pending_bounds_update = false;
+	bool pending_bounds_moved = false;
+
 	_FORCE_INLINE_ Vector3 _compute_area_windforce(const GodotArea3D *p_area, const Face *p_face);
 
 public:
@@ -200,7 +204,10 @@ public:
 	void set_drag_coefficient(real_t p_val);
 	_FORCE_INLINE_ real_t get_drag_coefficient() const { return drag_coefficient; }
 
+	// Motion prediction and constraint solving only touch the soft body itself and can run on multiple threads.
+	// post_predict_motion() updates the collision shape in the broadphase, and must be called serially.
 	void predict_motion(real_t p_delta);
+	void post_predict_motion();
 	void solve_constraints(real_t p_delta);
 
 	_FORCE_INLINE_ uint32_t get_node_index(void *p_node) const { return static_cast<Node *>(p_node)->index; }
@@ -219,6 +226,8 @@ protected:
 private:
 	void update_normals_and_centroids();
 	void update_bounds();
+	bool update_bounds_aabb();
+	void update_bounds_shape(bool p_moved);
 	void update_constants();
 	void update_area();
 	void reset_link_rest_lengths();
@@ -34,8 +34,6 @@
 #include "godot_physics_server_3d.h"
 
 #include "core/config/project_settings.h"
-#include "godot_area_pair_3d.h"
-#include "godot_body_pair_3d.h"
 
 #define TEST_MOTION_MARGIN_MIN_VALUE 0.0001
 #define TEST_MOTION_MIN_CONTACT_DEPTH_FACTOR 0.05
@@ -1048,23 +1046,23 @@ void *GodotSpace3D::_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A
 		GodotArea3D *area = static_cast<GodotArea3D *>(A);
 		if (type_B == GodotCollisionObject3D::TYPE_AREA) {
 			GodotArea3D *area_b = static_cast<GodotArea3D *>(B);
-			GodotArea2Pair3D *area2_pair = memnew(GodotArea2Pair3D(area_b, p_subindex_B, area, p_subindex_A));
+			GodotArea2Pair3D *area2_pair = self->area2_pair_allocator.alloc(area_b, p_subindex_B, area, p_subindex_A);
 			return area2_pair;
 		} else if (type_B == GodotCollisionObject3D::TYPE_SOFT_BODY) {
 			GodotSoftBody3D *softbody = static_cast<GodotSoftBody3D *>(B);
-			GodotAreaSoftBodyPair3D *soft_area_pair = memnew(GodotAreaSoftBodyPair3D(softbody, p_subindex_B, area, p_subindex_A));
+			GodotAreaSoftBodyPair3D *soft_area_pair = self->area_soft_body_pair_allocator.alloc(softbody, p_subindex_B, area, p_subindex_A);
 			return soft_area_pair;
 		} else {
 			GodotBody3D *body = static_cast<GodotBody3D *>(B);
-			GodotAreaPair3D *area_pair = memnew(GodotAreaPair3D(body, p_subindex_B, area, p_subindex_A));
+			GodotAreaPair3D *area_pair = self->area_pair_allocator.alloc(body, p_subindex_B, area, p_subindex_A);
 			return area_pair;
 		}
 	} else if (type_A == GodotCollisionObject3D::TYPE_BODY) {
 		if (type_B == GodotCollisionObject3D::TYPE_SOFT_BODY) {
-			GodotBodySoftBodyPair3D *soft_pair = memnew(GodotBodySoftBodyPair3D(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotSoftBody3D *>(B)));
+			GodotBodySoftBodyPair3D *soft_pair = self->body_soft_body_pair_allocator.alloc(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotSoftBody3D *>(B));
 			return soft_pair;
 		} else {
-			GodotBodyPair3D *b = memnew(GodotBodyPair3D(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotBody3D *>(B), p_subindex_B));
+			GodotBodyPair3D *b = self->body_pair_allocator.alloc(static_cast<GodotBody3D *>(A), p_subindex_A, static_cast<GodotBody3D *>(B), p_subindex_B);
 			return b;
 		}
 	} else {
@@ -1081,8 +1079,29 @@ void GodotSpace3D::_broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_
 
 	GodotSpace3D *self = static_cast<GodotSpace3D *>(p_self);
 	self->collision_pairs--;
-	GodotConstraint3D *c = static_cast<GodotConstraint3D *>(p_data);
-	memdelete(c);
+
+	// Return the pair to the allocator it came from, types are ordered the same way as in _broadphase_pair().
+	GodotCollisionObject3D::Type type_A = A->get_type();
+	GodotCollisionObject3D::Type type_B = B->get_type();
+	if (type_A > type_B) {
+		SWAP(type_A, type_B);
+	}
+
+	if (type_A == GodotCollisionObject3D::TYPE_AREA) {
+		if (type_B == GodotCollisionObject3D::TYPE_AREA) {
+			self->area2_pair_allocator.free(static_cast<GodotArea2Pair3D *>(p_data));
+		} else if (type_B == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+			self->area_soft_body_pair_allocator.free(static_cast<GodotAreaSoftBodyPair3D *>(p_data));
+		} else {
+			self->area_pair_allocator.free(static_cast<GodotAreaPair3D *>(p_data));
+		}
+	} else if (type_A == GodotCollisionObject3D::TYPE_BODY) {
+		if (type_B == GodotCollisionObject3D::TYPE_SOFT_BODY) {
+			self->body_soft_body_pair_allocator.free(static_cast<GodotBodySoftBodyPair3D *>(p_data));
+		} else {
+			self->body_pair_allocator.free(static_cast<GodotBodyPair3D *>(p_data));
+		}
+	}
 }
 
 const SelfList<GodotBody3D>::List &GodotSpace3D::get_active_body_list() const {
@@ -31,11 +31,14 @@
 #pragma once
 
 #include "godot_area_3d.h"
+#include "godot_area_pair_3d.h"
 #include "godot_body_3d.h"
+#include "godot_body_pair_3d.h"
 #include "godot_broad_phase_3d.h"
 #include "godot_collision_object_3d.h"
 #include "godot_soft_body_3d.h"
 
+#include "core/templates/paged_allocator.h"
 #include "core/typedefs.h"
 
 class GodotPhysicsDirectSpaceState3D : public PhysicsDirectSpaceState3D {
@@ -84,6 +87,14 @@ private:
 	static void *_broadphase_pair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_self);
 	static void _broadphase_unpair(GodotCollisionObject3D *A, int p_subindex_A, GodotCollisionObject3D *B, int p_subindex_B, void *p_data, void *p_self);
 
+	// Pairs are created and destroyed every time two objects start or stop overlapping in the broadphase,
+	// allocate them on pages to avoid hitting the heap for each of them.
+	PagedAllocator<GodotBodyPair3D, false, 256> body_pair_allocator;
+	PagedAllocator<GodotBodySoftBodyPair3D, false, 32> body_soft_body_pair_allocator;
+	PagedAllocator<GodotAreaPair3D, false, 256> area_pair_allocator;
+	PagedAllocator<GodotArea2Pair3D, false, 64> area2_pair_allocator;
+	PagedAllocator<GodotAreaSoftBodyPair3D, false, 32> area_soft_body_pair_allocator;
+
 	HashSet<GodotCollisionObject3D *> objects;
 
 	GodotArea3D *area = nullptr;
@@ -112,6 +112,14 @@ void GodotStep3D::_populate_island_soft_body(GodotSoftBody3D *p_soft_body, Local
 	}
 }
 
+void GodotStep3D::_predict_soft_body_motion(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->predict_motion(delta);
+}
+
+void GodotStep3D::_solve_soft_body_constraints(uint32_t p_soft_body_index, void *p_userdata) {
+	active_soft_bodies[p_soft_body_index]->solve_constraints(delta);
+}
+
 void GodotStep3D::_setup_constraint(uint32_t p_constraint_index, void *p_userdata) {
 	GodotConstraint3D *constraint = all_constraints[p_constraint_index];
 	constraint->setup(delta);
@@ -212,11 +220,23 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY MOTION */
 
+	active_soft_bodies.clear();
+
 	const SelfList<GodotSoftBody3D> *sb = soft_body_list->first();
 	while (sb) {
-		sb->self()->predict_motion(p_delta);
+		active_soft_bodies.push_back(sb->self());
 		sb = sb->next();
-		active_count++;
+	}
+
+	uint32_t active_soft_body_count = active_soft_bodies.size();
+	active_count += active_soft_body_count;
+
+	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_predict_soft_body_motion, nullptr, active_soft_body_count, -1, true, SNAME("Physics3DSoftBodyPredictMotion"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+
+	// WARNING: Broadphase updates aren't thread-safe, so they are applied after motion prediction.
+	for (uint32_t soft_body_index = 0; soft_body_index < active_soft_body_count; ++soft_body_index) {
+		active_soft_bodies[soft_body_index]->post_predict_motion();
 	}
 
 	p_space->set_active_objects(active_count);
@@ -344,7 +364,7 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 	/* SETUP CONSTRAINTS / PROCESS COLLISIONS */
 
 	uint32_t total_constraint_count = all_constraints.size();
-	WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_setup_constraint, nullptr, total_constraint_count, -1, true, SNAME("Physics3DConstraintSetup"));
 	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
@@ -390,11 +410,8 @@ void GodotStep3D::step(GodotSpace3D *p_space, real_t p_delta) {
 
 	/* UPDATE SOFT BODY CONSTRAINTS */
 
-	sb = soft_body_list->first();
-	while (sb) {
-		sb->self()->solve_constraints(p_delta);
-		sb = sb->next();
-	}
+	group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &GodotStep3D::_solve_soft_body_constraints, nullptr, active_soft_bodies.size(), -1, true, SNAME("Physics3DSoftBodySolveConstraints"));
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 
 	{ //profile
 		profile_endtime = OS::get_singleton()->get_ticks_usec();
@@ -0,0 +1,137 @@
+/**************************************************************************/
+/*  test_godot_collision_solver_3d.h                                      */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_collision_solver_3d.h"
+#include "../godot_physics_server_3d.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotCollisionSolver3D {
+
+TEST_CASE("[GodotPhysics3D] Cast motion against thin walls") {
+	// A fast sphere moving along X, towards walls only 2 cm thick with their bottom edge above its center.
+	// A ray cast from the front of the sphere misses them, but the sphere itself doesn't.
+	GodotSphereShape3D sphere;
+	sphere.set_data(0.5);
+	const Transform3D sphere_xform;
+	const Vector3 motion(10, 0, 0);
+
+	// First contact happens once the sphere is 0.5 away from the edge at (4.99, 0.3).
+	const real_t expected_distance = 4.99 - Math::sqrt(0.25 - 0.09);
+
+	SUBCASE("Box wall") {
+		GodotBoxShape3D wall;
+		wall.set_data(Vector3(0.01, 1, 1));
+		const Transform3D wall_xform(Basis(), Vector3(5, 1.3, 0));
+
+		Vector3 result;
+		Vector3 normal;
+		int face_index = -1;
+		Transform3D wall_inv = wall_xform.affine_inverse();
+		CHECK_FALSE(wall.intersect_segment(wall_inv.xform(Vector3(0.5, 0, 0)), wall_inv.xform(Vector3(10.5, 0, 0)), result, normal, face_index, true));
+
+		real_t safe = 1.0;
+		real_t unsafe = 1.0;
+		CHECK(GodotCollisionSolver3D::cast_motion(&sphere, sphere_xform, motion, &wall, wall_xform, 0.01, safe, unsafe));
+		CHECK(safe <= unsafe);
+		CHECK(unsafe * motion.x == doctest::Approx(expected_distance).epsilon(0.005));
+
+		// Moving away from the wall, or passing above it, doesn't hit.
+		CHECK_FALSE(GodotCollisionSolver3D::cast_motion(&sphere, sphere_xform, -motion, &wall, wall_xform, 0.01, safe, unsafe));
+		CHECK_FALSE(GodotCollisionSolver3D::cast_motion(&sphere, sphere_xform, motion, &wall, wall_xform.translated(Vector3(0, 0.3, 0)), 0.01, safe, unsafe));
+	}
+
+	SUBCASE("Trimesh wall") {
+		Vector<Vector3> faces = {
+			Vector3(5, 0.3, -1), Vector3(5, 2, -1), Vector3(5, 2, 1),
+			Vector3(5, 0.3, -1), Vector3(5, 2, 1), Vector3(5, 0.3, 1)
+		};
+		GodotConcavePolygonShape3D wall;
+		Dictionary data;
+		data["faces"] = faces;
+		data["backface_collision"] = false;
+		wall.set_data(data);
+
+		real_t safe = 1.0;
+		real_t unsafe = 1.0;
+		CHECK(GodotCollisionSolver3D::cast_motion(&sphere, sphere_xform, motion, &wall, Transform3D(), 0.01, safe, unsafe));
+		CHECK(unsafe * motion.x == doctest::Approx(expected_distance + 0.01).epsilon(0.005));
+	}
+}
+
+TEST_CASE("[GodotPhysics3D] Continuous collision detection against a moving body") {
+	// A fast sphere and a thin wall moving towards each other, placed like in the test above so the support ray misses the wall.
+	// In one full step they would pass through each other.
+	// Tests without a scene tree have no physics server, and the bodies need the Godot Physics one anyway.
+	GodotPhysicsServer3D *physics_server = memnew(GodotPhysicsServer3D);
+	physics_server->init();
+	physics_server->set_active(true);
+	const real_t step = 1.0 / 60.0;
+
+	RID space = physics_server->space_create();
+	physics_server->space_set_active(space, true);
+
+	RID sphere = physics_server->sphere_shape_create();
+	physics_server->shape_set_data(sphere, 0.5);
+	RID sphere_body = physics_server->body_create();
+	physics_server->body_set_space(sphere_body, space);
+	physics_server->body_add_shape(sphere_body, sphere);
+	physics_server->body_set_param(sphere_body, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	physics_server->body_set_enable_continuous_collision_detection(sphere_body, true);
+	physics_server->body_set_state(sphere_body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(6, 0, 0) / step);
+
+	RID wall = physics_server->box_shape_create();
+	physics_server->shape_set_data(wall, Vector3(0.01, 1, 1));
+	RID wall_body = physics_server->body_create();
+	physics_server->body_set_space(wall_body, space);
+	physics_server->body_add_shape(wall_body, wall);
+	physics_server->body_set_param(wall_body, PhysicsServer3D::BODY_PARAM_GRAVITY_SCALE, 0.0);
+	physics_server->body_set_state(wall_body, PhysicsServer3D::BODY_STATE_TRANSFORM, Transform3D(Basis(), Vector3(5, 1.3, 0)));
+	physics_server->body_set_state(wall_body, PhysicsServer3D::BODY_STATE_LINEAR_VELOCITY, Vector3(-6, 0, 0) / step);
+
+	physics_server->step(step);
+
+	// The sphere is slowed down so it just reaches the wall instead of passing it.
+	const real_t sphere_x = Transform3D(physics_server->body_get_state(sphere_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x;
+	const real_t wall_x = Transform3D(physics_server->body_get_state(wall_body, PhysicsServer3D::BODY_STATE_TRANSFORM)).origin.x;
+	CHECK(wall_x - sphere_x == doctest::Approx(Math::sqrt(0.25 - 0.09)).epsilon(0.05));
+
+	physics_server->free(sphere_body);
+	physics_server->free(wall_body);
+	physics_server->free(sphere);
+	physics_server->free(wall);
+	physics_server->free(space);
+	physics_server->finish();
+	memdelete(physics_server);
+}
+
+} // namespace TestGodotCollisionSolver3D
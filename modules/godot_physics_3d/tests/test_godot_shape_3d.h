@@ -0,0 +1,201 @@
+/**************************************************************************/
+/*  test_godot_shape_3d.h                                                 */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "../godot_shape_3d.h"
+
+#include "core/math/random_pcg.h"
+
+#include "tests/test_macros.h"
+
+namespace TestGodotShape3D {
+
+static bool _count_faces(void *p_userdata, GodotShape3D *p_shape) {
+	(*(int *)p_userdata)++;
+	return false;
+}
+
+TEST_CASE("[GodotPhysics3D] ConcavePolygonShape3D matches brute force queries") {
+	RandomPCG rng(1234);
+
+	const int face_count = 500;
+	Vector<Vector3> faces;
+	faces.resize(face_count * 3);
+	for (int i = 0; i < face_count; i++) {
+		Vector3 center(rng.random(-20.0f, 20.0f), rng.random(-5.0f, 5.0f), rng.random(-20.0f, 20.0f));
+		for (int j = 0; j < 3; j++) {
+			faces.write[i * 3 + j] = center + Vector3(rng.random(-2.0f, 2.0f), rng.random(-2.0f, 2.0f), rng.random(-2.0f, 2.0f));
+		}
+	}
+
+	GodotConcavePolygonShape3D shape;
+	Dictionary data;
+	data["faces"] = faces;
+	data["backface_collision"] = true;
+	shape.set_data(data);
+
+	CHECK_MESSAGE(shape.get_faces() == faces, "Faces should be returned in their original order.");
+
+	GodotFaceShape3D face;
+	face.backface_collision = true;
+
+	for (int i = 0; i < 100; i++) {
+		Vector3 from(rng.random(-25.0f, 25.0f), rng.random(-8.0f, 8.0f), rng.random(-25.0f, 25.0f));
+		Vector3 to = from + Vector3(rng.random(-20.0f, 20.0f), rng.random(-10.0f, 10.0f), rng.random(-20.0f, 20.0f));
+		Vector3 dir = (to - from).normalized();
+
+		int expected_face = -1;
+		real_t expected_distance = 1e20;
+		for (int j = 0; j < face_count; j++) {
+			face.vertex[0] = faces[j * 3 + 0];
+			face.vertex[1] = faces[j * 3 + 1];
+			face.vertex[2] = faces[j * 3 + 2];
+			face.normal = Face3(face.vertex[0], face.vertex[1], face.vertex[2]).get_plane().normal;
+
+			Vector3 result;
+			Vector3 normal;
+			int face_index = -1;
+			if (face.intersect_segment(from, to, result, normal, face_index, true)) {
+				real_t distance = dir.dot(result - from);
+				if (distance > 0 && distance < expected_distance) {
+					expected_distance = distance;
+					expected_face = j;
+				}
+			}
+		}
+
+		Vector3 result;
+		Vector3 normal;
+		int face_index = -1;
+		bool hit = shape.intersect_segment(from, to, result, normal, face_index, true);
+		CHECK(hit == (expected_face >= 0));
+		if (hit) {
+			CHECK(face_index == expected_face);
+		}
+
+		AABB query(from, Vector3(3, 2, 3));
+		int expected_count = 0;
+		for (int j = 0; j < face_count; j++) {
+			if (query.intersects(Face3(faces[j * 3 + 0], faces[j * 3 + 1], faces[j * 3 + 2]).get_aabb())) {
+				expected_count++;
+			}
+		}
+
+		int count = 0;
+		shape.cull(query, _count_faces, &count, false);
+		CHECK(count == expected_count);
+	}
+}
+
+TEST_CASE("[GodotPhysics3D] HeightMapShape3D matches brute force queries") {
+	RandomPCG rng(4321);
+
+	const int width = 53;
+	const int depth = 41;
+	Vector<real_t> heights;
+	heights.resize(width * depth);
+	for (int z = 0; z < depth; z++) {
+		for (int x = 0; x < width; x++) {
+			heights.write[z * width + x] = Math::sin(x * 0.2) * 4.0 + Math::cos(z * 0.3) * 3.0 + rng.random(-0.5f, 0.5f);
+		}
+	}
+
+	GodotHeightMapShape3D shape;
+	Dictionary data;
+	data["width"] = width;
+	data["depth"] = depth;
+	data["heights"] = heights;
+	data["min_height"] = -8.0;
+	data["max_height"] = 8.0;
+	shape.set_data(data);
+
+	GodotFaceShape3D face;
+	face.backface_collision = false;
+
+	for (int i = 0; i < 100; i++) {
+		// Long rays, going through the min/max height pyramid.
+		Vector3 from(rng.random(-30.0f, 30.0f), rng.random(0.0f, 15.0f), rng.random(-25.0f, 25.0f));
+		Vector3 to = from + Vector3(rng.random(-40.0f, 40.0f), rng.random(-20.0f, 0.0f), rng.random(-40.0f, 40.0f));
+		Vector3 dir = (to - from).normalized();
+
+		bool expected_hit = false;
+		Vector3 expected_result;
+		real_t expected_distance = 1e20;
+		for (int z = 0; z < depth - 1; z++) {
+			for (int x = 0; x < width - 1; x++) {
+				for (int t = 0; t < 2; t++) {
+					if (t == 0) {
+						shape._get_point(x, z, face.vertex[0]);
+						shape._get_point(x + 1, z, face.vertex[1]);
+						shape._get_point(x, z + 1, face.vertex[2]);
+					} else {
+						shape._get_point(x + 1, z, face.vertex[0]);
+						shape._get_point(x + 1, z + 1, face.vertex[1]);
+						shape._get_point(x, z + 1, face.vertex[2]);
+					}
+					face.normal = Plane(face.vertex[0], face.vertex[1], face.vertex[2]).normal;
+
+					Vector3 result;
+					Vector3 normal;
+					int face_index = -1;
+					if (face.intersect_segment(from, to, result, normal, face_index, false)) {
+						real_t distance = dir.dot(result - from);
+						if (distance < expected_distance) {
+							expected_hit = true;
+							expected_distance = distance;
+							expected_result = result;
+						}
+					}
+				}
+			}
+		}
+
+		Vector3 result;
+		Vector3 normal;
+		int face_index = -1;
+		bool hit = shape.intersect_segment(from, to, result, normal, face_index, false);
+		CHECK(hit == expected_hit);
+		if (hit && expected_hit) {
+			CHECK(result.distance_to(expected_result) < 0.001);
+		}
+	}
+
+	// Queries above or below the terrain should not return any face.
+	int count = 0;
+	shape.cull(AABB(Vector3(-5, 20, -5), Vector3(10, 2, 10)), _count_faces, &count, false);
+	CHECK(count == 0);
+	shape.cull(AABB(Vector3(-5, -20, -5), Vector3(10, 2, 10)), _count_faces, &count, false);
+	CHECK(count == 0);
+	shape.cull(AABB(Vector3(-5, -8, -5), Vector3(10, 16, 10)), _count_faces, &count, false);
+	CHECK(count > 0);
+}
+
+} // namespace TestGodotShape3D
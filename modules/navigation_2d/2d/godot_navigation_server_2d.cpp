@@ -139,6 +139,26 @@ void GodotNavigationServer2D::bake_from_source_geometry_data_async(const Ref<Nav
 #endif // CLIPPER2_ENABLED
 }
 
+void GodotNavigationServer2D::rebake_tiles_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation polygon.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData2D.");
+
+#ifdef CLIPPER2_ENABLED
+	ERR_FAIL_NULL(NavMeshGenerator2D::get_singleton());
+	NavMeshGenerator2D::get_singleton()->rebake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_rect, p_callback);
+#endif // CLIPPER2_ENABLED
+}
+
+void GodotNavigationServer2D::rebake_tiles_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation polygon.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData2D.");
+
+#ifdef CLIPPER2_ENABLED
+	ERR_FAIL_NULL(NavMeshGenerator2D::get_singleton());
+	NavMeshGenerator2D::get_singleton()->rebake_tiles_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_dirty_rect, p_callback);
+#endif // CLIPPER2_ENABLED
+}
+
 bool GodotNavigationServer2D::is_baking_navigation_polygon(Ref<NavigationPolygon> p_navigation_polygon) const {
 #ifdef CLIPPER2_ENABLED
 	return NavMeshGenerator2D::get_singleton()->is_baking(p_navigation_polygon);
@@ -339,6 +359,19 @@ bool GodotNavigationServer2D::map_get_use_async_iterations(RID p_map) const {
 	return map->get_use_async_iterations();
 }
 
+COMMAND_2(map_set_path_cache_size, RID, p_map, int, p_size) {
+	NavMap2D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+	map->set_path_cache_size(p_size);
+}
+
+int GodotNavigationServer2D::map_get_path_cache_size(RID p_map) const {
+	const NavMap2D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_path_cache_size();
+}
+
 COMMAND_2(map_set_cell_size, RID, p_map, real_t, p_cell_size) {
 	NavMap2D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL(map);
@@ -420,6 +453,13 @@ Vector<Vector2> GodotNavigationServer2D::map_get_path(RID p_map, Vector2 p_origi
 	return query_result->get_path();
 }
 
+Vector2 GodotNavigationServer2D::map_get_flow_field_next_position(RID p_map, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance) {
+	NavMap2D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, p_origin);
+
+	return map->get_flow_field_next_position(p_origin, p_destination, p_navigation_layers, p_desired_distance);
+}
+
 Vector2 GodotNavigationServer2D::map_get_closest_point(RID p_map, const Vector2 &p_point) const {
 	const NavMap2D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector2());
@@ -1302,12 +1342,16 @@ void GodotNavigationServer2D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_iteration_build_usec = 0;
+	int _new_pm_path_cache_hit_count = 0;
+	int _new_pm_path_cache_miss_count = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
 		active_maps[i]->sync();
 		active_maps[i]->step(p_delta_time);
 		active_maps[i]->dispatch_callbacks();
+		active_maps[i]->process_path_query_queue();
 
 		_new_pm_region_count += active_maps[i]->get_pm_region_count();
 		_new_pm_agent_count += active_maps[i]->get_pm_agent_count();
@@ -1318,6 +1362,9 @@ void GodotNavigationServer2D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_iteration_build_usec += active_maps[i]->get_pm_iteration_build_usec();
+		_new_pm_path_cache_hit_count += active_maps[i]->get_pm_path_cache_hit_count();
+		_new_pm_path_cache_miss_count += active_maps[i]->get_pm_path_cache_miss_count();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1329,6 +1376,9 @@ void GodotNavigationServer2D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_iteration_build_usec = _new_pm_iteration_build_usec;
+	pm_path_cache_hit_count = _new_pm_path_cache_hit_count;
+	pm_path_cache_miss_count = _new_pm_path_cache_miss_count;
 }
 
 void GodotNavigationServer2D::set_active(bool p_active) {
@@ -1347,6 +1397,16 @@ void GodotNavigationServer2D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries2D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer2D::query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMap2D *map = map_owner.get_or_null(p_query_parameters->get_map());
+	ERR_FAIL_NULL(map);
+
+	NavMeshQueries2D::map_query_path_async(map, p_query_parameters, p_query_result, p_callback);
+}
+
 RID GodotNavigationServer2D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1403,6 +1463,15 @@ int GodotNavigationServer2D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_ITERATION_BUILD_TIME: {
+			return pm_iteration_build_usec;
+		} break;
+		case INFO_PATH_CACHE_HIT_COUNT: {
+			return pm_path_cache_hit_count;
+		} break;
+		case INFO_PATH_CACHE_MISS_COUNT: {
+			return pm_path_cache_miss_count;
+		} break;
 	}
 
 	return 0;
@@ -99,6 +99,9 @@ class GodotNavigationServer2D : public NavigationServer2D {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_iteration_build_usec = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
 
 public:
 	GodotNavigationServer2D();
@@ -125,6 +128,7 @@ public:
 	virtual real_t map_get_link_connection_radius(RID p_map) const override;
 
 	virtual Vector<Vector2> map_get_path(RID p_map, Vector2 p_origin, Vector2 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) override;
+	virtual Vector2 map_get_flow_field_next_position(RID p_map, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers = 1, real_t p_desired_distance = 1.0) override;
 
 	virtual Vector2 map_get_closest_point(RID p_map, const Vector2 &p_point) const override;
 
@@ -141,6 +145,9 @@ public:
 	COMMAND_2(map_set_use_async_iterations, RID, p_map, bool, p_enabled);
 	virtual bool map_get_use_async_iterations(RID p_map) const override;
 
+	COMMAND_2(map_set_path_cache_size, RID, p_map, int, p_size);
+	virtual int map_get_path_cache_size(RID p_map) const override;
+
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const override;
 
 	virtual RID region_create() override;
@@ -315,6 +322,7 @@ public:
 	virtual uint32_t obstacle_get_avoidance_layers(RID p_obstacle) const override;
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override;
 
 	COMMAND_1(free, RID, p_object);
 
@@ -333,6 +341,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) override;
+	virtual void rebake_tiles_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) override;
+	virtual void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) override;
 	virtual bool is_baking_navigation_polygon(Ref<NavigationPolygon> p_navigation_polygon) const override;
 
 	virtual RID source_geometry_parser_create() override;
@@ -0,0 +1,198 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_2d.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "nav_avoidance_grid_2d.h"
+
+#include "../nav_agent_2d.h"
+
+void NavAvoidanceGrid2D::build(const LocalVector<NavAgent2D *> &p_agents) {
+	const uint32_t agent_count = p_agents.size();
+	if (agent_count == 0) {
+		agents.clear();
+		return;
+	}
+
+	float neighbor_distance_sum = 0.0;
+	Rect2 bounds(Vector2(p_agents[0]->get_rvo_agent()->position_.x(), p_agents[0]->get_rvo_agent()->position_.y()), Vector2());
+	for (NavAgent2D *agent : p_agents) {
+		const RVO2D::Agent2D *rvo_agent = agent->get_rvo_agent();
+		neighbor_distance_sum += rvo_agent->neighborDist_;
+		bounds.expand_to(Vector2(rvo_agent->position_.x(), rvo_agent->position_.y()));
+	}
+
+	// Cells are sized to hold a few agents when the agents are dense so the
+	// queries fill up their neighbors from the nearest cells, and are never
+	// larger than the neighbor distance so sparse queries stay local.
+	const float neighbor_distance = neighbor_distance_sum / agent_count;
+	const float area = MAX(float(bounds.size.x), neighbor_distance) * MAX(float(bounds.size.y), neighbor_distance);
+	const float dense_cell_size = Math::sqrt(area * AGENTS_PER_CELL / agent_count);
+	cell_size = MAX(CLAMP(dense_cell_size, neighbor_distance * 0.1f, neighbor_distance), 0.1f);
+
+	const uint32_t bucket_count = next_power_of_2(agent_count);
+	bucket_mask = bucket_count - 1;
+	bucket_offsets.resize(bucket_count + 1);
+	for (uint32_t &offset : bucket_offsets) {
+		offset = 0;
+	}
+
+	agent_cells.resize(agent_count);
+	agent_slots.resize(agent_count);
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO2D::Vector2 &position = p_agents[i]->get_rvo_agent()->position_;
+		agent_cells[i] = _get_cell(position.x(), position.y());
+		agent_slots[i] = _get_bucket(agent_cells[i]);
+		bucket_offsets[agent_slots[i]]++;
+	}
+
+	for (uint32_t i = 1; i < bucket_count; i++) {
+		bucket_offsets[i] += bucket_offsets[i - 1];
+	}
+
+	// Walking backwards turns the bucket ends into bucket starts and keeps the
+	// agents of a bucket in their original order.
+	for (uint32_t i = agent_count; i-- > 0;) {
+		agent_slots[i] = --bucket_offsets[agent_slots[i]];
+	}
+	bucket_offsets[bucket_count] = agent_count;
+
+	agents.resize(agent_count);
+	cells.resize(agent_count);
+	positions_x.resize(agent_count);
+	positions_y.resize(agent_count);
+	elevations.resize(agent_count);
+	heights.resize(agent_count);
+	priorities.resize(agent_count);
+	avoidance_layers.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		RVO2D::Agent2D *rvo_agent = p_agents[i]->get_rvo_agent();
+		const uint32_t slot = agent_slots[i];
+		agents[slot] = rvo_agent;
+		cells[slot] = agent_cells[i];
+		positions_x[slot] = rvo_agent->position_.x();
+		positions_y[slot] = rvo_agent->position_.y();
+		elevations[slot] = rvo_agent->elevation_;
+		heights[slot] = rvo_agent->height_;
+		priorities[slot] = rvo_agent->avoidance_priority_;
+		avoidance_layers[slot] = rvo_agent->avoidance_layers_;
+	}
+}
+
+float NavAvoidanceGrid2D::_get_cell_distance_sq(const Vector2i &p_cell, float p_x, float p_y) const {
+	const float dx = MAX(MAX(p_cell.x * cell_size - p_x, p_x - (p_cell.x + 1) * cell_size), 0.0f);
+	const float dy = MAX(MAX(p_cell.y * cell_size - p_y, p_y - (p_cell.y + 1) * cell_size), 0.0f);
+	return dx * dx + dy * dy;
+}
+
+void NavAvoidanceGrid2D::_query_agents(RVO2D::Agent2D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector2i *p_cell, float &r_range_sq) const {
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	std::vector<std::pair<float, const RVO2D::Agent2D *>> &neighbors = p_agent->agentNeighbors_;
+
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		const float dx = positions_x[i] - x;
+		const float dy = positions_y[i] - y;
+		const float distance_sq = dx * dx + dy * dy;
+		// Buckets can hold agents of other cells that share the same hash.
+		if (distance_sq >= r_range_sq || (p_cell && cells[i] != *p_cell)) {
+			continue;
+		}
+
+		// Same filtering as Agent2D::insertAgentNeighbor().
+		if (agents[i] == p_agent || (p_agent->avoidance_mask_ & avoidance_layers[i]) == 0) {
+			continue;
+		}
+		if (p_agent->elevation_ > elevations[i] + heights[i] || p_agent->elevation_ + p_agent->height_ < elevations[i]) {
+			continue;
+		}
+		if (p_agent->avoidance_priority_ > priorities[i]) {
+			continue;
+		}
+
+		// Same sorted insertion as Agent2D::insertAgentNeighbor().
+		if (neighbors.size() < p_agent->maxNeighbors_) {
+			neighbors.push_back(std::make_pair(distance_sq, agents[i]));
+		}
+
+		size_t j = neighbors.size() - 1;
+		while (j != 0 && distance_sq < neighbors[j - 1].first) {
+			neighbors[j] = neighbors[j - 1];
+			--j;
+		}
+		neighbors[j] = std::make_pair(distance_sq, agents[i]);
+
+		if (neighbors.size() == p_agent->maxNeighbors_) {
+			r_range_sq = neighbors.back().first;
+		}
+	}
+}
+
+void NavAvoidanceGrid2D::compute_agent_neighbors(RVO2D::Agent2D *p_agent) const {
+	p_agent->agentNeighbors_.clear();
+
+	if (p_agent->maxNeighbors_ == 0 || agents.is_empty()) {
+		return;
+	}
+
+	const float range = p_agent->neighborDist_;
+	float range_sq = range * range;
+
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	const Vector2i center = _get_cell(x, y);
+	const int64_t ring_count = int64_t(Math::ceil(range / cell_size));
+
+	if ((2 * ring_count + 1) * (2 * ring_count + 1) >= int64_t(agents.size())) {
+		// Looking up that many cells costs more than testing every agent.
+		_query_agents(p_agent, 0, agents.size(), nullptr, range_sq);
+		return;
+	}
+
+	// Visit the cells ring by ring around the agent so the closest agents are
+	// found first and the shrinking range can skip the outer rings.
+	for (int32_t ring = 0; ring <= ring_count; ring++) {
+		const float ring_distance = (ring - 1) * cell_size;
+		if (ring > 1 && ring_distance * ring_distance >= range_sq) {
+			break;
+		}
+		for (int32_t offset_y = -ring; offset_y <= ring; offset_y++) {
+			const int32_t step_x = (offset_y == -ring || offset_y == ring) ? 1 : 2 * ring;
+			for (int32_t offset_x = -ring; offset_x <= ring; offset_x += step_x) {
+				const Vector2i cell(center.x + offset_x, center.y + offset_y);
+				if (_get_cell_distance_sq(cell, x, y) >= range_sq) {
+					continue;
+				}
+				const uint32_t bucket = _get_bucket(cell);
+				_query_agents(p_agent, bucket_offsets[bucket], bucket_offsets[bucket + 1], &cell, range_sq);
+			}
+		}
+	}
+}
@@ -0,0 +1,85 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_2d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/math/rect2.h"
+#include "core/math/vector2i.h"
+#include "core/templates/local_vector.h"
+
+#include <Agent2d.h>
+
+class NavAgent2D;
+
+// Uniform grid used to find the agent neighbors of the avoidance agents.
+// The agents are bucketed by their grid cell with a counting sort and their
+// avoidance data is copied into flat arrays in bucket order, so a neighbor
+// query reads a few contiguous ranges instead of walking a tree of agents.
+class NavAvoidanceGrid2D {
+	static constexpr float AGENTS_PER_CELL = 8.0;
+
+	float cell_size = 1.0;
+	uint32_t bucket_mask = 0;
+
+	// Start of each bucket in the sorted arrays, with the agent count appended.
+	LocalVector<uint32_t> bucket_offsets;
+
+	LocalVector<RVO2D::Agent2D *> agents;
+	LocalVector<Vector2i> cells;
+	LocalVector<float> positions_x;
+	LocalVector<float> positions_y;
+	LocalVector<float> elevations;
+	LocalVector<float> heights;
+	LocalVector<float> priorities;
+	LocalVector<uint32_t> avoidance_layers;
+
+	// Scratch data of the last build, in agent order.
+	LocalVector<Vector2i> agent_cells;
+	LocalVector<uint32_t> agent_slots;
+
+	_FORCE_INLINE_ Vector2i _get_cell(float p_x, float p_y) const {
+		return Vector2i(int32_t(Math::floor(p_x / cell_size)), int32_t(Math::floor(p_y / cell_size)));
+	}
+	_FORCE_INLINE_ uint32_t _get_bucket(const Vector2i &p_cell) const {
+		return ((uint32_t(p_cell.x) * 73856093u) ^ (uint32_t(p_cell.y) * 19349663u)) & bucket_mask;
+	}
+
+	float _get_cell_distance_sq(const Vector2i &p_cell, float p_x, float p_y) const;
+
+	void _query_agents(RVO2D::Agent2D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector2i *p_cell, float &r_range_sq) const;
+
+public:
+	void build(const LocalVector<NavAgent2D *> &p_agents);
+
+	// Replace the agent neighbors of the agent like Agent2D::computeNeighbors().
+	// Safe to call from multiple threads for different agents once built.
+	void compute_agent_neighbors(RVO2D::Agent2D *p_agent) const;
+};
@@ -37,8 +37,97 @@
 #include "nav_map_iteration_2d.h"
 #include "nav_region_iteration_2d.h"
 
+#include "core/os/os.h"
+#include "core/templates/sort_array.h"
+
 using namespace Nav2D;
 
+// Polygons per polygon BVH leaf.
+constexpr uint32_t POLYGON_BVH_LEAF_SIZE = 4;
+// Polygon bounds are slightly enlarged so that rounding errors in the query distance computations
+// can't make a polygon appear closer than the node that contains it.
+constexpr real_t POLYGON_BVH_MARGIN = 0.001;
+// Polygons per cluster in the coarse graph searched by hierarchical path queries.
+constexpr uint32_t POLYGON_CLUSTER_SIZE = 64;
+
+struct PolygonBVHElement {
+	Rect2 rect;
+	Vector2 center;
+	const Polygon *polygon = nullptr;
+};
+
+struct FreeEdgeBounds {
+	Rect2 rect;
+	uint32_t index = 0;
+};
+
+struct FreeEdgeBoundsCompare {
+	_FORCE_INLINE_ bool operator()(const FreeEdgeBounds &p_a, const FreeEdgeBounds &p_b) const {
+		return p_a.rect.position.x < p_b.rect.position.x;
+	}
+};
+
+struct PolygonBVHElementCompare {
+	Vector2::Axis axis = Vector2::AXIS_X;
+
+	_FORCE_INLINE_ bool operator()(const PolygonBVHElement &p_a, const PolygonBVHElement &p_b) const {
+		return p_a.center[axis] < p_b.center[axis];
+	}
+};
+
+static uint32_t _build_polygon_bvh_node(LocalVector<PolygonBVHNode> &r_bvh, PolygonBVHElement *p_elements, uint32_t p_offset, uint32_t p_size) {
+	uint32_t node_index = r_bvh.size();
+	r_bvh.push_back(PolygonBVHNode());
+
+	PolygonBVHElement *elements = &p_elements[p_offset];
+
+	Rect2 rect = elements[0].rect;
+	Rect2 center_rect(elements[0].center, Vector2());
+	for (uint32_t i = 1; i < p_size; i++) {
+		rect = rect.merge(elements[i].rect);
+		center_rect.expand_to(elements[i].center);
+	}
+	r_bvh[node_index].rect = rect;
+
+	if (p_size <= POLYGON_BVH_LEAF_SIZE) {
+		r_bvh[node_index].index = p_offset;
+		r_bvh[node_index].polygon_count = p_size;
+		return node_index;
+	}
+
+	// Median split along the axis in which polygon centers are spread the most.
+	uint32_t split = p_size / 2;
+	SortArray<PolygonBVHElement, PolygonBVHElementCompare> sorter;
+	sorter.compare.axis = center_rect.size.max_axis_index();
+	sorter.nth_element(0, p_size, split, elements);
+
+	_build_polygon_bvh_node(r_bvh, p_elements, p_offset, split);
+	uint32_t right = _build_polygon_bvh_node(r_bvh, p_elements, p_offset + split, p_size - split);
+	r_bvh[node_index].index = right;
+
+	return node_index;
+}
+
+static Vector2 _get_polygon_center(const Polygon &p_polygon) {
+	Vector2 center;
+	for (const Vector2 &vertex : p_polygon.vertices) {
+		center += vertex;
+	}
+	return center / p_polygon.vertices.size();
+}
+
+static void _gather_polygon_cluster_links(const Polygon &p_polygon, const LocalVector<uint32_t> &p_polygon_clusters, LocalVector<uint64_t> &r_cluster_links) {
+	const uint32_t cluster_id = p_polygon_clusters[p_polygon.id];
+	for (const Edge &edge : p_polygon.edges) {
+		for (const Edge::Connection &connection : edge.connections) {
+			const uint32_t neighbor_cluster_id = p_polygon_clusters[connection.polygon->id];
+			if (neighbor_cluster_id != cluster_id && neighbor_cluster_id != UINT32_MAX) {
+				r_cluster_links.push_back(((uint64_t)cluster_id << 32) | neighbor_cluster_id);
+			}
+		}
+	}
+}
+
 PointKey NavMapBuilder2D::get_point_key(const Vector2 &p_pos, const Vector2 &p_cell_size) {
 	const int x = static_cast<int>(Math::floor(p_pos.x / p_cell_size.x));
 	const int y = static_cast<int>(Math::floor(p_pos.y / p_cell_size.y));
@@ -50,9 +139,55 @@ PointKey NavMapBuilder2D::get_point_key(const Vector2 &p_pos, const Vector2 &p_c
 	return p;
 }
 
+void NavMapBuilder2D::build_region_edges(const LocalVector<Polygon> &p_polygons, const Vector2 &p_cell_size, LocalVector<RegionEdgeConnectionPair> &r_edge_connection_pairs, LocalVector<RegionEdge> &r_free_edges) {
+	r_edge_connection_pairs.clear();
+	r_free_edges.clear();
+
+	// Index of the first edge found for each key, until a second edge merges with it.
+	HashMap<EdgeKey, uint32_t, EdgeKey> first_edges;
+	LocalVector<RegionEdge> edges;
+
+	for (uint32_t polygon_index = 0; polygon_index < p_polygons.size(); polygon_index++) {
+		const Polygon &polygon = p_polygons[polygon_index];
+		for (uint32_t p = 0; p < polygon.vertices.size(); p++) {
+			const int next_point = (p + 1) % polygon.vertices.size();
+
+			RegionEdge region_edge;
+			region_edge.key = EdgeKey(get_point_key(polygon.vertices[p], p_cell_size), get_point_key(polygon.vertices[next_point], p_cell_size));
+			region_edge.polygon = polygon_index;
+			region_edge.edge = p;
+
+			HashMap<EdgeKey, uint32_t, EdgeKey>::Iterator first_edge_it = first_edges.find(region_edge.key);
+			if (!first_edge_it) {
+				first_edges.insert(region_edge.key, edges.size());
+				edges.push_back(region_edge);
+			} else if (first_edge_it->value != UINT32_MAX) {
+				RegionEdgeConnectionPair pair;
+				pair.edges[0] = edges[first_edge_it->value];
+				pair.edges[1] = region_edge;
+				r_edge_connection_pairs.push_back(pair);
+
+				edges[first_edge_it->value].polygon = UINT32_MAX;
+				first_edge_it->value = UINT32_MAX;
+			} else {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/2d/merge_rasterizer_cell_scale' to 0.001.");
+			}
+		}
+	}
+
+	for (const RegionEdge &region_edge : edges) {
+		if (region_edge.polygon != UINT32_MAX) {
+			r_free_edges.push_back(region_edge);
+		}
+	}
+}
+
 void NavMapBuilder2D::build_navmap_iteration(NavMapIterationBuild2D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 
+	const uint64_t build_start_usec = OS::get_singleton()->get_ticks_usec();
+
 	performance_data.pm_polygon_count = 0;
 	performance_data.pm_edge_count = 0;
 	performance_data.pm_edge_merge_count = 0;
@@ -61,6 +196,8 @@ void NavMapBuilder2D::build_navmap_iteration(NavMapIterationBuild2D &r_build) {
 
 	_build_step_gather_region_polygons(r_build);
 
+	_build_step_polygon_bvh(r_build);
+
 	_build_step_find_edge_connection_pairs(r_build);
 
 	_build_step_merge_edge_connection_pairs(r_build);
@@ -69,7 +206,11 @@ void NavMapBuilder2D::build_navmap_iteration(NavMapIterationBuild2D &r_build) {
 
 	_build_step_navlink_connections(r_build);
 
+	_build_step_polygon_clusters(r_build);
+
 	_build_update_map_iteration(r_build);
+
+	performance_data.pm_iteration_build_usec = OS::get_singleton()->get_ticks_usec() - build_start_usec;
 }
 
 void NavMapBuilder2D::_build_step_gather_region_polygons(NavMapIterationBuild2D &r_build) {
@@ -102,16 +243,69 @@ void NavMapBuilder2D::_build_step_gather_region_polygons(NavMapIterationBuild2D
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder2D::_build_step_polygon_bvh(NavMapIterationBuild2D &r_build) {
+	NavMapIteration2D *map_iteration = r_build.map_iteration;
+
+	LocalVector<PolygonBVHNode> &bvh = map_iteration->polygon_bvh;
+	LocalVector<const Polygon *> &bvh_polygons = map_iteration->polygon_bvh_polygons;
+
+	bvh.clear();
+	bvh_polygons.clear();
+
+	LocalVector<PolygonBVHElement> elements;
+	elements.reserve(r_build.polygon_count);
+
+	for (const NavRegionIteration2D &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const Polygon &polygon : region.navmesh_polygons) {
+			if (polygon.vertices.is_empty()) {
+				continue;
+			}
+			PolygonBVHElement element;
+			element.rect.position = polygon.vertices[0];
+			for (uint32_t i = 1; i < polygon.vertices.size(); i++) {
+				element.rect.expand_to(polygon.vertices[i]);
+			}
+			element.rect.grow_by(POLYGON_BVH_MARGIN);
+			element.center = element.rect.get_center();
+			element.polygon = &polygon;
+			elements.push_back(element);
+		}
+	}
+
+	if (elements.is_empty()) {
+		return;
+	}
+
+	// Leaves hold at least two polygons, so there are fewer nodes than polygons.
+	bvh.reserve(elements.size());
+	_build_polygon_bvh_node(bvh, elements.ptr(), 0, elements.size());
+
+	bvh_polygons.resize(elements.size());
+	for (uint32_t i = 0; i < elements.size(); i++) {
+		bvh_polygons[i] = elements[i].polygon;
+	}
+}
+
 void NavMapBuilder2D::_build_step_find_edge_connection_pairs(NavMapIterationBuild2D &r_build) {
 	PerformanceData &performance_data = r_build.performance_data;
 	NavMapIteration2D *map_iteration = r_build.map_iteration;
-	int polygon_count = r_build.polygon_count;
-	const Vector2 merge_rasterizer_cell_size = r_build.merge_rasterizer_cell_size;
 	HashMap<EdgeKey, EdgeConnectionPair, EdgeKey> &connection_pairs_map = r_build.iter_connection_pairs_map;
 
-	// Group all edges per key.
+	// Group the free edges of the regions per key.
+	// The edges merged within a region were already paired when the region polygons were updated.
+	int region_free_edge_count = 0;
+	for (const NavRegionIteration2D &region : map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		region_free_edge_count += region.free_edges.size();
+	}
+
 	connection_pairs_map.clear();
-	connection_pairs_map.reserve(polygon_count);
+	connection_pairs_map.reserve(region_free_edge_count);
 	int free_edges_count = 0; // How many ConnectionPairs have only one Connection.
 
 	for (NavRegionIteration2D &region : map_iteration->region_iterations) {
@@ -119,36 +313,37 @@ void NavMapBuilder2D::_build_step_find_edge_connection_pairs(NavMapIterationBuil
 			continue;
 		}
 
-		for (Polygon &poly : region.navmesh_polygons) {
-			for (uint32_t p = 0; p < poly.vertices.size(); p++) {
-				const int next_point = (p + 1) % poly.vertices.size();
-				const EdgeKey ek(get_point_key(poly.vertices[p], merge_rasterizer_cell_size), get_point_key(poly.vertices[next_point], merge_rasterizer_cell_size));
+		performance_data.pm_edge_count += region.edge_connection_pairs.size();
 
-				HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(ek);
-				if (!pair_it) {
-					pair_it = connection_pairs_map.insert(ek, EdgeConnectionPair());
-					performance_data.pm_edge_count += 1;
-					++free_edges_count;
-				}
-				EdgeConnectionPair &pair = pair_it->value;
-				if (pair.size < 2) {
-					// Add the polygon/edge tuple to this key.
-					Edge::Connection new_connection;
-					new_connection.polygon = &poly;
-					new_connection.edge = p;
-					new_connection.pathway_start = poly.vertices[p];
-					new_connection.pathway_end = poly.vertices[next_point];
-
-					pair.connections[pair.size] = new_connection;
-					++pair.size;
-					if (pair.size == 2) {
-						--free_edges_count;
-					}
+		for (const RegionEdge &region_edge : region.free_edges) {
+			Polygon &poly = region.navmesh_polygons[region_edge.polygon];
+			const uint32_t p = region_edge.edge;
+			const int next_point = (p + 1) % poly.vertices.size();
 
-				} else {
-					// The edge is already connected with another edge, skip.
-					ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/3d/merge_rasterizer_cell_scale' to 0.001.");
+			HashMap<EdgeKey, EdgeConnectionPair, EdgeKey>::Iterator pair_it = connection_pairs_map.find(region_edge.key);
+			if (!pair_it) {
+				pair_it = connection_pairs_map.insert(region_edge.key, EdgeConnectionPair());
+				performance_data.pm_edge_count += 1;
+				++free_edges_count;
+			}
+			EdgeConnectionPair &pair = pair_it->value;
+			if (pair.size < 2) {
+				// Add the polygon/edge tuple to this key.
+				Edge::Connection new_connection;
+				new_connection.polygon = &poly;
+				new_connection.edge = p;
+				new_connection.pathway_start = poly.vertices[p];
+				new_connection.pathway_end = poly.vertices[next_point];
+
+				pair.connections[pair.size] = new_connection;
+				++pair.size;
+				if (pair.size == 2) {
+					--free_edges_count;
 				}
+
+			} else {
+				// The edge is already connected with another edge, skip.
+				ERR_PRINT_ONCE("Navigation map synchronization error. Attempted to merge a navigation mesh polygon edge with another already-merged edge. This is usually caused by crossing edges, overlapping polygons, or a mismatch of the NavigationMesh / NavigationPolygon baked 'cell_size' and navigation map 'cell_size'. If you're certain none of above is the case, change 'navigation/2d/merge_rasterizer_cell_scale' to 0.001.");
 			}
 		}
 	}
@@ -167,6 +362,28 @@ void NavMapBuilder2D::_build_step_merge_edge_connection_pairs(NavMapIterationBui
 	free_edges.clear();
 	free_edges.reserve(free_edges_count);
 
+	// Connect the edges that were merged within the regions.
+	for (NavRegionIteration2D &region : r_build.map_iteration->region_iterations) {
+		if (!region.get_enabled()) {
+			continue;
+		}
+		for (const RegionEdgeConnectionPair &region_pair : region.edge_connection_pairs) {
+			Edge::Connection connections[2];
+			for (int i = 0; i < 2; i++) {
+				Polygon &polygon = region.navmesh_polygons[region_pair.edges[i].polygon];
+				const uint32_t edge = region_pair.edges[i].edge;
+				connections[i].polygon = &polygon;
+				connections[i].edge = edge;
+				connections[i].pathway_start = polygon.vertices[edge];
+				connections[i].pathway_end = polygon.vertices[(edge + 1) % polygon.vertices.size()];
+			}
+			connections[0].polygon->edges[connections[0].edge].connections.push_back(connections[1]);
+			connections[1].polygon->edges[connections[1].edge].connections.push_back(connections[0]);
+			performance_data.pm_edge_merge_count += 1;
+		}
+	}
+
+	// Connect the free edges of different regions that share the same key.
 	for (const KeyValue<EdgeKey, EdgeConnectionPair> &pair_it : connection_pairs_map) {
 		const EdgeConnectionPair &pair = pair_it.value;
 		if (pair.size == 2) {
@@ -205,61 +422,83 @@ void NavMapBuilder2D::_build_step_edge_connection_margin_connections(NavMapItera
 
 	const real_t edge_connection_margin_squared = edge_connection_margin * edge_connection_margin;
 
+	// Edges can only connect when their bounds, grown by the margin, overlap.
+	// Sweep the bounds sorted along the x axis to find those candidates instead of testing every pair of free edges.
+	LocalVector<FreeEdgeBounds> edge_bounds;
+	edge_bounds.resize(free_edges.size());
 	for (uint32_t i = 0; i < free_edges.size(); i++) {
 		const Edge::Connection &free_edge = free_edges[i];
-		Vector2 edge_p1 = free_edge.polygon->vertices[free_edge.edge];
-		Vector2 edge_p2 = free_edge.polygon->vertices[(free_edge.edge + 1) % free_edge.polygon->vertices.size()];
-
-		for (uint32_t j = 0; j < free_edges.size(); j++) {
-			const Edge::Connection &other_edge = free_edges[j];
-			if (i == j || free_edge.polygon->owner == other_edge.polygon->owner) {
+		edge_bounds[i].rect.position = free_edge.polygon->vertices[free_edge.edge];
+		edge_bounds[i].rect.expand_to(free_edge.polygon->vertices[(free_edge.edge + 1) % free_edge.polygon->vertices.size()]);
+		edge_bounds[i].rect.grow_by(edge_connection_margin);
+		edge_bounds[i].index = i;
+	}
+	edge_bounds.sort_custom<FreeEdgeBoundsCompare>();
+
+	// Candidate (edge, other edge) pairs, sorted so that connections are added in the same order as a test of every pair would.
+	LocalVector<uint64_t> candidate_pairs;
+	for (uint32_t i = 0; i < edge_bounds.size(); i++) {
+		const FreeEdgeBounds &bounds = edge_bounds[i];
+		const real_t end_x = bounds.rect.position.x + bounds.rect.size.x;
+		for (uint32_t j = i + 1; j < edge_bounds.size() && edge_bounds[j].rect.position.x <= end_x; j++) {
+			const FreeEdgeBounds &other_bounds = edge_bounds[j];
+			if (free_edges[bounds.index].polygon->owner == free_edges[other_bounds.index].polygon->owner || !bounds.rect.intersects(other_bounds.rect, true)) {
 				continue;
 			}
+			candidate_pairs.push_back(((uint64_t)bounds.index << 32) | other_bounds.index);
+			candidate_pairs.push_back(((uint64_t)other_bounds.index << 32) | bounds.index);
+		}
+	}
+	candidate_pairs.sort();
 
-			Vector2 other_edge_p1 = other_edge.polygon->vertices[other_edge.edge];
-			Vector2 other_edge_p2 = other_edge.polygon->vertices[(other_edge.edge + 1) % other_edge.polygon->vertices.size()];
-
-			// Compute the projection of the opposite edge on the current one.
-			Vector2 edge_vector = edge_p2 - edge_p1;
-			real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / edge_vector.length_squared();
-			real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / edge_vector.length_squared();
-			if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
-				continue;
-			}
+	for (const uint64_t candidate_pair : candidate_pairs) {
+		const Edge::Connection &free_edge = free_edges[candidate_pair >> 32];
+		const Edge::Connection &other_edge = free_edges[candidate_pair & UINT32_MAX];
+		Vector2 edge_p1 = free_edge.polygon->vertices[free_edge.edge];
+		Vector2 edge_p2 = free_edge.polygon->vertices[(free_edge.edge + 1) % free_edge.polygon->vertices.size()];
+		Vector2 other_edge_p1 = other_edge.polygon->vertices[other_edge.edge];
+		Vector2 other_edge_p2 = other_edge.polygon->vertices[(other_edge.edge + 1) % other_edge.polygon->vertices.size()];
+
+		// Compute the projection of the opposite edge on the current one.
+		Vector2 edge_vector = edge_p2 - edge_p1;
+		real_t projected_p1_ratio = edge_vector.dot(other_edge_p1 - edge_p1) / edge_vector.length_squared();
+		real_t projected_p2_ratio = edge_vector.dot(other_edge_p2 - edge_p1) / edge_vector.length_squared();
+		if ((projected_p1_ratio < 0.0 && projected_p2_ratio < 0.0) || (projected_p1_ratio > 1.0 && projected_p2_ratio > 1.0)) {
+			continue;
+		}
 
-			// Check if the two edges are close to each other enough and compute a pathway between the two regions.
-			Vector2 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
-			Vector2 other1;
-			if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
-				other1 = other_edge_p1;
-			} else {
-				other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other1.distance_squared_to(self1) > edge_connection_margin_squared) {
-				continue;
-			}
+		// Check if the two edges are close to each other enough and compute a pathway between the two regions.
+		Vector2 self1 = edge_vector * CLAMP(projected_p1_ratio, 0.0, 1.0) + edge_p1;
+		Vector2 other1;
+		if (projected_p1_ratio >= 0.0 && projected_p1_ratio <= 1.0) {
+			other1 = other_edge_p1;
+		} else {
+			other1 = other_edge_p1.lerp(other_edge_p2, (1.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+		}
+		if (other1.distance_squared_to(self1) > edge_connection_margin_squared) {
+			continue;
+		}
 
-			Vector2 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
-			Vector2 other2;
-			if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
-				other2 = other_edge_p2;
-			} else {
-				other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
-			}
-			if (other2.distance_squared_to(self2) > edge_connection_margin_squared) {
-				continue;
-			}
+		Vector2 self2 = edge_vector * CLAMP(projected_p2_ratio, 0.0, 1.0) + edge_p1;
+		Vector2 other2;
+		if (projected_p2_ratio >= 0.0 && projected_p2_ratio <= 1.0) {
+			other2 = other_edge_p2;
+		} else {
+			other2 = other_edge_p1.lerp(other_edge_p2, (0.0 - projected_p1_ratio) / (projected_p2_ratio - projected_p1_ratio));
+		}
+		if (other2.distance_squared_to(self2) > edge_connection_margin_squared) {
+			continue;
+		}
 
-			// The edges can now be connected.
-			Edge::Connection new_connection = other_edge;
-			new_connection.pathway_start = (self1 + other1) / 2.0;
-			new_connection.pathway_end = (self2 + other2) / 2.0;
-			free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
+		// The edges can now be connected.
+		Edge::Connection new_connection = other_edge;
+		new_connection.pathway_start = (self1 + other1) / 2.0;
+		new_connection.pathway_end = (self2 + other2) / 2.0;
+		free_edge.polygon->edges[free_edge.edge].connections.push_back(new_connection);
 
-			// Add the connection to the region_connection map.
-			region_external_connections[(uint32_t)free_edge.polygon->owner->id].push_back(new_connection);
-			performance_data.pm_edge_connection_count += 1;
-		}
+		// Add the connection to the region_connection map.
+		region_external_connections[(uint32_t)free_edge.polygon->owner->id].push_back(new_connection);
+		performance_data.pm_edge_connection_count += 1;
 	}
 }
 
@@ -386,6 +625,102 @@ void NavMapBuilder2D::_build_step_navlink_connections(NavMapIterationBuild2D &r_
 	r_build.polygon_count = polygon_count;
 }
 
+void NavMapBuilder2D::_build_step_polygon_clusters(NavMapIterationBuild2D &r_build) {
+	NavMapIteration2D *map_iteration = r_build.map_iteration;
+
+	const LocalVector<const Polygon *> &bvh_polygons = map_iteration->polygon_bvh_polygons;
+	LocalVector<uint32_t> &polygon_clusters = map_iteration->polygon_clusters;
+	LocalVector<PolygonCluster> &clusters = map_iteration->clusters;
+	LocalVector<uint32_t> &cluster_neighbors = map_iteration->cluster_neighbors;
+
+	polygon_clusters.resize(r_build.polygon_count);
+	for (uint32_t &cluster_id : polygon_clusters) {
+		cluster_id = UINT32_MAX;
+	}
+	clusters.clear();
+	cluster_neighbors.clear();
+
+	// The polygon BVH stores nearby polygons next to each other, so consecutive runs of its polygons are compact.
+	// Each run is split into its connected parts, so that any polygon of a cluster can reach the others without leaving it.
+	LocalVector<uint32_t> polygon_runs;
+	polygon_runs.resize(r_build.polygon_count);
+	for (uint32_t &run : polygon_runs) {
+		run = UINT32_MAX;
+	}
+	for (uint32_t i = 0; i < bvh_polygons.size(); i++) {
+		polygon_runs[bvh_polygons[i]->id] = i / POLYGON_CLUSTER_SIZE;
+	}
+
+	LocalVector<const Polygon *> cluster_stack;
+	for (uint32_t i = 0; i < bvh_polygons.size(); i++) {
+		if (polygon_clusters[bvh_polygons[i]->id] != UINT32_MAX) {
+			continue;
+		}
+
+		const uint32_t run = i / POLYGON_CLUSTER_SIZE;
+		const uint32_t cluster_id = clusters.size();
+		uint32_t cluster_polygon_count = 0;
+		Vector2 center;
+
+		polygon_clusters[bvh_polygons[i]->id] = cluster_id;
+		cluster_stack.push_back(bvh_polygons[i]);
+		while (!cluster_stack.is_empty()) {
+			const Polygon *polygon = cluster_stack[cluster_stack.size() - 1];
+			cluster_stack.resize(cluster_stack.size() - 1);
+			center += _get_polygon_center(*polygon);
+			cluster_polygon_count++;
+
+			for (const Edge &edge : polygon->edges) {
+				for (const Edge::Connection &connection : edge.connections) {
+					const uint32_t neighbor_id = connection.polygon->id;
+					if (polygon_clusters[neighbor_id] == UINT32_MAX && polygon_runs[neighbor_id] == run) {
+						polygon_clusters[neighbor_id] = cluster_id;
+						cluster_stack.push_back(connection.polygon);
+					}
+				}
+			}
+		}
+
+		PolygonCluster cluster;
+		cluster.center = center / cluster_polygon_count;
+		clusters.push_back(cluster);
+	}
+
+	// Each link polygon is a cluster of its own, so that links don't stretch the clusters they connect.
+	for (const NavLinkIteration2D &link : map_iteration->link_iterations) {
+		for (const Polygon &polygon : link.navmesh_polygons) {
+			polygon_clusters[polygon.id] = clusters.size();
+			PolygonCluster cluster;
+			cluster.center = _get_polygon_center(polygon);
+			clusters.push_back(cluster);
+		}
+	}
+
+	LocalVector<uint64_t> cluster_links;
+	for (const Polygon *polygon : bvh_polygons) {
+		_gather_polygon_cluster_links(*polygon, polygon_clusters, cluster_links);
+	}
+	for (const NavLinkIteration2D &link : map_iteration->link_iterations) {
+		for (const Polygon &polygon : link.navmesh_polygons) {
+			_gather_polygon_cluster_links(polygon, polygon_clusters, cluster_links);
+		}
+	}
+	cluster_links.sort();
+
+	// Store the neighbors of each cluster as a contiguous range, the links are sorted by cluster.
+	for (uint32_t i = 0; i < cluster_links.size(); i++) {
+		if (i > 0 && cluster_links[i] == cluster_links[i - 1]) {
+			continue;
+		}
+		PolygonCluster &cluster = clusters[cluster_links[i] >> 32];
+		if (cluster.neighbor_count == 0) {
+			cluster.neighbor_index = cluster_neighbors.size();
+		}
+		cluster.neighbor_count++;
+		cluster_neighbors.push_back(cluster_links[i] & UINT32_MAX);
+	}
+}
+
 void NavMapBuilder2D::_build_update_map_iteration(NavMapIterationBuild2D &r_build) {
 	NavMapIteration2D *map_iteration = r_build.map_iteration;
 
@@ -397,6 +732,21 @@ void NavMapBuilder2D::_build_update_map_iteration(NavMapIterationBuild2D &r_buil
 		p_path_query_slot.traversable_polys.reserve(map_iteration->navmesh_polygon_count * 0.25);
 		p_path_query_slot.path_corridor.clear();
 		p_path_query_slot.path_corridor.resize(map_iteration->navmesh_polygon_count);
+		for (NavigationPoly &polygon : p_path_query_slot.path_corridor) {
+			polygon.reset();
+		}
+		p_path_query_slot.path_corridor_touched.clear();
+		p_path_query_slot.traversable_clusters.clear();
+		p_path_query_slot.cluster_corridor.clear();
+		p_path_query_slot.cluster_corridor.resize(map_iteration->clusters.size());
+		p_path_query_slot.cluster_corridor_pass = 0;
 	}
 	map_iteration->path_query_slots_mutex.unlock();
+
+	// Flow fields and path corridors of the previous build point to polygons that no longer exist.
+	map_iteration->clear_flow_fields();
+
+	map_iteration->path_corridor_cache_mutex.lock();
+	map_iteration->path_corridor_cache.clear();
+	map_iteration->path_corridor_cache_mutex.unlock();
 }
@@ -43,7 +43,6 @@ struct NavRegionIteration2D;
 struct NavMapIteration2D;
 
 struct NavMapIterationBuild2D {
-	Vector2 merge_rasterizer_cell_size;
 	bool use_edge_connections = true;
 	real_t edge_connection_margin;
 	real_t link_connection_radius;
@@ -84,9 +83,40 @@ struct NavMapIteration2D {
 
 	HashMap<NavRegion2D *, uint32_t> region_ptr_to_region_id;
 
+	// The spatial index over all region polygons, used by the closest point and path queries.
+	LocalVector<Nav2D::PolygonBVHNode> polygon_bvh;
+	LocalVector<const Nav2D::Polygon *> polygon_bvh_polygons;
+
+	// The coarse graph of polygon clusters searched by hierarchical path queries.
+	// Polygons that belong to no cluster are mapped to UINT32_MAX.
+	LocalVector<uint32_t> polygon_clusters;
+	LocalVector<Nav2D::PolygonCluster> clusters;
+	LocalVector<uint32_t> cluster_neighbors;
+
+	// The flow fields built for this iteration, shared with the queries that use them.
+	// Looked up under the read lock, the fields are built outside of it.
+	HashMap<Nav2D::FlowFieldKey, Nav2D::FlowField *, Nav2D::FlowFieldKey> flow_fields;
+	SafeNumeric<uint64_t> flow_fields_pass;
+	RWLock flow_fields_rwlock;
+
+	// The path corridors of recent path queries, reused by queries between the same polygons.
+	mutable HashMap<Nav2D::PathCorridorKey, Nav2D::PathCorridorCacheEntry, Nav2D::PathCorridorKey> path_corridor_cache;
+	mutable uint64_t path_corridor_cache_pass = 0;
+	mutable Mutex path_corridor_cache_mutex;
+
 	LocalVector<NavMeshQueries2D::PathQuerySlot> path_query_slots;
 	Mutex path_query_slots_mutex;
 	Semaphore path_query_slots_semaphore;
+
+	void clear_flow_fields() {
+		RWLockWrite write_lock(flow_fields_rwlock);
+		for (KeyValue<Nav2D::FlowFieldKey, Nav2D::FlowField *> &E : flow_fields) {
+			if (E.value->refcount.unref()) {
+				memdelete(E.value);
+			}
+		}
+		flow_fields.clear();
+	}
 };
 
 class NavMapIterationRead2D {
@@ -210,6 +210,68 @@ void NavMeshGenerator2D::bake_from_source_geometry_data_async(Ref<NavigationPoly
 	generator_tasks.insert(generator_task->thread_task_id, generator_task);
 }
 
+void NavMeshGenerator2D::rebake_tiles_from_source_geometry_data(Ref<NavigationPolygon> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND(p_source_geometry_data.is_null());
+
+	if (p_navigation_mesh->get_tile_size() <= 0.0 || (p_navigation_mesh->get_outline_count() == 0 && !p_source_geometry_data->has_data())) {
+		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		return;
+	}
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationPolygon is already baking. Wait for current bake to finish.");
+	}
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.insert(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, &p_dirty_rect);
+
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.erase(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	if (p_callback.is_valid()) {
+		generator_emit_callback(p_callback);
+	}
+
+	p_navigation_mesh->emit_changed();
+}
+
+void NavMeshGenerator2D::rebake_tiles_from_source_geometry_data_async(Ref<NavigationPolygon> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND(p_source_geometry_data.is_null());
+
+	if (p_navigation_mesh->get_tile_size() <= 0.0 || (p_navigation_mesh->get_outline_count() == 0 && !p_source_geometry_data->has_data())) {
+		bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
+		return;
+	}
+
+	if (!use_threads) {
+		rebake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_rect, p_callback);
+		return;
+	}
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationPolygon is already baking. Wait for current bake to finish.");
+	}
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.insert(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	MutexLock generator_task_lock(generator_task_mutex);
+	NavMeshGeneratorTask2D *generator_task = memnew(NavMeshGeneratorTask2D);
+	generator_task->navigation_mesh = p_navigation_mesh;
+	generator_task->source_geometry_data = p_source_geometry_data;
+	generator_task->callback = p_callback;
+	generator_task->rebake_tiles = true;
+	generator_task->rebake_rect = p_dirty_rect;
+	generator_task->status = NavMeshGeneratorTask2D::TaskStatus::BAKING_STARTED;
+	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator2D::generator_thread_bake, generator_task, NavMeshGenerator2D::baking_use_high_priority_threads, "NavMeshGeneratorBake2D");
+	generator_tasks.insert(generator_task->thread_task_id, generator_task);
+}
+
 bool NavMeshGenerator2D::is_baking(Ref<NavigationPolygon> p_navigation_polygon) {
 	MutexLock baking_navmesh_lock(baking_navmesh_mutex);
 	return baking_navmeshes.has(p_navigation_polygon);
@@ -218,7 +280,7 @@ bool NavMeshGenerator2D::is_baking(Ref<NavigationPolygon> p_navigation_polygon)
 void NavMeshGenerator2D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask2D *generator_task = static_cast<NavMeshGeneratorTask2D *>(p_arg);
 
-	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data);
+	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data, generator_task->rebake_tiles ? &generator_task->rebake_rect : nullptr);
 
 	generator_task->status = NavMeshGeneratorTask2D::TaskStatus::BAKING_FINISHED;
 }
@@ -306,95 +368,34 @@ bool NavMeshGenerator2D::generator_emit_callback(const Callable &p_callback) {
 	return ce.error == Callable::CallError::CALL_OK;
 }
 
-void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<NavigationPolygon> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data) {
-	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
-		return;
-	}
-
+struct NavMeshGeneratorTile2D {
+	Rect2 bake_rect;
+	Rect2 clip_rect;
+	Vector<Vector2> vertices;
+	Vector<Vector<int>> polygons;
+	bool failed = false;
+};
+
+struct NavMeshGeneratorTiledBake2D {
+	Ref<NavigationPolygon> navigation_mesh;
+	const Clipper2Lib::PathsD *traversable_polygon_paths = nullptr;
+	const Clipper2Lib::PathsD *obstruction_polygon_paths = nullptr;
+	const Clipper2Lib::PathsD *carve_polygon_paths = nullptr;
+	LocalVector<NavMeshGeneratorTile2D> tiles;
+};
+
+// Bakes the source paths inside the optional clip rect and cuts the result down to the optional bake rect.
+static bool generator_bake_polygon_paths(const Ref<NavigationPolygon> &p_navigation_mesh, const Clipper2Lib::PathsD &p_traversable_polygon_paths, const Clipper2Lib::PathsD &p_obstruction_polygon_paths, const Clipper2Lib::PathsD &p_carve_polygon_paths, const Clipper2Lib::RectD *p_clip_rect, const Clipper2Lib::RectD *p_bake_rect, Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons) {
 	using namespace Clipper2Lib;
+
 	PathsD traversable_polygon_paths;
 	PathsD obstruction_polygon_paths;
-	bool empty_projected_obstructions = true;
-	{
-		RWLockRead read_lock(p_source_geometry_data->geometry_rwlock);
-
-		const Vector<Vector<Vector2>> &traversable_outlines = p_source_geometry_data->traversable_outlines;
-		int outline_count = p_navigation_mesh->get_outline_count();
-
-		if (outline_count == 0 && (!p_source_geometry_data->has_data() || (traversable_outlines.is_empty()))) {
-			return;
-		}
-
-		const Vector<Vector<Vector2>> &obstruction_outlines = p_source_geometry_data->obstruction_outlines;
-		const Vector<NavigationMeshSourceGeometryData2D::ProjectedObstruction> &projected_obstructions = p_source_geometry_data->_projected_obstructions;
-
-		traversable_polygon_paths.reserve(outline_count + traversable_outlines.size());
-		obstruction_polygon_paths.reserve(obstruction_outlines.size());
-
-		for (int i = 0; i < outline_count; i++) {
-			const Vector<Vector2> &traversable_outline = p_navigation_mesh->get_outline(i);
-			PathD subject_path;
-			subject_path.reserve(traversable_outline.size());
-			for (const Vector2 &traversable_point : traversable_outline) {
-				subject_path.emplace_back(traversable_point.x, traversable_point.y);
-			}
-			traversable_polygon_paths.push_back(std::move(subject_path));
-		}
-
-		for (const Vector<Vector2> &traversable_outline : traversable_outlines) {
-			PathD subject_path;
-			subject_path.reserve(traversable_outline.size());
-			for (const Vector2 &traversable_point : traversable_outline) {
-				subject_path.emplace_back(traversable_point.x, traversable_point.y);
-			}
-			traversable_polygon_paths.push_back(std::move(subject_path));
-		}
-
-		empty_projected_obstructions = projected_obstructions.is_empty();
-		if (!empty_projected_obstructions) {
-			for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-				if (projected_obstruction.carve) {
-					continue;
-				}
-				if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
-					continue;
-				}
-
-				PathD clip_path;
-				clip_path.reserve(projected_obstruction.vertices.size() / 2);
-				for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
-					clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
-				}
-				if (!IsPositive(clip_path)) {
-					std::reverse(clip_path.begin(), clip_path.end());
-				}
-				obstruction_polygon_paths.push_back(std::move(clip_path));
-			}
-		}
-
-		for (const Vector<Vector2> &obstruction_outline : obstruction_outlines) {
-			PathD clip_path;
-			clip_path.reserve(obstruction_outline.size());
-			for (const Vector2 &obstruction_point : obstruction_outline) {
-				clip_path.emplace_back(obstruction_point.x, obstruction_point.y);
-			}
-			obstruction_polygon_paths.push_back(std::move(clip_path));
-		}
-	}
-
-	Rect2 baking_rect = p_navigation_mesh->get_baking_rect();
-	if (baking_rect.has_area()) {
-		Vector2 baking_rect_offset = p_navigation_mesh->get_baking_rect_offset();
-
-		const int rect_begin_x = baking_rect.position[0] + baking_rect_offset.x;
-		const int rect_begin_y = baking_rect.position[1] + baking_rect_offset.y;
-		const int rect_end_x = baking_rect.position[0] + baking_rect.size[0] + baking_rect_offset.x;
-		const int rect_end_y = baking_rect.position[1] + baking_rect.size[1] + baking_rect_offset.y;
-
-		RectD clipper_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
-
-		traversable_polygon_paths = RectClip(clipper_rect, traversable_polygon_paths);
-		obstruction_polygon_paths = RectClip(clipper_rect, obstruction_polygon_paths);
+	if (p_clip_rect) {
+		traversable_polygon_paths = RectClip(*p_clip_rect, p_traversable_polygon_paths);
+		obstruction_polygon_paths = RectClip(*p_clip_rect, p_obstruction_polygon_paths);
+	} else {
+		traversable_polygon_paths = p_traversable_polygon_paths;
+		obstruction_polygon_paths = p_obstruction_polygon_paths;
 	}
 
 	// first merge all traversable polygons according to user specified fill rule
@@ -411,52 +412,18 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 	}
 
 	// Apply obstructions that are not affected by agent radius, the ones with carve enabled.
-	if (!empty_projected_obstructions) {
-		RWLockRead read_lock(p_source_geometry_data->geometry_rwlock);
-		const Vector<NavigationMeshSourceGeometryData2D::ProjectedObstruction> &projected_obstructions = p_source_geometry_data->_projected_obstructions;
-		obstruction_polygon_paths.resize(0);
-		for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
-			if (!projected_obstruction.carve) {
-				continue;
-			}
-			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
-				continue;
-			}
-
-			PathD clip_path;
-			clip_path.reserve(projected_obstruction.vertices.size() / 2);
-			for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
-				clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
-			}
-			if (!IsPositive(clip_path)) {
-				std::reverse(clip_path.begin(), clip_path.end());
-			}
-			obstruction_polygon_paths.push_back(std::move(clip_path));
-		}
-		if (obstruction_polygon_paths.size() > 0) {
-			path_solution = Difference(path_solution, obstruction_polygon_paths, FillRule::NonZero);
-		}
+	if (p_carve_polygon_paths.size() > 0) {
+		path_solution = Difference(path_solution, p_carve_polygon_paths, FillRule::NonZero);
 	}
 
 	//path_solution = RamerDouglasPeucker(path_solution, 0.025); //
 
-	real_t border_size = p_navigation_mesh->get_border_size();
-	if (baking_rect.has_area() && border_size > 0.0) {
-		Vector2 baking_rect_offset = p_navigation_mesh->get_baking_rect_offset();
-
-		const int rect_begin_x = baking_rect.position[0] + baking_rect_offset.x + border_size;
-		const int rect_begin_y = baking_rect.position[1] + baking_rect_offset.y + border_size;
-		const int rect_end_x = baking_rect.position[0] + baking_rect.size[0] + baking_rect_offset.x - border_size;
-		const int rect_end_y = baking_rect.position[1] + baking_rect.size[1] + baking_rect_offset.y - border_size;
-
-		RectD clipper_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
-
-		path_solution = RectClip(clipper_rect, path_solution);
+	if (p_bake_rect) {
+		path_solution = RectClip(*p_bake_rect, path_solution);
 	}
 
 	if (path_solution.size() == 0) {
-		p_navigation_mesh->clear();
-		return;
+		return true;
 	}
 
 	ClipType clipper_cliptype = ClipType::Union;
@@ -482,30 +449,21 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_CONVEX_PARTITION:
 			if (tpart.ConvexPartition_HM(&tppl_in_polygon, &tppl_out_polygon) == 0) {
 				ERR_PRINT("NavigationPolygon polygon convex partition failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
-				p_navigation_mesh->set_vertices(Vector<Vector2>());
-				p_navigation_mesh->clear_polygons();
-				return;
+				return false;
 			}
 			break;
 		case NavigationPolygon::SamplePartitionType::SAMPLE_PARTITION_TRIANGULATE:
 			if (tpart.Triangulate_EC(&tppl_in_polygon, &tppl_out_polygon) == 0) {
 				ERR_PRINT("NavigationPolygon polygon triangulation failed. Unable to create a valid navigation mesh polygon layout from provided source geometry.");
-				p_navigation_mesh->set_vertices(Vector<Vector2>());
-				p_navigation_mesh->clear_polygons();
-				return;
+				return false;
 			}
 			break;
 		default: {
 			ERR_PRINT("NavigationPolygon polygon partitioning failed. Unrecognized partition type.");
-			p_navigation_mesh->set_vertices(Vector<Vector2>());
-			p_navigation_mesh->clear_polygons();
-			return;
+			return false;
 		}
 	}
 
-	Vector<Vector2> new_vertices;
-	Vector<Vector<int>> new_polygons;
-
 	HashMap<Vector2, int> points;
 	for (const TPPLPoly &tp : tppl_out_polygon) {
 		Vector<int> new_polygon;
@@ -513,16 +471,450 @@ void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<Navigation
 		for (int64_t i = 0; i < tp.GetNumPoints(); i++) {
 			HashMap<Vector2, int>::Iterator E = points.find(tp[i]);
 			if (!E) {
-				E = points.insert(tp[i], new_vertices.size());
-				new_vertices.push_back(tp[i]);
+				E = points.insert(tp[i], r_vertices.size());
+				r_vertices.push_back(tp[i]);
 			}
 			new_polygon.push_back(E->value);
 		}
 
-		new_polygons.push_back(new_polygon);
+		r_polygons.push_back(new_polygon);
+	}
+
+	return true;
+}
+
+static void generator_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTiledBake2D *tiled_bake = static_cast<NavMeshGeneratorTiledBake2D *>(p_arg);
+	NavMeshGeneratorTile2D &tile = tiled_bake->tiles[p_index];
+
+	const Clipper2Lib::RectD clip_rect = Clipper2Lib::RectD(tile.clip_rect.position.x, tile.clip_rect.position.y, tile.clip_rect.get_end().x, tile.clip_rect.get_end().y);
+	const Clipper2Lib::RectD bake_rect = Clipper2Lib::RectD(tile.bake_rect.position.x, tile.bake_rect.position.y, tile.bake_rect.get_end().x, tile.bake_rect.get_end().y);
+
+	tile.failed = !generator_bake_polygon_paths(tiled_bake->navigation_mesh, *tiled_bake->traversable_polygon_paths, *tiled_bake->obstruction_polygon_paths, *tiled_bake->carve_polygon_paths, &clip_rect, &bake_rect, tile.vertices, tile.polygons);
+}
+
+// Welds the vertices that the tiles on both sides of a tile border created for the same point and splits
+// the border edges at the vertices of the other side so that the polygons share identical edges again.
+static void generator_stitch_tiles(real_t p_tile_width, real_t p_snap_distance, Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	// Bit 0 set when the vertex is on a vertical tile border (constant X), bit 1 for a constant Y.
+	LocalVector<uint8_t> vertex_borders;
+	vertex_borders.resize(r_vertices.size());
+
+	Vector2 *vertices_ptrw = r_vertices.ptrw();
+	for (int i = 0; i < r_vertices.size(); i++) {
+		Vector2 &vertex = vertices_ptrw[i];
+		uint8_t borders = 0;
+		for (int axis = 0; axis < 2; axis++) {
+			const real_t border = Math::round(vertex[axis] / p_tile_width) * p_tile_width;
+			if (Math::abs(vertex[axis] - border) < p_snap_distance) {
+				vertex[axis] = border;
+				borders |= 1 << axis;
+			}
+		}
+		vertex_borders[i] = borders;
+	}
+
+	// Vertices of the polygons dropped by a tile rebake are left out.
+	LocalVector<bool> vertex_used;
+	vertex_used.resize(r_vertices.size());
+	for (uint32_t i = 0; i < vertex_used.size(); i++) {
+		vertex_used[i] = false;
+	}
+	for (const Vector<int> &polygon : r_polygons) {
+		for (int index : polygon) {
+			vertex_used[index] = true;
+		}
+	}
+
+	Vector<Vector2> stitched_vertices;
+	LocalVector<uint8_t> stitched_borders;
+	LocalVector<int> vertex_remap;
+	vertex_remap.resize(r_vertices.size());
+
+	HashMap<Vector2, int> vertex_to_index;
+	HashMap<Vector2i, int> border_cells;
+
+	for (int i = 0; i < r_vertices.size(); i++) {
+		if (!vertex_used[i]) {
+			vertex_remap[i] = -1;
+			continue;
+		}
+
+		const Vector2 &vertex = r_vertices[i];
+		int *existing_index_ptr = nullptr;
+		Vector2i border_cell;
+		if (vertex_borders[i] == 0) {
+			existing_index_ptr = vertex_to_index.getptr(vertex);
+		} else {
+			// Border vertices of neighboring tiles can differ slightly in float precision along the border.
+			border_cell = Vector2i((int)Math::round(vertex.x / p_snap_distance), (int)Math::round(vertex.y / p_snap_distance));
+			existing_index_ptr = border_cells.getptr(border_cell);
+		}
+
+		if (existing_index_ptr) {
+			vertex_remap[i] = *existing_index_ptr;
+			continue;
+		}
+
+		const int index = stitched_vertices.size();
+		if (vertex_borders[i] == 0) {
+			vertex_to_index[vertex] = index;
+		} else {
+			border_cells[border_cell] = index;
+		}
+		stitched_vertices.push_back(vertex);
+		stitched_borders.push_back(vertex_borders[i]);
+		vertex_remap[i] = index;
+	}
+
+	// Sort the vertices on each border line along the line.
+	struct BorderVertex {
+		real_t position = 0.0;
+		int index = -1;
+
+		bool operator<(const BorderVertex &p_other) const { return position < p_other.position; }
+	};
+
+	// Border lines are keyed by their tile border index times two plus the axis.
+	HashMap<int64_t, LocalVector<BorderVertex>> border_lines;
+	for (int i = 0; i < stitched_vertices.size(); i++) {
+		const Vector2 &vertex = stitched_vertices[i];
+		for (int axis = 0; axis < 2; axis++) {
+			if (stitched_borders[i] & (1 << axis)) {
+				border_lines[(int64_t)Math::round(vertex[axis] / p_tile_width) * 2 + axis].push_back({ vertex[1 - axis], i });
+			}
+		}
+	}
+	for (KeyValue<int64_t, LocalVector<BorderVertex>> &E : border_lines) {
+		E.value.sort();
+	}
+
+	Vector<Vector<int>> stitched_polygons;
+	stitched_polygons.resize(r_polygons.size());
+	int stitched_polygon_count = 0;
+
+	for (const Vector<int> &polygon : r_polygons) {
+		Vector<int> stitched_polygon;
+		for (int i = 0; i < polygon.size(); i++) {
+			const int index = vertex_remap[polygon[i]];
+			if (stitched_polygon.is_empty() || stitched_polygon[stitched_polygon.size() - 1] != index) {
+				stitched_polygon.push_back(index);
+			}
+		}
+		while (stitched_polygon.size() > 1 && stitched_polygon[0] == stitched_polygon[stitched_polygon.size() - 1]) {
+			stitched_polygon.remove_at(stitched_polygon.size() - 1);
+		}
+		if (stitched_polygon.size() < 3) {
+			continue;
+		}
+
+		// Split the edges that lie on a tile border at the vertices the other side of the border has in between.
+		Vector<int> split_polygon;
+		const int vertex_count = stitched_polygon.size();
+		for (int i = 0; i < vertex_count; i++) {
+			const int index_a = stitched_polygon[i];
+			const int index_b = stitched_polygon[(i + 1) % vertex_count];
+			split_polygon.push_back(index_a);
+
+			const uint8_t shared_borders = stitched_borders[index_a] & stitched_borders[index_b];
+			for (int axis = 0; axis < 2; axis++) {
+				if (!(shared_borders & (1 << axis))) {
+					continue;
+				}
+				const Vector2 &a = stitched_vertices[index_a];
+				const Vector2 &b = stitched_vertices[index_b];
+				if (a[axis] != b[axis]) {
+					continue;
+				}
+				const LocalVector<BorderVertex> *line_vertices = border_lines.getptr((int64_t)Math::round(a[axis] / p_tile_width) * 2 + axis);
+				if (!line_vertices) {
+					continue;
+				}
+
+				const real_t from = a[1 - axis];
+				const real_t to = b[1 - axis];
+				const real_t min_position = MIN(from, to);
+				const real_t max_position = MAX(from, to);
+
+				// First vertex on the line past the lower edge end.
+				uint32_t lower = 0;
+				uint32_t upper = line_vertices->size();
+				while (lower < upper) {
+					const uint32_t middle = (lower + upper) / 2;
+					if ((*line_vertices)[middle].position <= min_position) {
+						lower = middle + 1;
+					} else {
+						upper = middle;
+					}
+				}
+				uint32_t end = lower;
+				while (end < line_vertices->size() && (*line_vertices)[end].position < max_position) {
+					end++;
+				}
+
+				if (from < to) {
+					for (uint32_t j = lower; j < end; j++) {
+						split_polygon.push_back((*line_vertices)[j].index);
+					}
+				} else {
+					for (uint32_t j = end; j > lower; j--) {
+						split_polygon.push_back((*line_vertices)[j - 1].index);
+					}
+				}
+				break;
+			}
+		}
+
+		stitched_polygons.write[stitched_polygon_count++] = split_polygon;
+	}
+	stitched_polygons.resize(stitched_polygon_count);
+
+	r_vertices = stitched_vertices;
+	r_polygons = stitched_polygons;
+}
+
+// Splits the bake area into world aligned tiles and bakes them in parallel. With a dirty rect only the tiles
+// it touches are baked and the polygons of the other tiles are taken from the current navigation polygon.
+static bool generator_bake_tiles(const Ref<NavigationPolygon> &p_navigation_mesh, const Clipper2Lib::PathsD &p_traversable_polygon_paths, const Clipper2Lib::PathsD &p_obstruction_polygon_paths, const Clipper2Lib::PathsD &p_carve_polygon_paths, const Rect2 *p_dirty_rect, bool p_use_threads, bool p_high_priority, Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons, real_t &r_tile_width) {
+	const real_t cell_size = p_navigation_mesh->get_cell_size();
+	const real_t tile_width = MAX(1.0, Math::round(p_navigation_mesh->get_tile_size() / cell_size)) * cell_size;
+	r_tile_width = tile_width;
+
+	// The current polygons can only be kept when they were baked in the same tiles, otherwise they are all rebaked.
+	if (p_dirty_rect && !Math::is_equal_approx(p_navigation_mesh->get_baked_tile_width(), tile_width)) {
+		p_dirty_rect = nullptr;
+	}
+
+	Rect2 area;
+	Rect2 baking_rect = p_navigation_mesh->get_baking_rect();
+	if (baking_rect.has_area()) {
+		area = Rect2(baking_rect.position + p_navigation_mesh->get_baking_rect_offset(), baking_rect.size);
+		area = area.grow(-p_navigation_mesh->get_border_size());
+	} else {
+		const Clipper2Lib::RectD bounds = Clipper2Lib::GetBounds(p_traversable_polygon_paths);
+		area = Rect2(bounds.left, bounds.top, bounds.Width(), bounds.Height());
+	}
+	if (!area.has_area()) {
+		return true;
+	}
+
+	// Each tile needs enough geometry from its neighbors to shrink the traversable area like a single bake would.
+	// Miter joins reach up to twice the agent radius into the polygon.
+	const real_t tile_border = MAX(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_agent_radius() * 2.0 + cell_size);
+
+	NavMeshGeneratorTiledBake2D tiled_bake;
+	tiled_bake.navigation_mesh = p_navigation_mesh;
+	tiled_bake.traversable_polygon_paths = &p_traversable_polygon_paths;
+	tiled_bake.obstruction_polygon_paths = &p_obstruction_polygon_paths;
+	tiled_bake.carve_polygon_paths = &p_carve_polygon_paths;
+
+	const Vector2i tile_min = Vector2i((int)Math::floor(area.position.x / tile_width), (int)Math::floor(area.position.y / tile_width));
+	const Vector2i tile_max = Vector2i((int)Math::floor(area.get_end().x / tile_width), (int)Math::floor(area.get_end().y / tile_width));
+
+	// A change also moves the edges of the traversable area in the tiles next to it, up to the border the
+	// tiles read from their neighbors plus the agent radius the outlines are offset by.
+	Rect2 dirty_rect;
+	if (p_dirty_rect) {
+		dirty_rect = p_dirty_rect->abs().grow(tile_border + p_navigation_mesh->get_agent_radius());
+	}
+
+	HashSet<Vector2i> baked_tiles;
+	for (int y = tile_min.y; y <= tile_max.y; y++) {
+		for (int x = tile_min.x; x <= tile_max.x; x++) {
+			const Rect2 bake_rect = Rect2(Vector2(x, y) * tile_width, Vector2(tile_width, tile_width)).intersection(area);
+			if (!bake_rect.has_area()) {
+				continue;
+			}
+			if (p_dirty_rect && !bake_rect.intersects(dirty_rect, true)) {
+				continue;
+			}
+
+			NavMeshGeneratorTile2D tile;
+			tile.bake_rect = bake_rect;
+			tile.clip_rect = bake_rect.grow(tile_border);
+			tiled_bake.tiles.push_back(tile);
+			baked_tiles.insert(Vector2i(x, y));
+		}
+	}
+
+	if (p_use_threads && tiled_bake.tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&generator_bake_tile, &tiled_bake, tiled_bake.tiles.size(), -1, p_high_priority, "NavMeshGeneratorBakeTiles2D");
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tiled_bake.tiles.size(); i++) {
+			generator_bake_tile(&tiled_bake, i);
+		}
+	}
+
+	for (const NavMeshGeneratorTile2D &tile : tiled_bake.tiles) {
+		if (tile.failed) {
+			return false;
+		}
+	}
+
+	if (p_dirty_rect) {
+		// Keep the polygons of the tiles that are not rebaked.
+		Vector<Vector2> current_vertices;
+		Vector<Vector<int>> current_polygons;
+		p_navigation_mesh->get_data(current_vertices, current_polygons);
+
+		r_vertices = current_vertices;
+		for (const Vector<int> &polygon : current_polygons) {
+			Vector2 center;
+			for (int index : polygon) {
+				center += current_vertices[index];
+			}
+			center /= polygon.size();
+
+			if (baked_tiles.has(Vector2i((int)Math::floor(center.x / tile_width), (int)Math::floor(center.y / tile_width)))) {
+				continue;
+			}
+			r_polygons.push_back(polygon);
+		}
+	}
+
+	for (const NavMeshGeneratorTile2D &tile : tiled_bake.tiles) {
+		const int index_offset = r_vertices.size();
+		r_vertices.append_array(tile.vertices);
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> polygon = tile_polygon;
+			int *polygon_ptrw = polygon.ptrw();
+			for (int i = 0; i < polygon.size(); i++) {
+				polygon_ptrw[i] += index_offset;
+			}
+			r_polygons.push_back(polygon);
+		}
+	}
+
+	generator_stitch_tiles(tile_width, cell_size * 0.25, r_vertices, r_polygons);
+
+	return true;
+}
+
+void NavMeshGenerator2D::generator_bake_from_source_geometry_data(Ref<NavigationPolygon> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData2D> p_source_geometry_data, const Rect2 *p_dirty_rect) {
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	using namespace Clipper2Lib;
+	PathsD traversable_polygon_paths;
+	PathsD obstruction_polygon_paths;
+	PathsD carve_polygon_paths;
+	{
+		RWLockRead read_lock(p_source_geometry_data->geometry_rwlock);
+
+		const Vector<Vector<Vector2>> &traversable_outlines = p_source_geometry_data->traversable_outlines;
+		int outline_count = p_navigation_mesh->get_outline_count();
+
+		if (outline_count == 0 && (!p_source_geometry_data->has_data() || (traversable_outlines.is_empty()))) {
+			return;
+		}
+
+		const Vector<Vector<Vector2>> &obstruction_outlines = p_source_geometry_data->obstruction_outlines;
+		const Vector<NavigationMeshSourceGeometryData2D::ProjectedObstruction> &projected_obstructions = p_source_geometry_data->_projected_obstructions;
+
+		traversable_polygon_paths.reserve(outline_count + traversable_outlines.size());
+		obstruction_polygon_paths.reserve(obstruction_outlines.size());
+
+		for (int i = 0; i < outline_count; i++) {
+			const Vector<Vector2> &traversable_outline = p_navigation_mesh->get_outline(i);
+			PathD subject_path;
+			subject_path.reserve(traversable_outline.size());
+			for (const Vector2 &traversable_point : traversable_outline) {
+				subject_path.emplace_back(traversable_point.x, traversable_point.y);
+			}
+			traversable_polygon_paths.push_back(std::move(subject_path));
+		}
+
+		for (const Vector<Vector2> &traversable_outline : traversable_outlines) {
+			PathD subject_path;
+			subject_path.reserve(traversable_outline.size());
+			for (const Vector2 &traversable_point : traversable_outline) {
+				subject_path.emplace_back(traversable_point.x, traversable_point.y);
+			}
+			traversable_polygon_paths.push_back(std::move(subject_path));
+		}
+
+		// Obstructions with carve enabled are applied after the agent radius offset.
+		for (const NavigationMeshSourceGeometryData2D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+			if (projected_obstruction.vertices.is_empty() || projected_obstruction.vertices.size() % 2 != 0) {
+				continue;
+			}
+
+			PathD clip_path;
+			clip_path.reserve(projected_obstruction.vertices.size() / 2);
+			for (int i = 0; i < projected_obstruction.vertices.size() / 2; i++) {
+				clip_path.emplace_back(projected_obstruction.vertices[i * 2], projected_obstruction.vertices[i * 2 + 1]);
+			}
+			if (!IsPositive(clip_path)) {
+				std::reverse(clip_path.begin(), clip_path.end());
+			}
+			if (projected_obstruction.carve) {
+				carve_polygon_paths.push_back(std::move(clip_path));
+			} else {
+				obstruction_polygon_paths.push_back(std::move(clip_path));
+			}
+		}
+
+		for (const Vector<Vector2> &obstruction_outline : obstruction_outlines) {
+			PathD clip_path;
+			clip_path.reserve(obstruction_outline.size());
+			for (const Vector2 &obstruction_point : obstruction_outline) {
+				clip_path.emplace_back(obstruction_point.x, obstruction_point.y);
+			}
+			obstruction_polygon_paths.push_back(std::move(clip_path));
+		}
+	}
+
+	Vector<Vector2> new_vertices;
+	Vector<Vector<int>> new_polygons;
+	real_t tile_width = 0.0;
+	bool success = false;
+
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		success = generator_bake_tiles(p_navigation_mesh, traversable_polygon_paths, obstruction_polygon_paths, carve_polygon_paths, p_dirty_rect, baking_use_multiple_threads, baking_use_high_priority_threads, new_vertices, new_polygons, tile_width);
+	} else {
+		Rect2 baking_rect = p_navigation_mesh->get_baking_rect();
+		RectD clip_rect;
+		RectD bake_rect;
+		if (baking_rect.has_area()) {
+			Vector2 baking_rect_offset = p_navigation_mesh->get_baking_rect_offset();
+
+			const int rect_begin_x = baking_rect.position[0] + baking_rect_offset.x;
+			const int rect_begin_y = baking_rect.position[1] + baking_rect_offset.y;
+			const int rect_end_x = baking_rect.position[0] + baking_rect.size[0] + baking_rect_offset.x;
+			const int rect_end_y = baking_rect.position[1] + baking_rect.size[1] + baking_rect_offset.y;
+
+			clip_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
+		}
+
+		real_t border_size = p_navigation_mesh->get_border_size();
+		if (baking_rect.has_area() && border_size > 0.0) {
+			Vector2 baking_rect_offset = p_navigation_mesh->get_baking_rect_offset();
+
+			const int rect_begin_x = baking_rect.position[0] + baking_rect_offset.x + border_size;
+			const int rect_begin_y = baking_rect.position[1] + baking_rect_offset.y + border_size;
+			const int rect_end_x = baking_rect.position[0] + baking_rect.size[0] + baking_rect_offset.x - border_size;
+			const int rect_end_y = baking_rect.position[1] + baking_rect.size[1] + baking_rect_offset.y - border_size;
+
+			bake_rect = RectD(rect_begin_x, rect_begin_y, rect_end_x, rect_end_y);
+		}
+
+		success = generator_bake_polygon_paths(p_navigation_mesh, traversable_polygon_paths, obstruction_polygon_paths, carve_polygon_paths, baking_rect.has_area() ? &clip_rect : nullptr, baking_rect.has_area() && border_size > 0.0 ? &bake_rect : nullptr, new_vertices, new_polygons);
+	}
+
+	if (!success) {
+		p_navigation_mesh->set_vertices(Vector<Vector2>());
+		p_navigation_mesh->clear_polygons();
+		return;
+	}
+
+	if (new_polygons.is_empty()) {
+		p_navigation_mesh->clear();
+		return;
 	}
 
-	p_navigation_mesh->set_data(new_vertices, new_polygons);
+	p_navigation_mesh->set_data(new_vertices, new_polygons, tile_width);
 }
 
 #endif // CLIPPER2_ENABLED
@@ -42,6 +42,186 @@ using namespace Nav2D;
 
 #define THREE_POINTS_CROSS_PRODUCT(m_a, m_b, m_c) (((m_c) - (m_a)).cross((m_b) - (m_a)))
 
+// Nodes can be pushed for both children at each level, the median split tree depth is far below this.
+constexpr uint32_t POLYGON_BVH_STACK_SIZE = 128;
+
+// Flow fields kept per map iteration, the least recently used one is dropped first.
+constexpr uint32_t FLOW_FIELD_CACHE_SIZE = 16;
+
+static _FORCE_INLINE_ real_t _rect_get_distance_squared_to_point(const Rect2 &p_rect, const Vector2 &p_point) {
+	return p_point.clamp(p_rect.position, p_rect.get_end()).distance_squared_to(p_point);
+}
+
+// Traverses the polygon BVH of the map iteration, nearest nodes first.
+// The query provides `get_rect_distance()`, a lower bound of the distance to the polygons inside a node,
+// `process_polygon()`, and `max_distance`, nodes further away than it are skipped.
+// Queries break ties between polygons by their id, so results don't depend on the traversal order.
+template <typename T>
+static void _map_iteration_query_polygon_bvh(const NavMapIteration2D &p_map_iteration, T &p_query) {
+	const LocalVector<PolygonBVHNode> &bvh = p_map_iteration.polygon_bvh;
+	if (bvh.is_empty()) {
+		return;
+	}
+	const LocalVector<const Polygon *> &bvh_polygons = p_map_iteration.polygon_bvh_polygons;
+
+	struct StackEntry {
+		uint32_t node_index;
+		real_t distance;
+	};
+	StackEntry stack[POLYGON_BVH_STACK_SIZE];
+	uint32_t stack_size = 0;
+
+	stack[stack_size++] = { 0, p_query.get_rect_distance(bvh[0].rect) };
+
+	while (stack_size > 0) {
+		const StackEntry entry = stack[--stack_size];
+		if (entry.distance > p_query.max_distance) {
+			continue;
+		}
+
+		const PolygonBVHNode &node = bvh[entry.node_index];
+		if (node.polygon_count > 0) {
+			for (uint32_t i = 0; i < node.polygon_count; i++) {
+				p_query.process_polygon(*bvh_polygons[node.index + i]);
+			}
+			continue;
+		}
+
+		StackEntry near = { entry.node_index + 1, p_query.get_rect_distance(bvh[entry.node_index + 1].rect) };
+		StackEntry far = { node.index, p_query.get_rect_distance(bvh[node.index].rect) };
+		if (far.distance < near.distance) {
+			SWAP(near, far);
+		}
+
+		ERR_FAIL_COND(stack_size + 2 > POLYGON_BVH_STACK_SIZE);
+		if (far.distance <= p_query.max_distance) {
+			stack[stack_size++] = far;
+		}
+		if (near.distance <= p_query.max_distance) {
+			stack[stack_size++] = near;
+		}
+	}
+}
+
+// Returns the squared distance between the point and its closest point on the polygon.
+static real_t _polygon_get_closest_point(const Polygon &p_polygon, const Vector2 &p_point, Vector2 &r_closest_point, bool &r_inside) {
+	real_t cross = (p_polygon.vertices[1] - p_polygon.vertices[0]).cross(p_polygon.vertices[2] - p_polygon.vertices[0]);
+	Vector2 closest_on_polygon;
+	real_t closest = FLT_MAX;
+	bool inside = true;
+	Vector2 previous = p_polygon.vertices[p_polygon.vertices.size() - 1];
+	for (uint32_t point_id = 0; point_id < p_polygon.vertices.size(); ++point_id) {
+		Vector2 edge = p_polygon.vertices[point_id] - previous;
+		Vector2 to_point = p_point - previous;
+		real_t edge_to_point_cross = edge.cross(to_point);
+		bool clockwise = (edge_to_point_cross * cross) > 0;
+		// If we are not clockwise, the point will never be inside the polygon and so the closest point will be on an edge.
+		if (!clockwise) {
+			inside = false;
+			real_t point_projected_on_edge = edge.dot(to_point);
+			real_t edge_square = edge.length_squared();
+
+			if (point_projected_on_edge > edge_square) {
+				real_t distance = p_polygon.vertices[point_id].distance_squared_to(p_point);
+				if (distance < closest) {
+					closest_on_polygon = p_polygon.vertices[point_id];
+					closest = distance;
+				}
+			} else if (point_projected_on_edge < 0.0) {
+				real_t distance = previous.distance_squared_to(p_point);
+				if (distance < closest) {
+					closest_on_polygon = previous;
+					closest = distance;
+				}
+			} else {
+				// If we project on this edge, this will be the closest point.
+				real_t percent = point_projected_on_edge / edge_square;
+				closest_on_polygon = previous + percent * edge;
+				break;
+			}
+		}
+		previous = p_polygon.vertices[point_id];
+	}
+
+	r_inside = inside;
+	if (inside) {
+		r_closest_point = p_point;
+		return 0.0;
+	}
+
+	r_closest_point = closest_on_polygon;
+	return closest_on_polygon.distance_squared_to(p_point);
+}
+
+struct _ClosestPointQuery2D {
+	Vector2 point;
+	real_t max_distance = FLT_MAX;
+	const Polygon *polygon = nullptr;
+	bool inside = false;
+	ClosestPointQueryResult result;
+
+	_FORCE_INLINE_ real_t get_rect_distance(const Rect2 &p_rect) const {
+		return _rect_get_distance_squared_to_point(p_rect, point);
+	}
+
+	_FORCE_INLINE_ void process_polygon(const Polygon &p_polygon) {
+		Vector2 closest_point;
+		bool polygon_inside = false;
+		real_t distance = _polygon_get_closest_point(p_polygon, point, closest_point, polygon_inside);
+		if (polygon_inside) {
+			// Polygons containing the point take precedence, the first one of the last region containing the point wins.
+			if (inside && (p_polygon.owner->id < polygon->owner->id || (p_polygon.owner->id == polygon->owner->id && p_polygon.id > polygon->id))) {
+				return;
+			}
+			inside = true;
+		} else if (inside || distance > max_distance || (distance == max_distance && polygon && p_polygon.id > polygon->id)) {
+			return;
+		}
+		max_distance = distance;
+		polygon = &p_polygon;
+		result.point = closest_point;
+		result.owner = p_polygon.owner->get_self();
+	}
+};
+
+struct _PathQueryEndpointQuery2D {
+	const NavMeshQueries2D::NavMeshPathQueryTask2D *query_task = nullptr;
+	Vector2 point;
+	real_t max_distance = FLT_MAX;
+	const Polygon *polygon = nullptr;
+	Vector2 closest_point;
+
+	_FORCE_INLINE_ real_t get_rect_distance(const Rect2 &p_rect) const {
+		return Math::sqrt(_rect_get_distance_squared_to_point(p_rect, point));
+	}
+
+	_FORCE_INLINE_ void process_polygon(const Polygon &p_polygon) {
+		// Only consider the polygon if it in a region with compatible layers.
+		if ((query_task->navigation_layers & p_polygon.owner->get_navigation_layers()) == 0) {
+			return;
+		}
+		if (query_task->exclude_regions && query_task->excluded_regions.has(p_polygon.owner->get_self())) {
+			return;
+		}
+		if (query_task->include_regions && !query_task->included_regions.has(p_polygon.owner->get_self())) {
+			return;
+		}
+
+		// For each triangle check the distance to the point.
+		for (uint32_t point_id = 2; point_id < p_polygon.vertices.size(); point_id++) {
+			const Triangle2 triangle(p_polygon.vertices[0], p_polygon.vertices[point_id - 1], p_polygon.vertices[point_id]);
+
+			const Vector2 triangle_point = triangle.get_closest_point_to(point);
+			const real_t distance = triangle_point.distance_to(point);
+			if (distance < max_distance || (distance == max_distance && polygon && p_polygon.id < polygon->id)) {
+				max_distance = distance;
+				polygon = &p_polygon;
+				closest_point = triangle_point;
+			}
+		}
+	}
+};
+
 bool NavMeshQueries2D::emit_callback(const Callable &p_callback) {
 	ERR_FAIL_COND_V(!p_callback.is_valid(), false);
 
@@ -146,18 +326,12 @@ void NavMeshQueries2D::_query_task_push_back_point_with_metadata(NavMeshPathQuer
 	p_query_task.path_points.push_back(p_point);
 }
 
-void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
-	ERR_FAIL_NULL(p_map);
-	ERR_FAIL_COND(p_query_parameters.is_null());
-	ERR_FAIL_COND(p_query_result.is_null());
-
+void NavMeshQueries2D::_query_task_setup(NavMeshPathQueryTask2D &r_query_task, const Ref<NavigationPathQueryParameters2D> &p_query_parameters) {
 	using namespace NavigationUtilities;
 
-	NavMeshQueries2D::NavMeshPathQueryTask2D query_task;
-	query_task.start_position = p_query_parameters->get_start_position();
-	query_task.target_position = p_query_parameters->get_target_position();
-	query_task.navigation_layers = p_query_parameters->get_navigation_layers();
-	query_task.callback = p_callback;
+	r_query_task.start_position = p_query_parameters->get_start_position();
+	r_query_task.target_position = p_query_parameters->get_target_position();
+	r_query_task.navigation_layers = p_query_parameters->get_navigation_layers();
 
 	const TypedArray<RID> &_excluded_regions = p_query_parameters->get_excluded_regions();
 	const TypedArray<RID> &_included_regions = p_query_parameters->get_included_regions();
@@ -165,121 +339,220 @@ void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQ
 	uint32_t _excluded_region_count = _excluded_regions.size();
 	uint32_t _included_region_count = _included_regions.size();
 
-	query_task.exclude_regions = _excluded_region_count > 0;
-	query_task.include_regions = _included_region_count > 0;
+	r_query_task.exclude_regions = _excluded_region_count > 0;
+	r_query_task.include_regions = _included_region_count > 0;
 
-	if (query_task.exclude_regions) {
-		query_task.excluded_regions.resize(_excluded_region_count);
+	if (r_query_task.exclude_regions) {
+		r_query_task.excluded_regions.resize(_excluded_region_count);
 		for (uint32_t i = 0; i < _excluded_region_count; i++) {
-			query_task.excluded_regions[i] = _excluded_regions[i];
+			r_query_task.excluded_regions[i] = _excluded_regions[i];
 		}
 	}
 
-	if (query_task.include_regions) {
-		query_task.included_regions.resize(_included_region_count);
+	if (r_query_task.include_regions) {
+		r_query_task.included_regions.resize(_included_region_count);
 		for (uint32_t i = 0; i < _included_region_count; i++) {
-			query_task.included_regions[i] = _included_regions[i];
+			r_query_task.included_regions[i] = _included_regions[i];
 		}
 	}
 
 	switch (p_query_parameters->get_pathfinding_algorithm()) {
 		case NavigationPathQueryParameters2D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR: {
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+		} break;
+		case NavigationPathQueryParameters2D::PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR: {
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathfindingAlgorithm - fallback to default");
-			query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+			r_query_task.pathfinding_algorithm = PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
 		} break;
 	}
 
 	switch (p_query_parameters->get_path_postprocessing()) {
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_EDGECENTERED;
 		} break;
 		case NavigationPathQueryParameters2D::PathPostProcessing::PATH_POSTPROCESSING_NONE: {
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_NONE;
 		} break;
 		default: {
 			WARN_PRINT("No match for used PathPostProcessing - fallback to default");
-			query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
+			r_query_task.path_postprocessing = PathPostProcessing::PATH_POSTPROCESSING_CORRIDORFUNNEL;
 		} break;
 	}
 
-	query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
-	query_task.simplify_path = p_query_parameters->get_simplify_path();
-	query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
-	query_task.status = NavMeshPathQueryTask2D::TaskStatus::QUERY_STARTED;
-
-	p_map->query_path(query_task);
+	r_query_task.metadata_flags = (int64_t)p_query_parameters->get_metadata_flags();
+	r_query_task.simplify_path = p_query_parameters->get_simplify_path();
+	r_query_task.simplify_epsilon = p_query_parameters->get_simplify_epsilon();
+	r_query_task.status = NavMeshPathQueryTask2D::TaskStatus::QUERY_STARTED;
+}
 
-	p_query_result->set_data(
-			query_task.path_points,
-			query_task.path_meta_point_types,
-			query_task.path_meta_point_rids,
-			query_task.path_meta_point_owners);
+void NavMeshQueries2D::query_task_dispatch_result(NavMeshPathQueryTask2D &p_query_task) {
+	p_query_task.query_result->set_data(
+			p_query_task.path_points,
+			p_query_task.path_meta_point_types,
+			p_query_task.path_meta_point_rids,
+			p_query_task.path_meta_point_owners);
 
-	if (query_task.callback.is_valid()) {
-		if (emit_callback(query_task.callback)) {
-			query_task.status = NavMeshPathQueryTask2D::TaskStatus::CALLBACK_DISPATCHED;
+	if (p_query_task.callback.is_valid()) {
+		if (emit_callback(p_query_task.callback)) {
+			p_query_task.status = NavMeshPathQueryTask2D::TaskStatus::CALLBACK_DISPATCHED;
 		} else {
-			query_task.status = NavMeshPathQueryTask2D::TaskStatus::CALLBACK_FAILED;
+			p_query_task.status = NavMeshPathQueryTask2D::TaskStatus::CALLBACK_FAILED;
 		}
 	}
 }
 
+void NavMeshQueries2D::map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(p_map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D query_task;
+	_query_task_setup(query_task, p_query_parameters);
+	query_task.query_result = p_query_result;
+	query_task.callback = p_callback;
+
+	p_map->query_path(query_task);
+
+	query_task_dispatch_result(query_task);
+}
+
+void NavMeshQueries2D::map_query_path_async(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_NULL(p_map);
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMeshQueries2D::NavMeshPathQueryTask2D *query_task = memnew(NavMeshQueries2D::NavMeshPathQueryTask2D);
+	_query_task_setup(*query_task, p_query_parameters);
+	query_task->query_result = p_query_result;
+	query_task->callback = p_callback;
+
+	p_map->queue_path_query(query_task);
+}
+
 void NavMeshQueries2D::_query_task_find_start_end_positions(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration) {
-	real_t begin_d = FLT_MAX;
-	real_t end_d = FLT_MAX;
+	// Find the initial poly and the end poly on this map.
+	_PathQueryEndpointQuery2D begin_query;
+	begin_query.query_task = &p_query_task;
+	begin_query.point = p_query_task.start_position;
+	_map_iteration_query_polygon_bvh(p_map_iteration, begin_query);
+	if (begin_query.polygon) {
+		p_query_task.begin_polygon = begin_query.polygon;
+		p_query_task.begin_position = begin_query.closest_point;
+	}
+
+	_PathQueryEndpointQuery2D end_query;
+	end_query.query_task = &p_query_task;
+	end_query.point = p_query_task.target_position;
+	_map_iteration_query_polygon_bvh(p_map_iteration, end_query);
+	if (end_query.polygon) {
+		p_query_task.end_polygon = end_query.polygon;
+		p_query_task.end_position = end_query.closest_point;
+	}
+}
 
-	const LocalVector<NavRegionIteration2D> &regions = p_map_iteration.region_iterations;
+bool NavMeshQueries2D::_query_task_build_cluster_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration) {
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const LocalVector<PolygonCluster> &clusters = p_map_iteration.clusters;
+	const LocalVector<uint32_t> &cluster_neighbors = p_map_iteration.cluster_neighbors;
 
-	for (const NavRegionIteration2D &region : regions) {
-		if (!region.get_enabled()) {
-			continue;
-		}
+	const uint32_t begin_cluster_id = polygon_clusters[p_query_task.begin_polygon->id];
+	const uint32_t end_cluster_id = polygon_clusters[p_query_task.end_polygon->id];
+	if (begin_cluster_id == UINT32_MAX || end_cluster_id == UINT32_MAX) {
+		return false;
+	}
 
-		if (p_query_task.exclude_regions && p_query_task.excluded_regions.has(region.get_self())) {
-			continue;
+	LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	for (NavigationCluster &navigation_cluster : navigation_clusters) {
+		navigation_cluster.back_navigation_cluster_id = -1;
+		navigation_cluster.traveled_distance = FLT_MAX;
+	}
+
+	Heap<NavClusterCost, NavClusterCostGreaterThan> &traversable_clusters = p_query_task.path_query_slot->traversable_clusters;
+	traversable_clusters.clear();
+
+	// A* over the cluster centers, stale heap entries are skipped instead of being updated in place.
+	const Vector2 end_center = clusters[end_cluster_id].center;
+	NavClusterCost begin_cost;
+	begin_cost.cluster_id = begin_cluster_id;
+	begin_cost.total_travel_cost = clusters[begin_cluster_id].center.distance_to(end_center);
+	navigation_clusters[begin_cluster_id].traveled_distance = 0.0;
+	traversable_clusters.push(begin_cost);
+
+	bool found_route = false;
+	while (!traversable_clusters.is_empty()) {
+		const NavClusterCost least_cost = traversable_clusters.pop();
+		if (least_cost.cluster_id == end_cluster_id) {
+			found_route = true;
+			break;
 		}
-		if (p_query_task.include_regions && !p_query_task.included_regions.has(region.get_self())) {
+		if (least_cost.traveled_distance != navigation_clusters[least_cost.cluster_id].traveled_distance) {
 			continue;
 		}
 
-		// Find the initial poly and the end poly on this map.
-		for (const Polygon &p : region.get_navmesh_polygons()) {
-			// Only consider the polygon if it in a region with compatible layers.
-			if ((p_query_task.navigation_layers & p.owner->get_navigation_layers()) == 0) {
-				continue;
+		const PolygonCluster &cluster = clusters[least_cost.cluster_id];
+		for (uint32_t i = cluster.neighbor_index; i < cluster.neighbor_index + cluster.neighbor_count; i++) {
+			const uint32_t neighbor_id = cluster_neighbors[i];
+			const Vector2 &neighbor_center = clusters[neighbor_id].center;
+			const real_t new_traveled_distance = least_cost.traveled_distance + cluster.center.distance_to(neighbor_center);
+
+			NavigationCluster &neighbor_cluster = navigation_clusters[neighbor_id];
+			if (new_traveled_distance < neighbor_cluster.traveled_distance) {
+				neighbor_cluster.back_navigation_cluster_id = least_cost.cluster_id;
+				neighbor_cluster.traveled_distance = new_traveled_distance;
+
+				NavClusterCost neighbor_cost;
+				neighbor_cost.cluster_id = neighbor_id;
+				neighbor_cost.traveled_distance = new_traveled_distance;
+				neighbor_cost.total_travel_cost = new_traveled_distance + neighbor_center.distance_to(end_center);
+				traversable_clusters.push(neighbor_cost);
 			}
+		}
+	}
 
-			// For each triangle check the distance between the origin/destination.
-			for (uint32_t point_id = 2; point_id < p.vertices.size(); point_id++) {
-				const Triangle2 triangle(p.vertices[0], p.vertices[point_id - 1], p.vertices[point_id]);
-
-				Vector2 point = triangle.get_closest_point_to(p_query_task.start_position);
-				real_t distance_to_point = point.distance_to(p_query_task.start_position);
-				if (distance_to_point < begin_d) {
-					begin_d = distance_to_point;
-					p_query_task.begin_polygon = &p;
-					p_query_task.begin_position = point;
-				}
+	if (!found_route) {
+		return false;
+	}
 
-				point = triangle.get_closest_point_to(p_query_task.target_position);
-				distance_to_point = point.distance_to(p_query_task.target_position);
-				if (distance_to_point < end_d) {
-					end_d = distance_to_point;
-					p_query_task.end_polygon = &p;
-					p_query_task.end_position = point;
-				}
-			}
+	// The corridor also includes the neighbors of the route clusters so the polygon search can cut corners.
+	const uint32_t corridor_pass = ++p_query_task.path_query_slot->cluster_corridor_pass;
+	for (int cluster_id = end_cluster_id; cluster_id != -1; cluster_id = navigation_clusters[cluster_id].back_navigation_cluster_id) {
+		navigation_clusters[cluster_id].corridor_pass = corridor_pass;
+		const PolygonCluster &cluster = clusters[cluster_id];
+		for (uint32_t i = cluster.neighbor_index; i < cluster.neighbor_index + cluster.neighbor_count; i++) {
+			navigation_clusters[cluster_neighbors[i]].corridor_pass = corridor_pass;
 		}
 	}
+
+	return true;
+}
+
+static void _path_corridor_reset(NavMeshQueries2D::PathQuerySlot *p_path_query_slot, const Polygon *p_begin_poly, const Vector2 &p_begin_point) {
+	LocalVector<NavigationPoly> &navigation_polys = p_path_query_slot->path_corridor;
+	LocalVector<uint32_t> &touched_polys = p_path_query_slot->path_corridor_touched;
+
+	// Only the polygons changed by the previous search need to be reset.
+	for (uint32_t polygon_id : touched_polys) {
+		navigation_polys[polygon_id].reset();
+	}
+	touched_polys.clear();
+
+	// Initialize the matching navigation polygon.
+	NavigationPoly &begin_navigation_poly = navigation_polys[p_begin_poly->id];
+	begin_navigation_poly.poly = p_begin_poly;
+	begin_navigation_poly.entry = p_begin_point;
+	begin_navigation_poly.back_navigation_edge_pathway_start = p_begin_point;
+	begin_navigation_poly.back_navigation_edge_pathway_end = p_begin_point;
+	begin_navigation_poly.traveled_distance = 0.0;
+	touched_polys.push_back(p_begin_poly->id);
 }
 
-void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p_query_task) {
+void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration) {
 	const Vector2 p_target_position = p_query_task.target_position;
 	const Polygon *begin_poly = p_query_task.begin_polygon;
 	const Polygon *end_poly = p_query_task.end_polygon;
@@ -292,17 +565,13 @@ void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p
 	traversable_polys.clear();
 
 	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
-	for (NavigationPoly &polygon : navigation_polys) {
-		polygon.reset();
-	}
+	LocalVector<uint32_t> &touched_polys = p_query_task.path_query_slot->path_corridor_touched;
+	_path_corridor_reset(p_query_task.path_query_slot, begin_poly, begin_point);
 
-	// Initialize the matching navigation polygon.
-	NavigationPoly &begin_navigation_poly = navigation_polys[begin_poly->id];
-	begin_navigation_poly.poly = begin_poly;
-	begin_navigation_poly.entry = begin_point;
-	begin_navigation_poly.back_navigation_edge_pathway_start = begin_point;
-	begin_navigation_poly.back_navigation_edge_pathway_end = begin_point;
-	begin_navigation_poly.traveled_distance = 0.0;
+	// Polygons outside of the cluster corridor are skipped by hierarchical queries.
+	const LocalVector<uint32_t> &polygon_clusters = p_map_iteration.polygon_clusters;
+	const LocalVector<NavigationCluster> &navigation_clusters = p_query_task.path_query_slot->cluster_corridor;
+	const uint32_t corridor_pass = p_query_task.path_query_slot->cluster_corridor_pass;
 
 	// This is an implementation of the A* algorithm.
 	uint32_t least_cost_id = begin_poly->id;
@@ -329,12 +598,23 @@ void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p
 					continue;
 				}
 
+				if (p_query_task.use_cluster_corridor) {
+					const uint32_t cluster_id = polygon_clusters[connection.polygon->id];
+					if (cluster_id != UINT32_MAX && navigation_clusters[cluster_id].corridor_pass != corridor_pass) {
+						continue;
+					}
+				}
+
 				const Vector2 new_entry = Geometry2D::get_closest_point_to_segment(least_cost_poly.entry, connection.pathway_start, connection.pathway_end);
 				const real_t new_traveled_distance = least_cost_poly.entry.distance_to(new_entry) * poly_travel_cost + poly_enter_cost + least_cost_poly.traveled_distance;
 
 				// Check if the neighbor polygon has already been processed.
 				NavigationPoly &neighbor_poly = navigation_polys[connection.polygon->id];
 				if (new_traveled_distance < neighbor_poly.traveled_distance) {
+					if (neighbor_poly.traveled_distance == FLT_MAX) {
+						touched_polys.push_back(connection.polygon->id);
+					}
+
 					// Add the polygon to the heap of polygons to traverse next.
 					neighbor_poly.back_navigation_poly_id = least_cost_id;
 					neighbor_poly.back_navigation_edge = connection.edge;
@@ -360,6 +640,16 @@ void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p
 		// When the heap of traversable polygons is empty at this point it means the end polygon is
 		// unreachable.
 		if (traversable_polys.is_empty()) {
+			if (p_query_task.use_cluster_corridor) {
+				// The end polygon can't be reached inside the cluster corridor, search the whole map instead.
+				p_query_task.use_cluster_corridor = false;
+				_path_corridor_reset(p_query_task.path_query_slot, begin_poly, begin_point);
+				least_cost_id = begin_poly->id;
+				reachable_end = nullptr;
+				distance_to_reachable_end = FLT_MAX;
+				continue;
+			}
+
 			// Thus use the further reachable polygon
 			ERR_BREAK_MSG(is_reachable == false, "It's not expect to not find the most reachable polygons");
 			is_reachable = false;
@@ -466,6 +756,56 @@ void NavMeshQueries2D::_query_task_build_path_corridor(NavMeshPathQueryTask2D &p
 	}
 }
 
+bool NavMeshQueries2D::_query_task_restore_cached_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration, const PathCorridorKey &p_key) {
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+
+	PathCorridorCacheEntry *cache_entry = p_map_iteration.path_corridor_cache.getptr(p_key);
+	if (!cache_entry) {
+		return false;
+	}
+	cache_entry->last_used = ++p_map_iteration.path_corridor_cache_pass;
+
+	// Put the corridor back into the path query slot as if the search had just found it.
+	_path_corridor_reset(p_query_task.path_query_slot, p_query_task.begin_polygon, p_query_task.begin_position);
+	LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+	LocalVector<uint32_t> &touched_polys = p_query_task.path_query_slot->path_corridor_touched;
+	for (const NavigationPoly &navigation_poly : cache_entry->corridor) {
+		navigation_polys[navigation_poly.poly->id] = navigation_poly;
+		touched_polys.push_back(navigation_poly.poly->id);
+	}
+	p_query_task.least_cost_id = p_query_task.end_polygon->id;
+
+	return true;
+}
+
+void NavMeshQueries2D::_query_task_cache_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration, const PathCorridorKey &p_key) {
+	const LocalVector<NavigationPoly> &navigation_polys = p_query_task.path_query_slot->path_corridor;
+
+	PathCorridorCacheEntry cache_entry;
+	for (int np_id = p_query_task.least_cost_id; navigation_polys[np_id].back_navigation_poly_id != -1; np_id = navigation_polys[np_id].back_navigation_poly_id) {
+		NavigationPoly navigation_poly = navigation_polys[np_id];
+		navigation_poly.traversable_poly_index = UINT32_MAX;
+		cache_entry.corridor.push_back(navigation_poly);
+	}
+
+	MutexLock lock(p_map_iteration.path_corridor_cache_mutex);
+
+	HashMap<PathCorridorKey, PathCorridorCacheEntry, PathCorridorKey> &path_corridor_cache = p_map_iteration.path_corridor_cache;
+	while (!path_corridor_cache.is_empty() && path_corridor_cache.size() >= p_query_task.path_cache_size && !path_corridor_cache.has(p_key)) {
+		// Drop the least recently used corridor.
+		HashMap<PathCorridorKey, PathCorridorCacheEntry, PathCorridorKey>::Iterator least_used = path_corridor_cache.begin();
+		for (HashMap<PathCorridorKey, PathCorridorCacheEntry, PathCorridorKey>::Iterator E = path_corridor_cache.begin(); E; ++E) {
+			if (E->value.last_used < least_used->value.last_used) {
+				least_used = E;
+			}
+		}
+		path_corridor_cache.remove(least_used);
+	}
+
+	cache_entry.last_used = ++p_map_iteration.path_corridor_cache_pass;
+	path_corridor_cache.insert(p_key, cache_entry);
+}
+
 void NavMeshQueries2D::query_task_map_iteration_get_path(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration) {
 	p_query_task.path_clear();
 
@@ -484,10 +824,37 @@ void NavMeshQueries2D::query_task_map_iteration_get_path(NavMeshPathQueryTask2D
 		return;
 	}
 
-	_query_task_build_path_corridor(p_query_task);
+	// Queries between the same polygons can share the path corridor, only the post-processing depends on the exact positions.
+	// The positions of the corridor polygons are only used without post-processing.
+	PathCorridorKey path_corridor_key;
+	p_query_task.path_corridor_cacheable = p_query_task.path_cache_size > 0 && p_query_task.path_postprocessing != PathPostProcessing::PATH_POSTPROCESSING_NONE;
+	if (p_query_task.path_corridor_cacheable) {
+		path_corridor_key.begin_polygon_id = p_query_task.begin_polygon->id;
+		path_corridor_key.end_polygon_id = p_query_task.end_polygon->id;
+		path_corridor_key.navigation_layers = p_query_task.navigation_layers;
+		path_corridor_key.pathfinding_algorithm = p_query_task.pathfinding_algorithm;
+		path_corridor_key.exclude_regions = p_query_task.exclude_regions;
+		path_corridor_key.include_regions = p_query_task.include_regions;
+		path_corridor_key.excluded_regions = p_query_task.excluded_regions;
+		path_corridor_key.included_regions = p_query_task.included_regions;
+		p_query_task.path_corridor_cache_hit = _query_task_restore_cached_path_corridor(p_query_task, p_map_iteration, path_corridor_key);
+	}
 
-	if (p_query_task.status == NavMeshPathQueryTask2D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask2D::TaskStatus::QUERY_FAILED) {
-		return;
+	if (!p_query_task.path_corridor_cache_hit) {
+		const Polygon *end_polygon = p_query_task.end_polygon;
+
+		p_query_task.use_cluster_corridor = p_query_task.pathfinding_algorithm == PathfindingAlgorithm::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR && _query_task_build_cluster_corridor(p_query_task, p_map_iteration);
+
+		_query_task_build_path_corridor(p_query_task, p_map_iteration);
+
+		if (p_query_task.status == NavMeshPathQueryTask2D::TaskStatus::QUERY_FINISHED || p_query_task.status == NavMeshPathQueryTask2D::TaskStatus::QUERY_FAILED) {
+			return;
+		}
+
+		// When the end polygon is unreachable the corridor leads to the closest reachable polygon to the exact target position instead.
+		if (p_query_task.path_corridor_cacheable && p_query_task.end_polygon == end_polygon) {
+			_query_task_cache_path_corridor(p_query_task, p_map_iteration, path_corridor_key);
+		}
 	}
 
 	// Post-Process path.
@@ -728,70 +1095,11 @@ RID NavMeshQueries2D::map_iteration_get_closest_point_owner(const NavMapIteratio
 }
 
 ClosestPointQueryResult NavMeshQueries2D::map_iteration_get_closest_point_info(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point) {
-	ClosestPointQueryResult result;
-	real_t closest_point_distance_squared = FLT_MAX;
+	_ClosestPointQuery2D query;
+	query.point = p_point;
+	_map_iteration_query_polygon_bvh(p_map_iteration, query);
 
-	// TODO: Check for further 2D improvements.
-
-	const LocalVector<NavRegionIteration2D> &regions = p_map_iteration.region_iterations;
-	for (const NavRegionIteration2D &region : regions) {
-		for (const Polygon &polygon : region.get_navmesh_polygons()) {
-			real_t cross = (polygon.vertices[1] - polygon.vertices[0]).cross(polygon.vertices[2] - polygon.vertices[0]);
-			Vector2 closest_on_polygon;
-			real_t closest = FLT_MAX;
-			bool inside = true;
-			Vector2 previous = polygon.vertices[polygon.vertices.size() - 1];
-			for (uint32_t point_id = 0; point_id < polygon.vertices.size(); ++point_id) {
-				Vector2 edge = polygon.vertices[point_id] - previous;
-				Vector2 to_point = p_point - previous;
-				real_t edge_to_point_cross = edge.cross(to_point);
-				bool clockwise = (edge_to_point_cross * cross) > 0;
-				// If we are not clockwise, the point will never be inside the polygon and so the closest point will be on an edge.
-				if (!clockwise) {
-					inside = false;
-					real_t point_projected_on_edge = edge.dot(to_point);
-					real_t edge_square = edge.length_squared();
-
-					if (point_projected_on_edge > edge_square) {
-						real_t distance = polygon.vertices[point_id].distance_squared_to(p_point);
-						if (distance < closest) {
-							closest_on_polygon = polygon.vertices[point_id];
-							closest = distance;
-						}
-					} else if (point_projected_on_edge < 0.0) {
-						real_t distance = previous.distance_squared_to(p_point);
-						if (distance < closest) {
-							closest_on_polygon = previous;
-							closest = distance;
-						}
-					} else {
-						// If we project on this edge, this will be the closest point.
-						real_t percent = point_projected_on_edge / edge_square;
-						closest_on_polygon = previous + percent * edge;
-						break;
-					}
-				}
-				previous = polygon.vertices[point_id];
-			}
-
-			if (inside) {
-				closest_point_distance_squared = 0.0;
-				result.point = p_point;
-				result.owner = polygon.owner->get_self();
-
-				break;
-			} else {
-				real_t distance = closest_on_polygon.distance_squared_to(p_point);
-				if (distance < closest_point_distance_squared) {
-					closest_point_distance_squared = distance;
-					result.point = closest_on_polygon;
-					result.owner = polygon.owner->get_self();
-				}
-			}
-		}
-	}
-
-	return result;
+	return query.result;
 }
 
 Vector2 NavMeshQueries2D::map_iteration_get_random_point(const NavMapIteration2D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly) {
@@ -856,6 +1164,210 @@ Vector2 NavMeshQueries2D::map_iteration_get_random_point(const NavMapIteration2D
 	}
 }
 
+Vector2 NavMeshQueries2D::map_iteration_get_flow_field_next_position(NavMapIteration2D &p_map_iteration, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance) {
+	NavMeshPathQueryTask2D query_task;
+	query_task.navigation_layers = p_navigation_layers;
+
+	_PathQueryEndpointQuery2D begin_query;
+	begin_query.query_task = &query_task;
+	begin_query.point = p_origin;
+	_map_iteration_query_polygon_bvh(p_map_iteration, begin_query);
+	if (!begin_query.polygon) {
+		return p_origin;
+	}
+
+	FlowFieldKey key;
+	key.destination = p_destination;
+	key.navigation_layers = p_navigation_layers;
+
+	FlowField *flow_field = nullptr;
+	p_map_iteration.flow_fields_rwlock.read_lock();
+	FlowField **cached_flow_field = p_map_iteration.flow_fields.getptr(key);
+	if (cached_flow_field) {
+		flow_field = *cached_flow_field;
+		flow_field->refcount.ref();
+	}
+	p_map_iteration.flow_fields_rwlock.read_unlock();
+
+	if (!flow_field) {
+		bool build = false;
+		p_map_iteration.flow_fields_rwlock.write_lock();
+		// Another agent may have added the field since the lookup.
+		cached_flow_field = p_map_iteration.flow_fields.getptr(key);
+		if (cached_flow_field) {
+			flow_field = *cached_flow_field;
+			flow_field->refcount.ref();
+		} else {
+			if (p_map_iteration.flow_fields.size() >= FLOW_FIELD_CACHE_SIZE) {
+				FlowFieldKey evicted_key;
+				FlowField *evicted_flow_field = nullptr;
+				for (const KeyValue<FlowFieldKey, FlowField *> &E : p_map_iteration.flow_fields) {
+					if (!evicted_flow_field || E.value->last_used.get() < evicted_flow_field->last_used.get()) {
+						evicted_key = E.key;
+						evicted_flow_field = E.value;
+					}
+				}
+				p_map_iteration.flow_fields.erase(evicted_key);
+				// Queries still using the evicted field keep it alive until they are done.
+				if (evicted_flow_field->refcount.unref()) {
+					memdelete(evicted_flow_field);
+				}
+			}
+			flow_field = memnew(FlowField);
+			flow_field->destination = p_destination;
+			flow_field->navigation_layers = p_navigation_layers;
+			// Referenced by the cache and by this query.
+			flow_field->refcount.init(2);
+			flow_field->build_mutex.lock();
+			p_map_iteration.flow_fields.insert(key, flow_field);
+			build = true;
+		}
+		p_map_iteration.flow_fields_rwlock.write_unlock();
+
+		if (build) {
+			_flow_field_build(*flow_field, p_map_iteration);
+			flow_field->built.set();
+			flow_field->build_mutex.unlock();
+		}
+	}
+
+	if (!flow_field->built.is_set()) {
+		// Waits for the agent building this field only, the queries of other fields go on.
+		MutexLock build_lock(flow_field->build_mutex);
+	}
+	flow_field->last_used.set(p_map_iteration.flow_fields_pass.increment());
+
+	Vector2 next_position = p_origin;
+	const FlowFieldPolygon *flow_field_polygon = &flow_field->polygons[begin_query.polygon->id];
+	// The destination can't be reached when the travel cost is FLT_MAX.
+	if (flow_field_polygon->travel_cost != FLT_MAX) {
+		// Skip the waypoints that are too close to be worth steering to, e.g. polygon edges right next to the agent.
+		next_position = flow_field_polygon->exit;
+		while (flow_field_polygon->next_polygon_id != UINT32_MAX && next_position.distance_to(begin_query.closest_point) < p_desired_distance) {
+			flow_field_polygon = &flow_field->polygons[flow_field_polygon->next_polygon_id];
+			next_position = flow_field_polygon->exit;
+		}
+	}
+
+	if (flow_field->refcount.unref()) {
+		memdelete(flow_field);
+	}
+	return next_position;
+}
+
+void NavMeshQueries2D::_flow_field_build(FlowField &r_flow_field, const NavMapIteration2D &p_map_iteration) {
+	NavMeshPathQueryTask2D query_task;
+	query_task.navigation_layers = r_flow_field.navigation_layers;
+
+	const uint32_t polygon_count = p_map_iteration.navmesh_polygon_count;
+	r_flow_field.polygons.resize(polygon_count);
+
+	_PathQueryEndpointQuery2D end_query;
+	end_query.query_task = &query_task;
+	end_query.point = r_flow_field.destination;
+	_map_iteration_query_polygon_bvh(p_map_iteration, end_query);
+	if (!end_query.polygon) {
+		return;
+	}
+
+	// The field is expanded from the destination against the direction of the connections, which can be one-way.
+	// Gather the polygons reachable through connections and the incoming connections of each polygon.
+	struct IncomingConnection {
+		uint32_t polygon_id = 0;
+		const Polygon *from_polygon = nullptr;
+		const Edge::Connection *connection = nullptr;
+	};
+	LocalVector<IncomingConnection> connections;
+	LocalVector<const Polygon *> polygons;
+	polygons.resize(polygon_count);
+	for (const Polygon *&polygon : polygons) {
+		polygon = nullptr;
+	}
+
+	LocalVector<const Polygon *> polygons_to_visit;
+	for (const Polygon *polygon : p_map_iteration.polygon_bvh_polygons) {
+		polygons[polygon->id] = polygon;
+		polygons_to_visit.push_back(polygon);
+	}
+	while (!polygons_to_visit.is_empty()) {
+		const Polygon *polygon = polygons_to_visit[polygons_to_visit.size() - 1];
+		polygons_to_visit.remove_at(polygons_to_visit.size() - 1);
+
+		for (const Edge &edge : polygon->edges) {
+			for (const Edge::Connection &connection : edge.connections) {
+				const uint32_t polygon_id = connection.polygon->id;
+				connections.push_back({ polygon_id, polygon, &connection });
+				if (!polygons[polygon_id]) {
+					polygons[polygon_id] = connection.polygon;
+					polygons_to_visit.push_back(connection.polygon);
+				}
+			}
+		}
+	}
+
+	// Sort the incoming connections by polygon.
+	LocalVector<uint32_t> connection_offsets;
+	connection_offsets.resize(polygon_count + 1);
+	for (uint32_t &connection_offset : connection_offsets) {
+		connection_offset = 0;
+	}
+	for (const IncomingConnection &connection : connections) {
+		connection_offsets[connection.polygon_id + 1]++;
+	}
+	for (uint32_t i = 0; i < polygon_count; i++) {
+		connection_offsets[i + 1] += connection_offsets[i];
+	}
+	LocalVector<IncomingConnection> incoming_connections;
+	incoming_connections.resize(connections.size());
+	LocalVector<uint32_t> connection_cursors = connection_offsets;
+	for (const IncomingConnection &connection : connections) {
+		incoming_connections[connection_cursors[connection.polygon_id]++] = connection;
+	}
+
+	// This is Dijkstra's algorithm, the travel costs match the ones of path queries.
+	const uint32_t end_polygon_id = end_query.polygon->id;
+	r_flow_field.end_polygon_id = end_polygon_id;
+	r_flow_field.polygons[end_polygon_id].travel_cost = 0.0;
+	r_flow_field.polygons[end_polygon_id].exit = end_query.closest_point;
+
+	Heap<FlowFieldCost, FlowFieldCostGreaterThan> traversable_polys;
+	traversable_polys.push({ end_polygon_id, 0.0 });
+
+	while (!traversable_polys.is_empty()) {
+		const FlowFieldCost least_cost = traversable_polys.pop();
+		const FlowFieldPolygon &least_cost_poly = r_flow_field.polygons[least_cost.polygon_id];
+		if (least_cost.travel_cost != least_cost_poly.travel_cost) {
+			// Stale entry, the polygon was reached with a lower cost since.
+			continue;
+		}
+
+		const NavBaseIteration2D *owner = polygons[least_cost.polygon_id]->owner;
+		const real_t poly_travel_cost = owner->get_travel_cost();
+
+		for (uint32_t i = connection_offsets[least_cost.polygon_id]; i < connection_offsets[least_cost.polygon_id + 1]; i++) {
+			const IncomingConnection &connection = incoming_connections[i];
+			const NavBaseIteration2D *from_owner = connection.from_polygon->owner;
+			if (!_query_task_is_connection_owner_usable(query_task, from_owner)) {
+				continue;
+			}
+
+			const Vector2 new_exit = Geometry2D::get_closest_point_to_segment(least_cost_poly.exit, connection.connection->pathway_start, connection.connection->pathway_end);
+			real_t new_travel_cost = least_cost_poly.travel_cost + new_exit.distance_to(least_cost_poly.exit) * poly_travel_cost;
+			if (from_owner->get_self() != owner->get_self()) {
+				new_travel_cost += owner->get_enter_cost();
+			}
+
+			FlowFieldPolygon &neighbor_poly = r_flow_field.polygons[connection.from_polygon->id];
+			if (new_travel_cost < neighbor_poly.travel_cost) {
+				neighbor_poly.travel_cost = new_travel_cost;
+				neighbor_poly.exit = new_exit;
+				neighbor_poly.next_polygon_id = least_cost.polygon_id;
+				traversable_polys.push({ connection.from_polygon->id, new_travel_cost });
+			}
+		}
+	}
+}
+
 Vector2 NavMeshQueries2D::polygons_get_closest_point(const LocalVector<Polygon> &p_polygons, const Vector2 &p_point) {
 	ClosestPointQueryResult cp = polygons_get_closest_point_info(p_polygons, p_point);
 	return cp.point;
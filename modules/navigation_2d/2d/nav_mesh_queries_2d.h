@@ -45,7 +45,12 @@ class NavMeshQueries2D {
 public:
 	struct PathQuerySlot {
 		LocalVector<Nav2D::NavigationPoly> path_corridor;
+		// Ids of the path corridor polygons changed by the last query, reset before the next one.
+		LocalVector<uint32_t> path_corridor_touched;
 		Heap<Nav2D::NavigationPoly *, Nav2D::NavPolyTravelCostGreaterThan, Nav2D::NavPolyHeapIndexer> traversable_polys;
+		LocalVector<Nav2D::NavigationCluster> cluster_corridor;
+		Heap<Nav2D::NavClusterCost, Nav2D::NavClusterCostGreaterThan> traversable_clusters;
+		uint32_t cluster_corridor_pass = 0;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
@@ -79,10 +84,14 @@ public:
 		const Nav2D::Polygon *begin_polygon = nullptr;
 		const Nav2D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		bool use_cluster_corridor = false;
+		bool path_corridor_cacheable = false;
+		bool path_corridor_cache_hit = false;
 
 		// Map.
 		NavMap2D *map = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
+		uint32_t path_cache_size = 0;
 
 		// Path points.
 		LocalVector<Vector2> path_points;
@@ -122,13 +131,20 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point);
 	static Nav2D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration2D &p_map_iteration, const Vector2 &p_point);
 	static Vector2 map_iteration_get_random_point(const NavMapIteration2D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static Vector2 map_iteration_get_flow_field_next_position(NavMapIteration2D &p_map_iteration, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance);
 
 	static void map_query_path(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback);
+	static void map_query_path_async(NavMap2D *p_map, const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
+	static void query_task_dispatch_result(NavMeshPathQueryTask2D &p_query_task);
+	static void _query_task_setup(NavMeshPathQueryTask2D &r_query_task, const Ref<NavigationPathQueryParameters2D> &p_query_parameters);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask2D &p_query_task, const Vector2 &p_point, const Nav2D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
-	static void _query_task_build_path_corridor(NavMeshPathQueryTask2D &p_query_task);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
+	static void _query_task_build_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration);
+	static bool _query_task_restore_cached_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration, const Nav2D::PathCorridorKey &p_key);
+	static void _query_task_cache_path_corridor(NavMeshPathQueryTask2D &p_query_task, const NavMapIteration2D &p_map_iteration, const Nav2D::PathCorridorKey &p_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask2D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask2D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask2D &p_query_task);
@@ -136,6 +152,8 @@ public:
 	static void _query_task_simplified_path_points(NavMeshPathQueryTask2D &p_query_task);
 	static bool _query_task_is_connection_owner_usable(const NavMeshPathQueryTask2D &p_query_task, const NavBaseIteration2D *p_owner);
 
+	static void _flow_field_build(Nav2D::FlowField &r_flow_field, const NavMapIteration2D &p_map_iteration);
+
 	static void simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector2> &p_points, real_t p_epsilon, LocalVector<uint32_t> &r_simplified_path_indices);
 	static LocalVector<uint32_t> get_simplified_path_indices(const LocalVector<Vector2> &p_path, real_t p_epsilon);
 };
@@ -40,6 +40,10 @@ struct NavRegionIteration2D : NavBaseIteration2D {
 	real_t surface_area = 0.0;
 	Rect2 bounds;
 
+	// The polygon edges already merged within the region, and the edges left for the map to connect.
+	LocalVector<Nav2D::RegionEdgeConnectionPair> edge_connection_pairs;
+	LocalVector<Nav2D::RegionEdge> free_edges;
+
 	const Transform2D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
 	Rect2 get_bounds() const { return bounds; }
@@ -148,8 +148,18 @@ void NavMap2D::query_path(NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_task
 		ERR_FAIL_NULL_MSG(p_query_task.path_query_slot, "No unused NavMap2D path query slot found! This should never happen :(.");
 	}
 
+	p_query_task.path_cache_size = path_cache_size.get();
+
 	NavMeshQueries2D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
+	if (p_query_task.path_corridor_cacheable) {
+		if (p_query_task.path_corridor_cache_hit) {
+			path_cache_hit_count.increment();
+		} else {
+			path_cache_miss_count.increment();
+		}
+	}
+
 	map_iteration.path_query_slots_mutex.lock();
 	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
 	map_iteration.path_query_slots[used_slot_index].in_use = false;
@@ -159,6 +169,57 @@ void NavMap2D::query_path(NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_task
 	map_iteration.path_query_slots_semaphore.post();
 }
 
+void NavMap2D::queue_path_query(NavMeshQueries2D::NavMeshPathQueryTask2D *p_query_task) {
+	MutexLock lock(path_query_queue_mutex);
+	path_query_queue.push_back(p_query_task);
+}
+
+void NavMap2D::_process_queued_path_query(uint32_t p_index, NavMeshQueries2D::NavMeshPathQueryTask2D **p_query_task) {
+	query_path(*p_query_task[p_index]);
+}
+
+void NavMap2D::process_path_query_queue() {
+	{
+		MutexLock lock(path_query_queue_mutex);
+		if (path_query_queue.is_empty()) {
+			return;
+		}
+
+		// Take the oldest queries, the others wait for the next physics step.
+		uint32_t batch_size = path_query_queue.size();
+		if (path_query_batch_max > 0 && batch_size > (uint32_t)path_query_batch_max) {
+			batch_size = path_query_batch_max;
+		}
+
+		path_query_batch.resize(batch_size);
+		for (uint32_t i = 0; i < batch_size; i++) {
+			path_query_batch[i] = path_query_queue[i];
+		}
+		for (uint32_t i = batch_size; i < path_query_queue.size(); i++) {
+			path_query_queue[i - batch_size] = path_query_queue[i];
+		}
+		path_query_queue.resize(path_query_queue.size() - batch_size);
+	}
+
+	// Limit the tasks to the path query slots so that no worker thread waits for a free slot.
+	if (use_threads && path_query_slots_max > 1 && path_query_batch.size() > 1) {
+		int tasks_needed = MIN(path_query_slots_max, (int)path_query_batch.size());
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap2D::_process_queued_path_query, path_query_batch.ptr(), path_query_batch.size(), tasks_needed, true, SNAME("NavMapPathQueries2D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : path_query_batch) {
+			query_path(*query_task);
+		}
+	}
+
+	// Results and callbacks are delivered on the calling thread.
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : path_query_batch) {
+		NavMeshQueries2D::query_task_dispatch_result(*query_task);
+		memdelete(query_task);
+	}
+	path_query_batch.clear();
+}
+
 Vector2 NavMap2D::get_closest_point(const Vector2 &p_point) const {
 	if (iteration_id == 0) {
 		NAVMAP_ITERATION_ZERO_ERROR_MSG();
@@ -276,6 +337,17 @@ Vector2 NavMap2D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries2D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+Vector2 NavMap2D::get_flow_field_next_position(const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance) {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		return p_origin;
+	}
+
+	GET_MAP_ITERATION();
+
+	return NavMeshQueries2D::map_iteration_get_flow_field_next_position(map_iteration, p_origin, p_destination, p_navigation_layers, p_desired_distance);
+}
+
 void NavMap2D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -306,7 +378,6 @@ void NavMap2D::_build_iteration() {
 
 	iteration_build.reset();
 
-	iteration_build.merge_rasterizer_cell_size = get_merge_rasterizer_cell_size();
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
@@ -384,6 +455,7 @@ void NavMap2D::_sync_iteration() {
 	performance_data.pm_edge_merge_count = iteration_build.performance_data.pm_edge_merge_count;
 	performance_data.pm_edge_connection_count = iteration_build.performance_data.pm_edge_connection_count;
 	performance_data.pm_edge_free_count = iteration_build.performance_data.pm_edge_free_count;
+	performance_data.pm_iteration_build_usec = iteration_build.performance_data.pm_iteration_build_usec;
 
 	iteration_id = iteration_id % UINT32_MAX + 1;
 
@@ -402,6 +474,8 @@ void NavMap2D::sync() {
 	performance_data.pm_agent_count = agents.size();
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
+	performance_data.pm_path_cache_hit_count = path_cache_hit_count.get();
+	performance_data.pm_path_cache_miss_count = path_cache_miss_count.get();
 
 	_sync_dirty_map_update_requests();
 
@@ -509,27 +583,15 @@ void NavMap2D::_update_rvo_obstacles_tree() {
 	rvo_simulation.kdTree_->buildObstacleTree(raw_obstacles);
 }
 
-void NavMap2D::_update_rvo_agents_tree() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO2D::Agent2D *> raw_agents;
-	raw_agents.reserve(active_avoidance_agents.size());
-	for (NavAgent2D *agent : active_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent());
-	}
-	rvo_simulation.kdTree_->buildAgentTree(raw_agents);
-}
-
 void NavMap2D::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree();
 	}
-	if (agents_dirty) {
-		_update_rvo_agents_tree();
-	}
 }
 
 void NavMap2D::compute_single_avoidance_step(uint32_t p_index, NavAgent2D **p_agent) {
-	(*(p_agent + p_index))->get_rvo_agent()->computeNeighbors(&rvo_simulation);
+	(*(p_agent + p_index))->get_rvo_agent()->computeObstacleNeighbors(&rvo_simulation);
+	avoidance_grid.compute_agent_neighbors((*(p_agent + p_index))->get_rvo_agent());
 	(*(p_agent + p_index))->get_rvo_agent()->computeNewVelocity(&rvo_simulation);
 	(*(p_agent + p_index))->get_rvo_agent()->update(&rvo_simulation);
 	(*(p_agent + p_index))->update();
@@ -539,12 +601,15 @@ void NavMap2D::step(double p_delta_time) {
 	rvo_simulation.setTimeStep(float(p_delta_time));
 
 	if (active_avoidance_agents.size() > 0) {
+		// Agents move every step, so the neighbor grid is rebuilt from the current positions.
+		avoidance_grid.build(active_avoidance_agents);
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap2D::compute_single_avoidance_step, active_avoidance_agents.ptr(), active_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent2D *agent : active_avoidance_agents) {
-				agent->get_rvo_agent()->computeNeighbors(&rvo_simulation);
+				agent->get_rvo_agent()->computeObstacleNeighbors(&rvo_simulation);
+				avoidance_grid.compute_agent_neighbors(agent->get_rvo_agent());
 				agent->get_rvo_agent()->computeNewVelocity(&rvo_simulation);
 				agent->get_rvo_agent()->update(&rvo_simulation);
 				agent->update();
@@ -729,6 +794,14 @@ bool NavMap2D::get_use_async_iterations() const {
 	return use_async_iterations;
 }
 
+void NavMap2D::set_path_cache_size(int p_size) {
+	path_cache_size.set(MAX(p_size, 0));
+}
+
+int NavMap2D::get_path_cache_size() const {
+	return path_cache_size.get();
+}
+
 NavMap2D::NavMap2D() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
@@ -746,6 +819,10 @@ NavMap2D::NavMap2D() {
 		path_query_slots_max = 1;
 	}
 
+	path_query_batch_max = GLOBAL_GET("navigation/pathfinding/max_async_queries_per_step");
+
+	set_path_cache_size(GLOBAL_GET("navigation/pathfinding/path_cache_size"));
+
 	iteration_slots.resize(2);
 
 	for (NavMapIteration2D &iteration_slot : iteration_slots) {
@@ -768,4 +845,12 @@ NavMap2D::~NavMap2D() {
 		WorkerThreadPool::get_singleton()->wait_for_task_completion(iteration_build_thread_task_id);
 		iteration_build_thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	}
+
+	for (NavMeshQueries2D::NavMeshPathQueryTask2D *query_task : path_query_queue) {
+		memdelete(query_task);
+	}
+
+	for (NavMapIteration2D &iteration_slot : iteration_slots) {
+		iteration_slot.clear_flow_fields();
+	}
 }
@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "2d/nav_avoidance_grid_2d.h"
 #include "2d/nav_map_iteration_2d.h"
 #include "2d/nav_mesh_queries_2d.h"
 #include "nav_rid_2d.h"
@@ -79,6 +80,9 @@ class NavMap2D : public NavRid2D {
 	/// Avoidance controlled agents.
 	LocalVector<NavAgent2D *> active_avoidance_agents;
 
+	/// Neighbor search grid of the avoidance controlled agents, rebuilt each step.
+	NavAvoidanceGrid2D avoidance_grid;
+
 	/// dirty flag when one of the agent's arrays are modified.
 	bool agents_dirty = true;
 
@@ -110,6 +114,17 @@ class NavMap2D : public NavRid2D {
 
 	int path_query_slots_max = 4;
 
+	// Path queries requested with NavigationServer2D.query_path_async(), processed in batches on the WorkerThreadPool.
+	LocalVector<NavMeshQueries2D::NavMeshPathQueryTask2D *> path_query_queue;
+	LocalVector<NavMeshQueries2D::NavMeshPathQueryTask2D *> path_query_batch;
+	Mutex path_query_queue_mutex;
+	int path_query_batch_max = 256;
+
+	// Path corridors kept per map iteration for queries between the same polygons, 0 disables the cache.
+	SafeNumeric<uint32_t> path_cache_size; // Read by queries running on other threads.
+	SafeNumeric<uint32_t> path_cache_hit_count;
+	SafeNumeric<uint32_t> path_cache_miss_count;
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -163,6 +178,7 @@ public:
 	Vector2 get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries2D::NavMeshPathQueryTask2D &p_query_task);
+	void queue_path_query(NavMeshQueries2D::NavMeshPathQueryTask2D *p_query_task);
 
 	Vector2 get_closest_point(const Vector2 &p_point) const;
 	Nav2D::ClosestPointQueryResult get_closest_point_info(const Vector2 &p_point) const;
@@ -198,10 +214,12 @@ public:
 	}
 
 	Vector2 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	Vector2 get_flow_field_next_position(const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance);
 
 	void sync();
 	void step(double p_delta_time);
 	void dispatch_callbacks();
+	void process_path_query_queue();
 
 	// Performance Monitor
 	int get_pm_region_count() const { return performance_data.pm_region_count; }
@@ -213,6 +231,9 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_iteration_build_usec() const { return performance_data.pm_iteration_build_usec; }
+	int get_pm_path_cache_hit_count() const { return performance_data.pm_path_cache_hit_count; }
+	int get_pm_path_cache_miss_count() const { return performance_data.pm_path_cache_miss_count; }
 
 	int get_region_connections_count(NavRegion2D *p_region) const;
 	Vector2 get_region_connection_pathway_start(NavRegion2D *p_region, int p_connection_id) const;
@@ -231,7 +252,12 @@ public:
 	void set_use_async_iterations(bool p_enabled);
 	bool get_use_async_iterations() const;
 
+	void set_path_cache_size(int p_size);
+	int get_path_cache_size() const;
+
 private:
+	void _process_queued_path_query(uint32_t p_index, NavMeshQueries2D::NavMeshPathQueryTask2D **p_query_task);
+
 	void _sync_dirty_map_update_requests();
 	void _sync_dirty_avoidance_update_requests();
 
@@ -242,7 +268,6 @@ private:
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree();
-	void _update_rvo_agents_tree();
 
 	void _update_merge_rasterizer_cell_dimensions();
 };
@@ -51,6 +51,8 @@ class NavRegion2D : public NavBase2D {
 	bool polygons_dirty = true;
 
 	LocalVector<Nav2D::Polygon> navmesh_polygons;
+	LocalVector<Nav2D::RegionEdgeConnectionPair> edge_connection_pairs;
+	LocalVector<Nav2D::RegionEdge> free_edges;
 
 	real_t surface_area = 0.0;
 	Rect2 bounds;
@@ -30,9 +30,12 @@
 
 #pragma once
 
+#include "core/math/rect2.h"
 #include "core/math/vector3.h"
+#include "core/os/mutex.h"
 #include "core/templates/hash_map.h"
 #include "core/templates/hashfuncs.h"
+#include "core/templates/safe_refcount.h"
 #include "servers/navigation/nav_heap.h"
 #include "servers/navigation/navigation_utilities.h"
 
@@ -106,6 +109,26 @@ struct Polygon {
 	real_t surface_area = 0.0;
 };
 
+/// Node of the bounding volume hierarchy over the region polygons of a map, stored depth-first.
+struct PolygonBVHNode {
+	Rect2 rect;
+
+	/// Index of the second child for internal nodes, of the first polygon for leaves.
+	uint32_t index = 0;
+
+	/// Number of polygons in a leaf, zero for internal nodes.
+	uint32_t polygon_count = 0;
+};
+
+/// Group of neighboring polygons, a node of the coarse graph searched by hierarchical path queries.
+struct PolygonCluster {
+	Vector2 center;
+
+	/// Range of the neighbor clusters in the cluster neighbor list of the map.
+	uint32_t neighbor_index = 0;
+	uint32_t neighbor_count = 0;
+};
+
 struct NavigationPoly {
 	/// This poly.
 	const Polygon *poly = nullptr;
@@ -171,6 +194,132 @@ struct NavPolyHeapIndexer {
 	}
 };
 
+struct NavigationCluster {
+	/// The previous cluster on the coarse route.
+	int back_navigation_cluster_id = -1;
+	/// The distance traveled between cluster centers until now.
+	real_t traveled_distance = 0.0;
+	/// The query pass in which this cluster was last part of a cluster corridor.
+	uint32_t corridor_pass = 0;
+};
+
+struct NavClusterCost {
+	uint32_t cluster_id = 0;
+	real_t traveled_distance = 0.0;
+	real_t total_travel_cost = 0.0;
+};
+
+struct NavClusterCostGreaterThan {
+	bool operator()(const NavClusterCost &p_a, const NavClusterCost &p_b) const {
+		return p_a.total_travel_cost > p_b.total_travel_cost;
+	}
+};
+
+/// Identifies the path corridors that can be shared by path queries, the map iteration owns the cache.
+struct PathCorridorKey {
+	uint32_t begin_polygon_id = UINT32_MAX;
+	uint32_t end_polygon_id = UINT32_MAX;
+	uint32_t navigation_layers = 0;
+	NavigationUtilities::PathfindingAlgorithm pathfinding_algorithm = NavigationUtilities::PathfindingAlgorithm::PATHFINDING_ALGORITHM_ASTAR;
+	bool exclude_regions = false;
+	bool include_regions = false;
+	LocalVector<RID> excluded_regions;
+	LocalVector<RID> included_regions;
+
+	static uint32_t hash(const PathCorridorKey &p_val) {
+		uint32_t h = hash_murmur3_one_32(p_val.begin_polygon_id);
+		h = hash_murmur3_one_32(p_val.end_polygon_id, h);
+		h = hash_murmur3_one_32(p_val.navigation_layers, h);
+		h = hash_murmur3_one_32(p_val.pathfinding_algorithm, h);
+		h = hash_murmur3_one_32((p_val.exclude_regions ? 1 : 0) | (p_val.include_regions ? 2 : 0), h);
+		for (const RID &rid : p_val.excluded_regions) {
+			h = hash_murmur3_one_64(rid.get_id(), h);
+		}
+		for (const RID &rid : p_val.included_regions) {
+			h = hash_murmur3_one_64(rid.get_id(), h);
+		}
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const PathCorridorKey &p_key) const {
+		if (begin_polygon_id != p_key.begin_polygon_id || end_polygon_id != p_key.end_polygon_id || navigation_layers != p_key.navigation_layers || pathfinding_algorithm != p_key.pathfinding_algorithm) {
+			return false;
+		}
+		if (exclude_regions != p_key.exclude_regions || include_regions != p_key.include_regions || excluded_regions.size() != p_key.excluded_regions.size() || included_regions.size() != p_key.included_regions.size()) {
+			return false;
+		}
+		for (uint32_t i = 0; i < excluded_regions.size(); i++) {
+			if (excluded_regions[i] != p_key.excluded_regions[i]) {
+				return false;
+			}
+		}
+		for (uint32_t i = 0; i < included_regions.size(); i++) {
+			if (included_regions[i] != p_key.included_regions[i]) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+struct PathCorridorCacheEntry {
+	/// The corridor polygons from the end polygon back to, but without, the begin polygon.
+	LocalVector<NavigationPoly> corridor;
+	uint64_t last_used = 0;
+};
+
+struct FlowFieldPolygon {
+	/// The travel cost from the exit position to the destination, `FLT_MAX` if the destination is unreachable.
+	real_t travel_cost = FLT_MAX;
+	/// The position where agents leave this polygon toward the destination.
+	Vector2 exit;
+	/// The next polygon toward the destination, UINT32_MAX for the destination polygon.
+	uint32_t next_polygon_id = UINT32_MAX;
+};
+
+struct FlowFieldKey {
+	Vector2 destination;
+	uint32_t navigation_layers = 0;
+
+	static uint32_t hash(const FlowFieldKey &p_val) {
+		uint32_t h = hash_murmur3_one_real(p_val.destination.x);
+		h = hash_murmur3_one_real(p_val.destination.y, h);
+		h = hash_murmur3_one_32(p_val.navigation_layers, h);
+		return hash_fmix32(h);
+	}
+
+	bool operator==(const FlowFieldKey &p_key) const {
+		return destination == p_key.destination && navigation_layers == p_key.navigation_layers;
+	}
+};
+
+/// Travel costs from every polygon of a map iteration toward a single destination.
+struct FlowField {
+	Vector2 destination;
+	uint32_t navigation_layers = 0;
+
+	uint32_t end_polygon_id = UINT32_MAX;
+	LocalVector<FlowFieldPolygon> polygons;
+
+	/// Held while the field is built, so that queries of the same field wait for it without blocking the other fields.
+	Mutex build_mutex;
+	SafeFlag built;
+	/// Owned by the map iteration cache and by the queries using the field.
+	SafeRefCount refcount;
+	SafeNumeric<uint64_t> last_used;
+};
+
+struct FlowFieldCost {
+	uint32_t polygon_id = 0;
+	real_t travel_cost = 0.0;
+};
+
+struct FlowFieldCostGreaterThan {
+	bool operator()(const FlowFieldCost &p_a, const FlowFieldCost &p_b) const {
+		return p_a.travel_cost > p_b.travel_cost;
+	}
+};
+
 struct ClosestPointQueryResult {
 	Vector2 point;
 	RID owner;
@@ -181,6 +330,18 @@ struct EdgeConnectionPair {
 	int size = 0;
 };
 
+/// Polygon edge of a region, addressed by the index of its polygon in the region.
+struct RegionEdge {
+	EdgeKey key;
+	uint32_t polygon = 0;
+	uint32_t edge = 0;
+};
+
+/// Pair of region polygon edges that share the same edge key and are merged within the region.
+struct RegionEdgeConnectionPair {
+	RegionEdge edges[2];
+};
+
 struct PerformanceData {
 	int pm_region_count = 0;
 	int pm_agent_count = 0;
@@ -191,6 +352,9 @@ struct PerformanceData {
 	int pm_edge_connection_count = 0;
 	int pm_edge_free_count = 0;
 	int pm_obstacle_count = 0;
+	int pm_iteration_build_usec = 0;
+	int pm_path_cache_hit_count = 0;
+	int pm_path_cache_miss_count = 0;
 
 	void reset() {
 		pm_region_count = 0;
@@ -202,6 +366,9 @@ struct PerformanceData {
 		pm_edge_connection_count = 0;
 		pm_edge_free_count = 0;
 		pm_obstacle_count = 0;
+		pm_iteration_build_usec = 0;
+		pm_path_cache_hit_count = 0;
+		pm_path_cache_miss_count = 0;
 	}
 };
 
@@ -259,6 +259,13 @@ Vector<Vector3> GodotNavigationServer3D::map_get_path(RID p_map, Vector3 p_origi
 	return query_result->get_path();
 }
 
+Vector3 GodotNavigationServer3D::map_get_flow_field_next_position(RID p_map, const Vector3 &p_origin, const Vector3 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, p_origin);
+
+	return map->get_flow_field_next_position(p_origin, p_destination, p_navigation_layers, p_desired_distance);
+}
+
 Vector3 GodotNavigationServer3D::map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector3());
@@ -374,6 +381,19 @@ bool GodotNavigationServer3D::map_get_use_async_iterations(RID p_map) const {
 	return map->get_use_async_iterations();
 }
 
+COMMAND_2(map_set_path_cache_size, RID, p_map, int, p_size) {
+	NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL(map);
+	map->set_path_cache_size(p_size);
+}
+
+int GodotNavigationServer3D::map_get_path_cache_size(RID p_map) const {
+	const NavMap3D *map = map_owner.get_or_null(p_map);
+	ERR_FAIL_NULL_V(map, 0);
+
+	return map->get_path_cache_size();
+}
+
 Vector3 GodotNavigationServer3D::map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const {
 	const NavMap3D *map = map_owner.get_or_null(p_map);
 	ERR_FAIL_NULL_V(map, Vector3());
@@ -1202,6 +1222,22 @@ void GodotNavigationServer3D::bake_from_source_geometry_data_async(const Ref<Nav
 	NavMeshGenerator3D::get_singleton()->bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
 }
 
+void GodotNavigationServer3D::rebake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->rebake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+}
+
+void GodotNavigationServer3D::rebake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND_MSG(p_navigation_mesh.is_null(), "Invalid navigation mesh.");
+	ERR_FAIL_COND_MSG(p_source_geometry_data.is_null(), "Invalid NavigationMeshSourceGeometryData3D.");
+
+	ERR_FAIL_NULL(NavMeshGenerator3D::get_singleton());
+	NavMeshGenerator3D::get_singleton()->rebake_tiles_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+}
+
 bool GodotNavigationServer3D::is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const {
 	return NavMeshGenerator3D::get_singleton()->is_baking(p_navigation_mesh);
 }
@@ -1382,12 +1418,16 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	int _new_pm_edge_connection_count = 0;
 	int _new_pm_edge_free_count = 0;
 	int _new_pm_obstacle_count = 0;
+	int _new_pm_iteration_build_usec = 0;
+	int _new_pm_path_cache_hit_count = 0;
+	int _new_pm_path_cache_miss_count = 0;
 
 	MutexLock lock(operations_mutex);
 	for (uint32_t i(0); i < active_maps.size(); i++) {
 		active_maps[i]->sync();
 		active_maps[i]->step(p_delta_time);
 		active_maps[i]->dispatch_callbacks();
+		active_maps[i]->process_path_query_queue();
 
 		_new_pm_region_count += active_maps[i]->get_pm_region_count();
 		_new_pm_agent_count += active_maps[i]->get_pm_agent_count();
@@ -1398,6 +1438,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 		_new_pm_edge_connection_count += active_maps[i]->get_pm_edge_connection_count();
 		_new_pm_edge_free_count += active_maps[i]->get_pm_edge_free_count();
 		_new_pm_obstacle_count += active_maps[i]->get_pm_obstacle_count();
+		_new_pm_iteration_build_usec += active_maps[i]->get_pm_iteration_build_usec();
+		_new_pm_path_cache_hit_count += active_maps[i]->get_pm_path_cache_hit_count();
+		_new_pm_path_cache_miss_count += active_maps[i]->get_pm_path_cache_miss_count();
 	}
 
 	pm_region_count = _new_pm_region_count;
@@ -1409,6 +1452,9 @@ void GodotNavigationServer3D::physics_process(double p_delta_time) {
 	pm_edge_connection_count = _new_pm_edge_connection_count;
 	pm_edge_free_count = _new_pm_edge_free_count;
 	pm_obstacle_count = _new_pm_obstacle_count;
+	pm_iteration_build_usec = _new_pm_iteration_build_usec;
+	pm_path_cache_hit_count = _new_pm_path_cache_hit_count;
+	pm_path_cache_miss_count = _new_pm_path_cache_miss_count;
 }
 
 void GodotNavigationServer3D::init() {
@@ -1436,6 +1482,16 @@ void GodotNavigationServer3D::query_path(const Ref<NavigationPathQueryParameters
 	NavMeshQueries3D::map_query_path(map, p_query_parameters, p_query_result, p_callback);
 }
 
+void GodotNavigationServer3D::query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback) {
+	ERR_FAIL_COND(p_query_parameters.is_null());
+	ERR_FAIL_COND(p_query_result.is_null());
+
+	NavMap3D *map = map_owner.get_or_null(p_query_parameters->get_map());
+	ERR_FAIL_NULL(map);
+
+	NavMeshQueries3D::map_query_path_async(map, p_query_parameters, p_query_result, p_callback);
+}
+
 RID GodotNavigationServer3D::source_geometry_parser_create() {
 	RWLockWrite write_lock(geometry_parser_rwlock);
 
@@ -1523,6 +1579,15 @@ int GodotNavigationServer3D::get_process_info(ProcessInfo p_info) const {
 		case INFO_OBSTACLE_COUNT: {
 			return pm_obstacle_count;
 		} break;
+		case INFO_ITERATION_BUILD_TIME: {
+			return pm_iteration_build_usec;
+		} break;
+		case INFO_PATH_CACHE_HIT_COUNT: {
+			return pm_path_cache_hit_count;
+		} break;
+		case INFO_PATH_CACHE_MISS_COUNT: {
+			return pm_path_cache_miss_count;
+		} break;
 	}
 
 	return 0;
@@ -0,0 +1,333 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.cpp                                             */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#include "nav_avoidance_grid_3d.h"
+
+#include "../nav_agent_3d.h"
+
+// Same sorted insertion as Agent2D/3D::insertAgentNeighbor().
+template <typename TAgent>
+static _FORCE_INLINE_ void _insert_agent_neighbor(std::vector<std::pair<float, const TAgent *>> &r_neighbors, size_t p_max_neighbors, const TAgent *p_neighbor, float p_distance_sq, float &r_range_sq) {
+	if (r_neighbors.size() < p_max_neighbors) {
+		r_neighbors.push_back(std::make_pair(p_distance_sq, p_neighbor));
+	}
+
+	size_t i = r_neighbors.size() - 1;
+	while (i != 0 && p_distance_sq < r_neighbors[i - 1].first) {
+		r_neighbors[i] = r_neighbors[i - 1];
+		--i;
+	}
+	r_neighbors[i] = std::make_pair(p_distance_sq, p_neighbor);
+
+	if (r_neighbors.size() == p_max_neighbors) {
+		r_range_sq = r_neighbors.back().first;
+	}
+}
+
+float NavAvoidanceGrid3D::_get_cell_size(float p_neighbor_distance, float p_volume, uint32_t p_agent_count, uint32_t p_dimensions) {
+	// Cells are sized to hold a few agents when the agents are dense so the
+	// queries fill up their neighbors from the nearest cells, and are never
+	// larger than the neighbor distance so sparse queries stay local.
+	const float dense_cell_size = Math::pow(p_volume * AGENTS_PER_CELL / p_agent_count, 1.0f / p_dimensions);
+	return MAX(CLAMP(dense_cell_size, p_neighbor_distance * 0.1f, p_neighbor_distance), 0.1f);
+}
+
+void NavAvoidanceGrid3D::_build_buckets(uint32_t p_agent_count) {
+	const uint32_t bucket_count = next_power_of_2(MAX(p_agent_count, 1u));
+	bucket_mask = bucket_count - 1;
+	bucket_offsets.resize(bucket_count + 1);
+	for (uint32_t &offset : bucket_offsets) {
+		offset = 0;
+	}
+
+	agent_cells.resize(p_agent_count);
+	agent_slots.resize(p_agent_count);
+	cells.resize(p_agent_count);
+	positions_x.resize(p_agent_count);
+	positions_y.resize(p_agent_count);
+	priorities.resize(p_agent_count);
+	avoidance_layers.resize(p_agent_count);
+}
+
+void NavAvoidanceGrid3D::_sort_agents(uint32_t p_agent_count) {
+	for (uint32_t i = 0; i < p_agent_count; i++) {
+		agent_slots[i] = _get_bucket(agent_cells[i]);
+		bucket_offsets[agent_slots[i]]++;
+	}
+
+	const uint32_t bucket_count = bucket_mask + 1;
+	for (uint32_t i = 1; i < bucket_count; i++) {
+		bucket_offsets[i] += bucket_offsets[i - 1];
+	}
+
+	// Walking backwards turns the bucket ends into bucket starts and keeps the
+	// agents of a bucket in their original order.
+	for (uint32_t i = p_agent_count; i-- > 0;) {
+		agent_slots[i] = --bucket_offsets[agent_slots[i]];
+	}
+	bucket_offsets[bucket_count] = p_agent_count;
+}
+
+void NavAvoidanceGrid3D::build_2d(const LocalVector<NavAgent3D *> &p_agents) {
+	use_3d = false;
+	const uint32_t agent_count = p_agents.size();
+	if (agent_count == 0) {
+		agents_2d.clear();
+		return;
+	}
+
+	float neighbor_distance_sum = 0.0;
+	Rect2 bounds(Vector2(p_agents[0]->get_rvo_agent_2d()->position_.x(), p_agents[0]->get_rvo_agent_2d()->position_.y()), Vector2());
+	for (NavAgent3D *agent : p_agents) {
+		const RVO2D::Agent2D *rvo_agent = agent->get_rvo_agent_2d();
+		neighbor_distance_sum += rvo_agent->neighborDist_;
+		bounds.expand_to(Vector2(rvo_agent->position_.x(), rvo_agent->position_.y()));
+	}
+	const float neighbor_distance = neighbor_distance_sum / agent_count;
+	const float area = MAX(float(bounds.size.x), neighbor_distance) * MAX(float(bounds.size.y), neighbor_distance);
+	cell_size = _get_cell_size(neighbor_distance, area, agent_count, 2);
+
+	_build_buckets(agent_count);
+	agents_2d.resize(agent_count);
+	elevations.resize(agent_count);
+	heights.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO2D::Vector2 &position = p_agents[i]->get_rvo_agent_2d()->position_;
+		agent_cells[i] = _get_cell(position.x(), position.y(), 0.0);
+	}
+	_sort_agents(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		RVO2D::Agent2D *rvo_agent = p_agents[i]->get_rvo_agent_2d();
+		const uint32_t slot = agent_slots[i];
+		agents_2d[slot] = rvo_agent;
+		cells[slot] = agent_cells[i];
+		positions_x[slot] = rvo_agent->position_.x();
+		positions_y[slot] = rvo_agent->position_.y();
+		elevations[slot] = rvo_agent->elevation_;
+		heights[slot] = rvo_agent->height_;
+		priorities[slot] = rvo_agent->avoidance_priority_;
+		avoidance_layers[slot] = rvo_agent->avoidance_layers_;
+	}
+}
+
+void NavAvoidanceGrid3D::build_3d(const LocalVector<NavAgent3D *> &p_agents) {
+	use_3d = true;
+	const uint32_t agent_count = p_agents.size();
+	if (agent_count == 0) {
+		agents_3d.clear();
+		return;
+	}
+
+	float neighbor_distance_sum = 0.0;
+	AABB bounds(Vector3(p_agents[0]->get_rvo_agent_3d()->position_.x(), p_agents[0]->get_rvo_agent_3d()->position_.y(), p_agents[0]->get_rvo_agent_3d()->position_.z()), Vector3());
+	for (NavAgent3D *agent : p_agents) {
+		const RVO3D::Agent3D *rvo_agent = agent->get_rvo_agent_3d();
+		neighbor_distance_sum += rvo_agent->neighborDist_;
+		bounds.expand_to(Vector3(rvo_agent->position_.x(), rvo_agent->position_.y(), rvo_agent->position_.z()));
+	}
+	const float neighbor_distance = neighbor_distance_sum / agent_count;
+	const float volume = MAX(float(bounds.size.x), neighbor_distance) * MAX(float(bounds.size.y), neighbor_distance) * MAX(float(bounds.size.z), neighbor_distance);
+	cell_size = _get_cell_size(neighbor_distance, volume, agent_count, 3);
+
+	_build_buckets(agent_count);
+	agents_3d.resize(agent_count);
+	positions_z.resize(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		const RVO3D::Vector3 &position = p_agents[i]->get_rvo_agent_3d()->position_;
+		agent_cells[i] = _get_cell(position.x(), position.y(), position.z());
+	}
+	_sort_agents(agent_count);
+
+	for (uint32_t i = 0; i < agent_count; i++) {
+		RVO3D::Agent3D *rvo_agent = p_agents[i]->get_rvo_agent_3d();
+		const uint32_t slot = agent_slots[i];
+		agents_3d[slot] = rvo_agent;
+		cells[slot] = agent_cells[i];
+		positions_x[slot] = rvo_agent->position_.x();
+		positions_y[slot] = rvo_agent->position_.y();
+		positions_z[slot] = rvo_agent->position_.z();
+		priorities[slot] = rvo_agent->avoidance_priority_;
+		avoidance_layers[slot] = rvo_agent->avoidance_layers_;
+	}
+}
+
+void NavAvoidanceGrid3D::_query_agents_2d(RVO2D::Agent2D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector3i *p_cell, float &r_range_sq) const {
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		const float dx = positions_x[i] - x;
+		const float dy = positions_y[i] - y;
+		const float distance_sq = dx * dx + dy * dy;
+		// Buckets can hold agents of other cells that share the same hash.
+		if (distance_sq >= r_range_sq || (p_cell && cells[i] != *p_cell)) {
+			continue;
+		}
+
+		// Same filtering as Agent2D::insertAgentNeighbor().
+		if (agents_2d[i] == p_agent || (p_agent->avoidance_mask_ & avoidance_layers[i]) == 0) {
+			continue;
+		}
+		if (p_agent->elevation_ > elevations[i] + heights[i] || p_agent->elevation_ + p_agent->height_ < elevations[i]) {
+			continue;
+		}
+		if (p_agent->avoidance_priority_ > priorities[i]) {
+			continue;
+		}
+
+		_insert_agent_neighbor<RVO2D::Agent2D>(p_agent->agentNeighbors_, p_agent->maxNeighbors_, agents_2d[i], distance_sq, r_range_sq);
+	}
+}
+
+void NavAvoidanceGrid3D::_query_agents_3d(RVO3D::Agent3D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector3i *p_cell, float &r_range_sq) const {
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	const float z = p_agent->position_.z();
+
+	for (uint32_t i = p_begin; i < p_end; i++) {
+		const float dx = positions_x[i] - x;
+		const float dy = positions_y[i] - y;
+		const float dz = positions_z[i] - z;
+		const float distance_sq = dx * dx + dy * dy + dz * dz;
+		// Buckets can hold agents of other cells that share the same hash.
+		if (distance_sq >= r_range_sq || (p_cell && cells[i] != *p_cell)) {
+			continue;
+		}
+
+		// Same filtering as Agent3D::insertAgentNeighbor().
+		if (agents_3d[i] == p_agent || (p_agent->avoidance_mask_ & avoidance_layers[i]) == 0) {
+			continue;
+		}
+		if (p_agent->avoidance_priority_ > priorities[i]) {
+			continue;
+		}
+
+		_insert_agent_neighbor<RVO3D::Agent3D>(p_agent->agentNeighbors_, p_agent->maxNeighbors_, agents_3d[i], distance_sq, r_range_sq);
+	}
+}
+
+float NavAvoidanceGrid3D::_get_cell_distance_sq(const Vector3i &p_cell, float p_x, float p_y, float p_z) const {
+	const float dx = MAX(MAX(p_cell.x * cell_size - p_x, p_x - (p_cell.x + 1) * cell_size), 0.0f);
+	const float dy = MAX(MAX(p_cell.y * cell_size - p_y, p_y - (p_cell.y + 1) * cell_size), 0.0f);
+	const float dz = MAX(MAX(p_cell.z * cell_size - p_z, p_z - (p_cell.z + 1) * cell_size), 0.0f);
+	return dx * dx + dy * dy + dz * dz;
+}
+
+void NavAvoidanceGrid3D::compute_agent_neighbors_2d(RVO2D::Agent2D *p_agent) const {
+	p_agent->agentNeighbors_.clear();
+
+	if (p_agent->maxNeighbors_ == 0 || use_3d || agents_2d.is_empty()) {
+		return;
+	}
+
+	const float range = p_agent->neighborDist_;
+	float range_sq = range * range;
+
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	const Vector3i center = _get_cell(x, y, 0.0);
+	const int64_t ring_count = int64_t(Math::ceil(range / cell_size));
+
+	if ((2 * ring_count + 1) * (2 * ring_count + 1) >= int64_t(agents_2d.size())) {
+		// Looking up that many cells costs more than testing every agent.
+		_query_agents_2d(p_agent, 0, agents_2d.size(), nullptr, range_sq);
+		return;
+	}
+
+	// Visit the cells ring by ring around the agent so the closest agents are
+	// found first and the shrinking range can skip the outer rings.
+	for (int32_t ring = 0; ring <= ring_count; ring++) {
+		const float ring_distance = (ring - 1) * cell_size;
+		if (ring > 1 && ring_distance * ring_distance >= range_sq) {
+			break;
+		}
+		for (int32_t offset_y = -ring; offset_y <= ring; offset_y++) {
+			const int32_t step_x = (offset_y == -ring || offset_y == ring) ? 1 : 2 * ring;
+			for (int32_t offset_x = -ring; offset_x <= ring; offset_x += step_x) {
+				const Vector3i cell(center.x + offset_x, center.y + offset_y, 0);
+				if (_get_cell_distance_sq(cell, x, y, 0.0) >= range_sq) {
+					continue;
+				}
+				const uint32_t bucket = _get_bucket(cell);
+				_query_agents_2d(p_agent, bucket_offsets[bucket], bucket_offsets[bucket + 1], &cell, range_sq);
+			}
+		}
+	}
+}
+
+void NavAvoidanceGrid3D::compute_agent_neighbors_3d(RVO3D::Agent3D *p_agent) const {
+	p_agent->agentNeighbors_.clear();
+
+	if (p_agent->maxNeighbors_ == 0 || !use_3d || agents_3d.is_empty()) {
+		return;
+	}
+
+	const float range = p_agent->neighborDist_;
+	float range_sq = range * range;
+
+	const float x = p_agent->position_.x();
+	const float y = p_agent->position_.y();
+	const float z = p_agent->position_.z();
+	const Vector3i center = _get_cell(x, y, z);
+	const int64_t ring_count = int64_t(Math::ceil(range / cell_size));
+
+	if ((2 * ring_count + 1) * (2 * ring_count + 1) * (2 * ring_count + 1) >= int64_t(agents_3d.size())) {
+		// Looking up that many cells costs more than testing every agent.
+		_query_agents_3d(p_agent, 0, agents_3d.size(), nullptr, range_sq);
+		return;
+	}
+
+	// Visit the cells shell by shell around the agent so the closest agents
+	// are found first and the shrinking range can skip the outer shells.
+	for (int32_t ring = 0; ring <= ring_count; ring++) {
+		const float ring_distance = (ring - 1) * cell_size;
+		if (ring > 1 && ring_distance * ring_distance >= range_sq) {
+			break;
+		}
+		for (int32_t offset_z = -ring; offset_z <= ring; offset_z++) {
+			const bool outer_z = offset_z == -ring || offset_z == ring;
+			for (int32_t offset_y = -ring; offset_y <= ring; offset_y++) {
+				const int32_t step_x = (outer_z || offset_y == -ring || offset_y == ring) ? 1 : 2 * ring;
+				for (int32_t offset_x = -ring; offset_x <= ring; offset_x += step_x) {
+					const Vector3i cell(center.x + offset_x, center.y + offset_y, center.z + offset_z);
+					if (_get_cell_distance_sq(cell, x, y, z) >= range_sq) {
+						continue;
+					}
+					const uint32_t bucket = _get_bucket(cell);
+					_query_agents_3d(p_agent, bucket_offsets[bucket], bucket_offsets[bucket + 1], &cell, range_sq);
+				}
+			}
+		}
+	}
+}
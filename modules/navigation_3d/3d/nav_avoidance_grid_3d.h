@@ -0,0 +1,96 @@
+/**************************************************************************/
+/*  nav_avoidance_grid_3d.h                                               */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "core/math/aabb.h"
+#include "core/math/rect2.h"
+#include "core/math/vector3i.h"
+#include "core/templates/local_vector.h"
+
+#include <Agent2d.h>
+#include <Agent3d.h>
+
+class NavAgent3D;
+
+// Uniform grid used to find the agent neighbors of the avoidance agents.
+// The agents are bucketed by their grid cell with a counting sort and their
+// avoidance data is copied into flat arrays in bucket order, so a neighbor
+// query reads a few contiguous ranges instead of walking a tree of agents.
+class NavAvoidanceGrid3D {
+	static constexpr float AGENTS_PER_CELL = 8.0;
+
+	bool use_3d = false;
+	float cell_size = 1.0;
+	uint32_t bucket_mask = 0;
+
+	// Start of each bucket in the sorted arrays, with the agent count appended.
+	LocalVector<uint32_t> bucket_offsets;
+
+	LocalVector<RVO2D::Agent2D *> agents_2d;
+	LocalVector<RVO3D::Agent3D *> agents_3d;
+	LocalVector<Vector3i> cells;
+	LocalVector<float> positions_x;
+	LocalVector<float> positions_y;
+	LocalVector<float> positions_z;
+	LocalVector<float> elevations;
+	LocalVector<float> heights;
+	LocalVector<float> priorities;
+	LocalVector<uint32_t> avoidance_layers;
+
+	// Scratch data of the last build, in agent order.
+	LocalVector<Vector3i> agent_cells;
+	LocalVector<uint32_t> agent_slots;
+
+	_FORCE_INLINE_ Vector3i _get_cell(float p_x, float p_y, float p_z) const {
+		return Vector3i(int32_t(Math::floor(p_x / cell_size)), int32_t(Math::floor(p_y / cell_size)), int32_t(Math::floor(p_z / cell_size)));
+	}
+	_FORCE_INLINE_ uint32_t _get_bucket(const Vector3i &p_cell) const {
+		return ((uint32_t(p_cell.x) * 73856093u) ^ (uint32_t(p_cell.y) * 19349663u) ^ (uint32_t(p_cell.z) * 83492791u)) & bucket_mask;
+	}
+
+	static float _get_cell_size(float p_neighbor_distance, float p_volume, uint32_t p_agent_count, uint32_t p_dimensions);
+	float _get_cell_distance_sq(const Vector3i &p_cell, float p_x, float p_y, float p_z) const;
+
+	void _build_buckets(uint32_t p_agent_count);
+	void _sort_agents(uint32_t p_agent_count);
+	void _query_agents_2d(RVO2D::Agent2D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector3i *p_cell, float &r_range_sq) const;
+	void _query_agents_3d(RVO3D::Agent3D *p_agent, uint32_t p_begin, uint32_t p_end, const Vector3i *p_cell, float &r_range_sq) const;
+
+public:
+	void build_2d(const LocalVector<NavAgent3D *> &p_agents);
+	void build_3d(const LocalVector<NavAgent3D *> &p_agents);
+
+	// Replace the agent neighbors of the agent like Agent2D/3D::computeNeighbors().
+	// Safe to call from multiple threads for different agents once built.
+	void compute_agent_neighbors_2d(RVO2D::Agent2D *p_agent) const;
+	void compute_agent_neighbors_3d(RVO3D::Agent3D *p_agent) const;
+};
@@ -36,14 +36,17 @@ struct NavMapIterationBuild3D;
 
 class NavMapBuilder3D {
 	static void _build_step_gather_region_polygons(NavMapIterationBuild3D &r_build);
+	static void _build_step_polygon_bvh(NavMapIterationBuild3D &r_build);
 	static void _build_step_find_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_merge_edge_connection_pairs(NavMapIterationBuild3D &r_build);
 	static void _build_step_edge_connection_margin_connections(NavMapIterationBuild3D &r_build);
 	static void _build_step_navlink_connections(NavMapIterationBuild3D &r_build);
+	static void _build_step_polygon_clusters(NavMapIterationBuild3D &r_build);
 	static void _build_update_map_iteration(NavMapIterationBuild3D &r_build);
 
 public:
 	static Nav3D::PointKey get_point_key(const Vector3 &p_pos, const Vector3 &p_cell_size);
 
 	static void build_navmap_iteration(NavMapIterationBuild3D &r_build);
+	static void build_region_edges(const LocalVector<Nav3D::Polygon> &p_polygons, const Vector3 &p_cell_size, LocalVector<Nav3D::RegionEdgeConnectionPair> &r_edge_connection_pairs, LocalVector<Nav3D::RegionEdge> &r_free_edges);
 };
@@ -210,6 +210,68 @@ void NavMeshGenerator3D::bake_from_source_geometry_data_async(Ref<NavigationMesh
 	generator_tasks.insert(generator_task->thread_task_id, generator_task);
 }
 
+void NavMeshGenerator3D::rebake_tiles_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND(p_source_geometry_data.is_null());
+
+	if (p_navigation_mesh->get_tile_size() <= 0.0 || !p_source_geometry_data->has_data()) {
+		bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_callback);
+		return;
+	}
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+	}
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.insert(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	generator_bake_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, &p_dirty_aabb);
+
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.erase(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	if (p_callback.is_valid()) {
+		generator_emit_callback(p_callback);
+	}
+
+	p_navigation_mesh->emit_changed();
+}
+
+void NavMeshGenerator3D::rebake_tiles_from_source_geometry_data_async(Ref<NavigationMesh> p_navigation_mesh, Ref<NavigationMeshSourceGeometryData3D> p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback) {
+	ERR_FAIL_COND(p_navigation_mesh.is_null());
+	ERR_FAIL_COND(p_source_geometry_data.is_null());
+
+	if (p_navigation_mesh->get_tile_size() <= 0.0 || !p_source_geometry_data->has_data()) {
+		bake_from_source_geometry_data_async(p_navigation_mesh, p_source_geometry_data, p_callback);
+		return;
+	}
+
+	if (!use_threads) {
+		rebake_tiles_from_source_geometry_data(p_navigation_mesh, p_source_geometry_data, p_dirty_aabb, p_callback);
+		return;
+	}
+
+	if (is_baking(p_navigation_mesh)) {
+		ERR_FAIL_MSG("NavigationMesh is already baking. Wait for current bake to finish.");
+	}
+	baking_navmesh_mutex.lock();
+	baking_navmeshes.insert(p_navigation_mesh);
+	baking_navmesh_mutex.unlock();
+
+	MutexLock generator_task_lock(generator_task_mutex);
+	NavMeshGeneratorTask3D *generator_task = memnew(NavMeshGeneratorTask3D);
+	generator_task->navigation_mesh = p_navigation_mesh;
+	generator_task->source_geometry_data = p_source_geometry_data;
+	generator_task->callback = p_callback;
+	generator_task->rebake_tiles = true;
+	generator_task->rebake_aabb = p_dirty_aabb;
+	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_STARTED;
+	generator_task->thread_task_id = WorkerThreadPool::get_singleton()->add_native_task(&NavMeshGenerator3D::generator_thread_bake, generator_task, NavMeshGenerator3D::baking_use_high_priority_threads, SNAME("NavMeshGeneratorBake3D"));
+	generator_tasks.insert(generator_task->thread_task_id, generator_task);
+}
+
 bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 	MutexLock baking_navmesh_lock(baking_navmesh_mutex);
 	return baking_navmeshes.has(p_navigation_mesh);
@@ -218,7 +280,7 @@ bool NavMeshGenerator3D::is_baking(Ref<NavigationMesh> p_navigation_mesh) {
 void NavMeshGenerator3D::generator_thread_bake(void *p_arg) {
 	NavMeshGeneratorTask3D *generator_task = static_cast<NavMeshGeneratorTask3D *>(p_arg);
 
-	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data);
+	generator_bake_from_source_geometry_data(generator_task->navigation_mesh, generator_task->source_geometry_data, generator_task->rebake_tiles ? &generator_task->rebake_aabb : nullptr);
 
 	generator_task->status = NavMeshGeneratorTask3D::TaskStatus::BAKING_FINISHED;
 }
@@ -269,166 +331,132 @@ void NavMeshGenerator3D::generator_parse_source_geometry_data(const Ref<Navigati
 	}
 }
 
-void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data) {
-	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
-		return;
-	}
-
-	Vector<float> source_geometry_vertices;
-	Vector<int> source_geometry_indices;
-	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
-
-	p_source_geometry_data->get_data(
-			source_geometry_vertices,
-			source_geometry_indices,
-			projected_obstructions);
-
-	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
-		return;
-	}
-
-	rcHeightfield *hf = nullptr;
-	rcCompactHeightfield *chf = nullptr;
-	rcContourSet *cset = nullptr;
-	rcPolyMesh *poly_mesh = nullptr;
-	rcPolyMeshDetail *detail_mesh = nullptr;
-	rcContext ctx;
-
-	// added to keep track of steps, no functionality right now
-	String bake_state = "";
-
-	bake_state = "Setting up Configuration..."; // step #1
-
-	const float *verts = source_geometry_vertices.ptr();
-	const int nverts = source_geometry_vertices.size() / 3;
-	const int *tris = source_geometry_indices.ptr();
-	const int ntris = source_geometry_indices.size() / 3;
-
-	float bmin[3], bmax[3];
-	rcCalcBounds(verts, nverts, bmin, bmax);
-
+struct NavMeshGeneratorTile3D {
+	float bmin[3];
+	float bmax[3];
+	LocalVector<int> indices;
+	Vector<Vector3> vertices;
+	Vector<Vector<int>> polygons;
+	bool failed = false;
+};
+
+struct NavMeshGeneratorTiledBake3D {
+	Ref<NavigationMesh> navigation_mesh;
 	rcConfig cfg;
-	memset(&cfg, 0, sizeof(cfg));
+	const float *verts = nullptr;
+	int nverts = 0;
+	const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> *projected_obstructions = nullptr;
+	LocalVector<NavMeshGeneratorTile3D> tiles;
+};
+
+static void generator_recast_config(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &r_cfg) {
+	memset(&r_cfg, 0, sizeof(r_cfg));
 
-	cfg.cs = p_navigation_mesh->get_cell_size();
-	cfg.ch = p_navigation_mesh->get_cell_height();
+	r_cfg.cs = p_navigation_mesh->get_cell_size();
+	r_cfg.ch = p_navigation_mesh->get_cell_height();
 	if (p_navigation_mesh->get_border_size() > 0.0) {
-		cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / cfg.cs);
-	}
-	cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
-	cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / cfg.ch);
-	cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / cfg.ch);
-	cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / cfg.cs);
-	cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
-	cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
-	cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
-	cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
-	cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
-	cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
-	cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
+		r_cfg.borderSize = (int)Math::ceil(p_navigation_mesh->get_border_size() / r_cfg.cs);
+	}
+	r_cfg.walkableSlopeAngle = p_navigation_mesh->get_agent_max_slope();
+	r_cfg.walkableHeight = (int)Math::ceil(p_navigation_mesh->get_agent_height() / r_cfg.ch);
+	r_cfg.walkableClimb = (int)Math::floor(p_navigation_mesh->get_agent_max_climb() / r_cfg.ch);
+	r_cfg.walkableRadius = (int)Math::ceil(p_navigation_mesh->get_agent_radius() / r_cfg.cs);
+	r_cfg.maxEdgeLen = (int)(p_navigation_mesh->get_edge_max_length() / p_navigation_mesh->get_cell_size());
+	r_cfg.maxSimplificationError = p_navigation_mesh->get_edge_max_error();
+	r_cfg.minRegionArea = (int)(p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size());
+	r_cfg.mergeRegionArea = (int)(p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size());
+	r_cfg.maxVertsPerPoly = (int)p_navigation_mesh->get_vertices_per_polygon();
+	r_cfg.detailSampleDist = MAX(p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance(), 0.1f);
+	r_cfg.detailSampleMaxError = p_navigation_mesh->get_cell_height() * p_navigation_mesh->get_detail_sample_max_error();
 
 	if (p_navigation_mesh->get_border_size() > 0.0 && Math::fmod(p_navigation_mesh->get_border_size(), p_navigation_mesh->get_cell_size()) != 0.0) {
 		WARN_PRINT("Property border_size is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableHeight * cfg.ch, p_navigation_mesh->get_agent_height())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableHeight * r_cfg.ch, p_navigation_mesh->get_agent_height())) {
 		WARN_PRINT("Property agent_height is ceiled to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableClimb * cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableClimb * r_cfg.ch, p_navigation_mesh->get_agent_max_climb())) {
 		WARN_PRINT("Property agent_max_climb is floored to cell_height voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.walkableRadius * cfg.cs, p_navigation_mesh->get_agent_radius())) {
+	if (!Math::is_equal_approx((float)r_cfg.walkableRadius * r_cfg.cs, p_navigation_mesh->get_agent_radius())) {
 		WARN_PRINT("Property agent_radius is ceiled to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxEdgeLen * cfg.cs, p_navigation_mesh->get_edge_max_length())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxEdgeLen * r_cfg.cs, p_navigation_mesh->get_edge_max_length())) {
 		WARN_PRINT("Property edge_max_length is rounded to cell_size voxel units and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.minRegionArea, p_navigation_mesh->get_region_min_size() * p_navigation_mesh->get_region_min_size())) {
 		WARN_PRINT("Property region_min_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
+	if (!Math::is_equal_approx((float)r_cfg.mergeRegionArea, p_navigation_mesh->get_region_merge_size() * p_navigation_mesh->get_region_merge_size())) {
 		WARN_PRINT("Property region_merge_size is converted to int and loses precision.");
 	}
-	if (!Math::is_equal_approx((float)cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
+	if (!Math::is_equal_approx((float)r_cfg.maxVertsPerPoly, p_navigation_mesh->get_vertices_per_polygon())) {
 		WARN_PRINT("Property vertices_per_polygon is converted to int and loses precision.");
 	}
 	if (p_navigation_mesh->get_cell_size() * p_navigation_mesh->get_detail_sample_distance() < 0.1f) {
 		WARN_PRINT("Property detail_sample_distance is clamped to 0.1 world units as the resulting value from multiplying with cell_size is too low.");
 	}
+}
 
-	cfg.bmin[0] = bmin[0];
-	cfg.bmin[1] = bmin[1];
-	cfg.bmin[2] = bmin[2];
-	cfg.bmax[0] = bmax[0];
-	cfg.bmax[1] = bmax[1];
-	cfg.bmax[2] = bmax[2];
-
-	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
-	if (baking_aabb.has_volume()) {
-		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
-		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
-		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
-		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
-		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
-		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
-		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
-	}
+// Runs the Recast pipeline inside the bounds of the config and converts the detail mesh to native polygons.
+static bool generator_bake_recast(const Ref<NavigationMesh> &p_navigation_mesh, rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	rcHeightfield *hf = nullptr;
+	rcCompactHeightfield *chf = nullptr;
+	rcContourSet *cset = nullptr;
+	rcPolyMesh *poly_mesh = nullptr;
+	rcPolyMeshDetail *detail_mesh = nullptr;
+	rcContext ctx;
 
-	bake_state = "Calculating grid size..."; // step #2
-	rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &cfg.width, &cfg.height);
+	rcCalcGridSize(p_cfg.bmin, p_cfg.bmax, p_cfg.cs, &p_cfg.width, &p_cfg.height);
 
 	// ~30000000 seems to be around sweetspot where Editor baking breaks
-	if ((cfg.width * cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
-		ERR_FAIL_MSG("Baking interrupted."
-					 "\nNavigationMesh baking process would likely crash the engine."
-					 "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
-					 "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
-					 "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
-					 "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
-		return;
+	if ((p_cfg.width * p_cfg.height) > 30000000 && GLOBAL_GET("navigation/baking/use_crash_prevention_checks")) {
+		ERR_FAIL_V_MSG(false, "Baking interrupted."
+							  "\nNavigationMesh baking process would likely crash the engine."
+							  "\nSource geometry is suspiciously big for the current Cell Size and Cell Height in the NavMesh Resource bake settings."
+							  "\nIf baking does not crash the engine or fail, the resulting NavigationMesh will create serious pathfinding performance issues."
+							  "\nIt is advised to increase Cell Size and/or Cell Height in the NavMesh Resource bake settings or reduce the size / scale of the source geometry."
+							  "\nIf you would like to try baking anyway, disable the 'navigation/baking/use_crash_prevention_checks' project setting.");
 	}
 
-	bake_state = "Creating heightfield..."; // step #3
 	hf = rcAllocHeightfield();
 
-	ERR_FAIL_NULL(hf);
-	ERR_FAIL_COND(!rcCreateHeightfield(&ctx, *hf, cfg.width, cfg.height, cfg.bmin, cfg.bmax, cfg.cs, cfg.ch));
+	ERR_FAIL_NULL_V(hf, false);
+	ERR_FAIL_COND_V(!rcCreateHeightfield(&ctx, *hf, p_cfg.width, p_cfg.height, p_cfg.bmin, p_cfg.bmax, p_cfg.cs, p_cfg.ch), false);
 
-	bake_state = "Marking walkable triangles..."; // step #4
 	{
 		Vector<unsigned char> tri_areas;
-		tri_areas.resize(ntris);
+		tri_areas.resize(p_ntris);
 
-		ERR_FAIL_COND(tri_areas.is_empty());
+		ERR_FAIL_COND_V(tri_areas.is_empty(), false);
 
-		memset(tri_areas.ptrw(), 0, ntris * sizeof(unsigned char));
-		rcMarkWalkableTriangles(&ctx, cfg.walkableSlopeAngle, verts, nverts, tris, ntris, tri_areas.ptrw());
+		memset(tri_areas.ptrw(), 0, p_ntris * sizeof(unsigned char));
+		rcMarkWalkableTriangles(&ctx, p_cfg.walkableSlopeAngle, p_verts, p_nverts, p_tris, p_ntris, tri_areas.ptrw());
 
-		ERR_FAIL_COND(!rcRasterizeTriangles(&ctx, verts, nverts, tris, tri_areas.ptr(), ntris, *hf, cfg.walkableClimb));
+		ERR_FAIL_COND_V(!rcRasterizeTriangles(&ctx, p_verts, p_nverts, p_tris, tri_areas.ptr(), p_ntris, *hf, p_cfg.walkableClimb), false);
 	}
 
 	if (p_navigation_mesh->get_filter_low_hanging_obstacles()) {
-		rcFilterLowHangingWalkableObstacles(&ctx, cfg.walkableClimb, *hf);
+		rcFilterLowHangingWalkableObstacles(&ctx, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_ledge_spans()) {
-		rcFilterLedgeSpans(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf);
+		rcFilterLedgeSpans(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf);
 	}
 	if (p_navigation_mesh->get_filter_walkable_low_height_spans()) {
-		rcFilterWalkableLowHeightSpans(&ctx, cfg.walkableHeight, *hf);
+		rcFilterWalkableLowHeightSpans(&ctx, p_cfg.walkableHeight, *hf);
 	}
 
-	bake_state = "Constructing compact heightfield..."; // step #5
-
 	chf = rcAllocCompactHeightfield();
 
-	ERR_FAIL_NULL(chf);
-	ERR_FAIL_COND(!rcBuildCompactHeightfield(&ctx, cfg.walkableHeight, cfg.walkableClimb, *hf, *chf));
+	ERR_FAIL_NULL_V(chf, false);
+	ERR_FAIL_COND_V(!rcBuildCompactHeightfield(&ctx, p_cfg.walkableHeight, p_cfg.walkableClimb, *hf, *chf), false);
 
 	rcFreeHeightField(hf);
 	hf = nullptr;
 
 	// Add obstacles to the source geometry. Those will be affected by e.g. agent_radius.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (projected_obstruction.carve) {
 				continue;
 			}
@@ -443,13 +471,11 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		}
 	}
 
-	bake_state = "Eroding walkable area..."; // step #6
-
-	ERR_FAIL_COND(!rcErodeWalkableArea(&ctx, cfg.walkableRadius, *chf));
+	ERR_FAIL_COND_V(!rcErodeWalkableArea(&ctx, p_cfg.walkableRadius, *chf), false);
 
 	// Carve obstacles to the eroded geometry. Those will NOT be affected by e.g. agent_radius because that step is already done.
-	if (!projected_obstructions.is_empty()) {
-		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : projected_obstructions) {
+	if (!p_projected_obstructions.is_empty()) {
+		for (const NavigationMeshSourceGeometryData3D::ProjectedObstruction &projected_obstruction : p_projected_obstructions) {
 			if (!projected_obstruction.carve) {
 				continue;
 			}
@@ -464,44 +490,33 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 		}
 	}
 
-	bake_state = "Partitioning..."; // step #7
-
 	if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_WATERSHED) {
-		ERR_FAIL_COND(!rcBuildDistanceField(&ctx, *chf));
-		ERR_FAIL_COND(!rcBuildRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildDistanceField(&ctx, *chf), false);
+		ERR_FAIL_COND_V(!rcBuildRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else if (p_navigation_mesh->get_sample_partition_type() == NavigationMesh::SAMPLE_PARTITION_MONOTONE) {
-		ERR_FAIL_COND(!rcBuildRegionsMonotone(&ctx, *chf, cfg.borderSize, cfg.minRegionArea, cfg.mergeRegionArea));
+		ERR_FAIL_COND_V(!rcBuildRegionsMonotone(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea, p_cfg.mergeRegionArea), false);
 	} else {
-		ERR_FAIL_COND(!rcBuildLayerRegions(&ctx, *chf, cfg.borderSize, cfg.minRegionArea));
+		ERR_FAIL_COND_V(!rcBuildLayerRegions(&ctx, *chf, p_cfg.borderSize, p_cfg.minRegionArea), false);
 	}
 
-	bake_state = "Creating contours..."; // step #8
-
 	cset = rcAllocContourSet();
 
-	ERR_FAIL_NULL(cset);
-	ERR_FAIL_COND(!rcBuildContours(&ctx, *chf, cfg.maxSimplificationError, cfg.maxEdgeLen, *cset));
-
-	bake_state = "Creating polymesh..."; // step #9
+	ERR_FAIL_NULL_V(cset, false);
+	ERR_FAIL_COND_V(!rcBuildContours(&ctx, *chf, p_cfg.maxSimplificationError, p_cfg.maxEdgeLen, *cset), false);
 
 	poly_mesh = rcAllocPolyMesh();
-	ERR_FAIL_NULL(poly_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMesh(&ctx, *cset, cfg.maxVertsPerPoly, *poly_mesh));
+	ERR_FAIL_NULL_V(poly_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMesh(&ctx, *cset, p_cfg.maxVertsPerPoly, *poly_mesh), false);
 
 	detail_mesh = rcAllocPolyMeshDetail();
-	ERR_FAIL_NULL(detail_mesh);
-	ERR_FAIL_COND(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, cfg.detailSampleDist, cfg.detailSampleMaxError, *detail_mesh));
+	ERR_FAIL_NULL_V(detail_mesh, false);
+	ERR_FAIL_COND_V(!rcBuildPolyMeshDetail(&ctx, *poly_mesh, *chf, p_cfg.detailSampleDist, p_cfg.detailSampleMaxError, *detail_mesh), false);
 
 	rcFreeCompactHeightfield(chf);
 	chf = nullptr;
 	rcFreeContourSet(cset);
 	cset = nullptr;
 
-	bake_state = "Converting to native navigation mesh..."; // step #10
-
-	Vector<Vector3> nav_vertices;
-	Vector<Vector<int>> nav_polygons;
-
 	HashMap<Vector3, int> recast_vertex_to_native_index;
 	LocalVector<int> recast_index_to_native_index;
 	recast_index_to_native_index.resize(detail_mesh->nverts);
@@ -514,7 +529,7 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			int new_index = recast_vertex_to_native_index.size();
 			recast_index_to_native_index[i] = new_index;
 			recast_vertex_to_native_index[vertex] = new_index;
-			nav_vertices.push_back(vertex);
+			r_vertices.push_back(vertex);
 		} else {
 			recast_index_to_native_index[i] = *existing_index_ptr;
 		}
@@ -538,20 +553,450 @@ void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<Navigation
 			nav_indices.write[1] = recast_index_to_native_index[index2];
 			nav_indices.write[2] = recast_index_to_native_index[index3];
 
-			nav_polygons.push_back(nav_indices);
+			r_polygons.push_back(nav_indices);
 		}
 	}
 
-	p_navigation_mesh->set_data(nav_vertices, nav_polygons);
-
-	bake_state = "Cleanup..."; // step #11
-
 	rcFreePolyMesh(poly_mesh);
 	poly_mesh = nullptr;
 	rcFreePolyMeshDetail(detail_mesh);
 	detail_mesh = nullptr;
 
-	bake_state = "Baking finished."; // step #12
+	return true;
+}
+
+static void generator_bake_tile(void *p_arg, uint32_t p_index) {
+	NavMeshGeneratorTiledBake3D *tiled_bake = static_cast<NavMeshGeneratorTiledBake3D *>(p_arg);
+	NavMeshGeneratorTile3D &tile = tiled_bake->tiles[p_index];
+
+	if (tile.indices.is_empty()) {
+		return;
+	}
+
+	rcConfig cfg = tiled_bake->cfg;
+	rcVcopy(cfg.bmin, tile.bmin);
+	rcVcopy(cfg.bmax, tile.bmax);
+
+	tile.failed = !generator_bake_recast(tiled_bake->navigation_mesh, cfg, tiled_bake->verts, tiled_bake->nverts, tile.indices.ptr(), tile.indices.size() / 3, *tiled_bake->projected_obstructions, tile.vertices, tile.polygons);
+}
+
+// Welds the vertices that the tiles on both sides of a tile border created for the same point and splits
+// the border edges at the vertices of the other side so that the polygons share identical edges again.
+static void generator_stitch_tiles(const Ref<NavigationMesh> &p_navigation_mesh, real_t p_tile_width, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
+	const real_t snap_distance = p_navigation_mesh->get_cell_size() * 0.25;
+	const real_t height_tolerance = MAX(p_navigation_mesh->get_cell_height(), p_navigation_mesh->get_agent_max_climb());
+
+	// Bit 0 set when the vertex is on a border along the Z axis (constant X), bit 1 for a constant Z.
+	LocalVector<uint8_t> vertex_borders;
+	vertex_borders.resize(r_vertices.size());
+
+	Vector3 *vertices_ptrw = r_vertices.ptrw();
+	for (int i = 0; i < r_vertices.size(); i++) {
+		Vector3 &vertex = vertices_ptrw[i];
+		uint8_t borders = 0;
+		const real_t border_x = Math::round(vertex.x / p_tile_width) * p_tile_width;
+		if (Math::abs(vertex.x - border_x) < snap_distance) {
+			vertex.x = border_x;
+			borders |= 1;
+		}
+		const real_t border_z = Math::round(vertex.z / p_tile_width) * p_tile_width;
+		if (Math::abs(vertex.z - border_z) < snap_distance) {
+			vertex.z = border_z;
+			borders |= 2;
+		}
+		vertex_borders[i] = borders;
+	}
+
+	// Vertices of the polygons dropped by a tile rebake are left out.
+	LocalVector<bool> vertex_used;
+	vertex_used.resize(r_vertices.size());
+	for (uint32_t i = 0; i < vertex_used.size(); i++) {
+		vertex_used[i] = false;
+	}
+	for (const Vector<int> &polygon : r_polygons) {
+		for (int index : polygon) {
+			vertex_used[index] = true;
+		}
+	}
+
+	Vector<Vector3> stitched_vertices;
+	LocalVector<uint8_t> stitched_borders;
+	LocalVector<int> vertex_remap;
+	vertex_remap.resize(r_vertices.size());
+
+	HashMap<Vector3, int> vertex_to_index;
+	HashMap<Vector2i, LocalVector<int>> border_cells;
+
+	for (int i = 0; i < r_vertices.size(); i++) {
+		if (!vertex_used[i]) {
+			vertex_remap[i] = -1;
+			continue;
+		}
+
+		const Vector3 &vertex = r_vertices[i];
+		int index = -1;
+
+		if (vertex_borders[i] == 0) {
+			int *existing_index_ptr = vertex_to_index.getptr(vertex);
+			if (existing_index_ptr) {
+				index = *existing_index_ptr;
+			} else {
+				index = stitched_vertices.size();
+				vertex_to_index[vertex] = index;
+			}
+		} else {
+			// Border vertices of neighboring tiles can differ slightly in height and in float precision along the border.
+			LocalVector<int> &cell_vertices = border_cells[Vector2i((int)Math::round(vertex.x / snap_distance), (int)Math::round(vertex.z / snap_distance))];
+			for (int cell_vertex : cell_vertices) {
+				if (Math::abs(stitched_vertices[cell_vertex].y - vertex.y) <= height_tolerance) {
+					index = cell_vertex;
+					break;
+				}
+			}
+			if (index == -1) {
+				index = stitched_vertices.size();
+				cell_vertices.push_back(index);
+			}
+		}
+
+		if (index == stitched_vertices.size()) {
+			stitched_vertices.push_back(vertex);
+			stitched_borders.push_back(vertex_borders[i]);
+		}
+		vertex_remap[i] = index;
+	}
+
+	// Sort the vertices on each border line along the line.
+	struct BorderVertex {
+		real_t position = 0.0;
+		int index = -1;
+
+		bool operator<(const BorderVertex &p_other) const { return position < p_other.position; }
+	};
+
+	// Border lines are keyed by their tile border index times two plus the axis.
+	HashMap<int64_t, LocalVector<BorderVertex>> border_lines;
+	for (int i = 0; i < stitched_vertices.size(); i++) {
+		const Vector3 &vertex = stitched_vertices[i];
+		if (stitched_borders[i] & 1) {
+			border_lines[(int64_t)Math::round(vertex.x / p_tile_width) * 2].push_back({ vertex.z, i });
+		}
+		if (stitched_borders[i] & 2) {
+			border_lines[(int64_t)Math::round(vertex.z / p_tile_width) * 2 + 1].push_back({ vertex.x, i });
+		}
+	}
+	for (KeyValue<int64_t, LocalVector<BorderVertex>> &E : border_lines) {
+		E.value.sort();
+	}
+
+	Vector<Vector<int>> stitched_polygons;
+	stitched_polygons.resize(r_polygons.size());
+	int stitched_polygon_count = 0;
+
+	for (const Vector<int> &polygon : r_polygons) {
+		Vector<int> stitched_polygon;
+		for (int i = 0; i < polygon.size(); i++) {
+			const int index = vertex_remap[polygon[i]];
+			if (stitched_polygon.is_empty() || stitched_polygon[stitched_polygon.size() - 1] != index) {
+				stitched_polygon.push_back(index);
+			}
+		}
+		while (stitched_polygon.size() > 1 && stitched_polygon[0] == stitched_polygon[stitched_polygon.size() - 1]) {
+			stitched_polygon.remove_at(stitched_polygon.size() - 1);
+		}
+		if (stitched_polygon.size() < 3) {
+			continue;
+		}
+
+		// Split the edges that lie on a tile border at the vertices the other side of the border has in between.
+		Vector<int> split_polygon;
+		const int vertex_count = stitched_polygon.size();
+		for (int i = 0; i < vertex_count; i++) {
+			const int index_a = stitched_polygon[i];
+			const int index_b = stitched_polygon[(i + 1) % vertex_count];
+			split_polygon.push_back(index_a);
+
+			const uint8_t shared_borders = stitched_borders[index_a] & stitched_borders[index_b];
+			for (int axis = 0; axis < 2; axis++) {
+				if (!(shared_borders & (1 << axis))) {
+					continue;
+				}
+				const Vector3 &a = stitched_vertices[index_a];
+				const Vector3 &b = stitched_vertices[index_b];
+				const real_t line_a = axis == 0 ? a.x : a.z;
+				const real_t line_b = axis == 0 ? b.x : b.z;
+				if (line_a != line_b) {
+					continue;
+				}
+				const LocalVector<BorderVertex> *line_vertices = border_lines.getptr((int64_t)Math::round(line_a / p_tile_width) * 2 + axis);
+				if (!line_vertices) {
+					continue;
+				}
+
+				const real_t from = axis == 0 ? a.z : a.x;
+				const real_t to = axis == 0 ? b.z : b.x;
+				const real_t min_position = MIN(from, to);
+				const real_t max_position = MAX(from, to);
+
+				// First vertex on the line past the lower edge end.
+				uint32_t lower = 0;
+				uint32_t upper = line_vertices->size();
+				while (lower < upper) {
+					const uint32_t middle = (lower + upper) / 2;
+					if ((*line_vertices)[middle].position <= min_position) {
+						lower = middle + 1;
+					} else {
+						upper = middle;
+					}
+				}
+
+				LocalVector<int> split_indices;
+				for (uint32_t j = lower; j < line_vertices->size() && (*line_vertices)[j].position < max_position; j++) {
+					const BorderVertex &border_vertex = (*line_vertices)[j];
+					const Vector3 &split_vertex = stitched_vertices[border_vertex.index];
+					const real_t weight = (border_vertex.position - from) / (to - from);
+					if (Math::abs(Math::lerp(a.y, b.y, weight) - split_vertex.y) <= height_tolerance) {
+						split_indices.push_back(border_vertex.index);
+					}
+				}
+				if (from < to) {
+					for (uint32_t j = 0; j < split_indices.size(); j++) {
+						split_polygon.push_back(split_indices[j]);
+					}
+				} else {
+					for (int64_t j = int64_t(split_indices.size()) - 1; j >= 0; j--) {
+						split_polygon.push_back(split_indices[j]);
+					}
+				}
+				break;
+			}
+		}
+
+		stitched_polygons.write[stitched_polygon_count++] = split_polygon;
+	}
+	stitched_polygons.resize(stitched_polygon_count);
+
+	r_vertices = stitched_vertices;
+	r_polygons = stitched_polygons;
+}
+
+// Splits the bake area into world aligned tiles and bakes them in parallel. With a dirty area only the tiles
+// it touches are baked and the polygons of the other tiles are taken from the current navigation mesh.
+static bool generator_bake_tiles(const Ref<NavigationMesh> &p_navigation_mesh, const rcConfig &p_cfg, const float *p_verts, int p_nverts, const int *p_tris, int p_ntris, const Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> &p_projected_obstructions, const AABB *p_dirty_aabb, bool p_use_threads, bool p_high_priority, Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons, real_t &r_tile_width) {
+	const int tile_cells = MAX(1, (int)Math::round(p_navigation_mesh->get_tile_size() / p_cfg.cs));
+	const real_t tile_width = tile_cells * p_cfg.cs;
+	r_tile_width = tile_width;
+
+	// The current polygons can only be kept when they were baked in the same tiles, otherwise they are all rebaked.
+	if (p_dirty_aabb && !Math::is_equal_approx((real_t)p_navigation_mesh->get_baked_tile_width(), tile_width)) {
+		p_dirty_aabb = nullptr;
+	}
+
+	// The user border shrinks the whole bake area like it does without tiles.
+	const real_t outer_border = p_cfg.borderSize * p_cfg.cs;
+	const Vector2 area_min = Vector2(p_cfg.bmin[0], p_cfg.bmin[2]) + Vector2(outer_border, outer_border);
+	const Vector2 area_max = Vector2(p_cfg.bmax[0], p_cfg.bmax[2]) - Vector2(outer_border, outer_border);
+	ERR_FAIL_COND_V(area_min.x >= area_max.x || area_min.y >= area_max.y, false);
+
+	// Each tile needs enough geometry from its neighbors to erode the walkable area like a single bake would.
+	NavMeshGeneratorTiledBake3D tiled_bake;
+	tiled_bake.navigation_mesh = p_navigation_mesh;
+	tiled_bake.cfg = p_cfg;
+	tiled_bake.cfg.borderSize = MAX(p_cfg.borderSize, p_cfg.walkableRadius + 3);
+	tiled_bake.verts = p_verts;
+	tiled_bake.nverts = p_nverts;
+	tiled_bake.projected_obstructions = &p_projected_obstructions;
+
+	const real_t tile_border = tiled_bake.cfg.borderSize * p_cfg.cs;
+
+	const Vector2i tile_min = Vector2i((int)Math::floor(area_min.x / tile_width), (int)Math::floor(area_min.y / tile_width));
+	const Vector2i tile_max = Vector2i((int)Math::floor(area_max.x / tile_width), (int)Math::floor(area_max.y / tile_width));
+	const Vector2i tile_grid_size = tile_max - tile_min + Vector2i(1, 1);
+
+	Rect2 dirty_rect;
+	if (p_dirty_aabb) {
+		// A change also moves the edges of the walkable area in the tiles next to it, up to the border the
+		// tiles read from their neighbors plus the agent radius the walkable area is eroded by.
+		dirty_rect = Rect2(p_dirty_aabb->position.x, p_dirty_aabb->position.z, p_dirty_aabb->size.x, p_dirty_aabb->size.z).abs();
+		dirty_rect = dirty_rect.grow(tile_border + p_navigation_mesh->get_agent_radius());
+	}
+
+	LocalVector<int> tile_grid;
+	tile_grid.resize(tile_grid_size.x * tile_grid_size.y);
+	for (int y = 0; y < tile_grid_size.y; y++) {
+		for (int x = 0; x < tile_grid_size.x; x++) {
+			tile_grid[y * tile_grid_size.x + x] = -1;
+
+			const Vector2 cell_min = Vector2(tile_min.x + x, tile_min.y + y) * tile_width;
+			const Vector2 bake_min = cell_min.max(area_min);
+			const Vector2 bake_max = (cell_min + Vector2(tile_width, tile_width)).min(area_max);
+			if (bake_min.x >= bake_max.x || bake_min.y >= bake_max.y) {
+				continue;
+			}
+			if (p_dirty_aabb && !Rect2(bake_min, bake_max - bake_min).intersects(dirty_rect, true)) {
+				continue;
+			}
+
+			NavMeshGeneratorTile3D tile;
+			tile.bmin[0] = bake_min.x - tile_border;
+			tile.bmin[1] = p_cfg.bmin[1];
+			tile.bmin[2] = bake_min.y - tile_border;
+			tile.bmax[0] = bake_max.x + tile_border;
+			tile.bmax[1] = p_cfg.bmax[1];
+			tile.bmax[2] = bake_max.y + tile_border;
+
+			tile_grid[y * tile_grid_size.x + x] = tiled_bake.tiles.size();
+			tiled_bake.tiles.push_back(tile);
+		}
+	}
+
+	// Hand each tile the triangles that overlap it including its border.
+	for (int i = 0; i < p_ntris; i++) {
+		const int *tri = &p_tris[i * 3];
+		Vector2 tri_min = Vector2(p_verts[tri[0] * 3 + 0], p_verts[tri[0] * 3 + 2]);
+		Vector2 tri_max = tri_min;
+		for (int j = 1; j < 3; j++) {
+			const Vector2 vertex = Vector2(p_verts[tri[j] * 3 + 0], p_verts[tri[j] * 3 + 2]);
+			tri_min = tri_min.min(vertex);
+			tri_max = tri_max.max(vertex);
+		}
+
+		const int from_x = MAX((int)Math::floor((tri_min.x - tile_border) / tile_width), tile_min.x) - tile_min.x;
+		const int from_y = MAX((int)Math::floor((tri_min.y - tile_border) / tile_width), tile_min.y) - tile_min.y;
+		const int to_x = MIN((int)Math::floor((tri_max.x + tile_border) / tile_width), tile_max.x) - tile_min.x;
+		const int to_y = MIN((int)Math::floor((tri_max.y + tile_border) / tile_width), tile_max.y) - tile_min.y;
+
+		for (int y = from_y; y <= to_y; y++) {
+			for (int x = from_x; x <= to_x; x++) {
+				const int tile_index = tile_grid[y * tile_grid_size.x + x];
+				if (tile_index == -1) {
+					continue;
+				}
+				LocalVector<int> &tile_indices = tiled_bake.tiles[tile_index].indices;
+				tile_indices.push_back(tri[0]);
+				tile_indices.push_back(tri[1]);
+				tile_indices.push_back(tri[2]);
+			}
+		}
+	}
+
+	if (p_use_threads && tiled_bake.tiles.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&generator_bake_tile, &tiled_bake, tiled_bake.tiles.size(), -1, p_high_priority, SNAME("NavMeshGeneratorBakeTiles3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (uint32_t i = 0; i < tiled_bake.tiles.size(); i++) {
+			generator_bake_tile(&tiled_bake, i);
+		}
+	}
+
+	for (const NavMeshGeneratorTile3D &tile : tiled_bake.tiles) {
+		if (tile.failed) {
+			return false;
+		}
+	}
+
+	if (p_dirty_aabb) {
+		// Keep the polygons of the tiles that are not rebaked.
+		Vector<Vector3> current_vertices;
+		Vector<Vector<int>> current_polygons;
+		p_navigation_mesh->get_data(current_vertices, current_polygons);
+
+		r_vertices = current_vertices;
+		for (const Vector<int> &polygon : current_polygons) {
+			Vector3 center;
+			for (int index : polygon) {
+				center += current_vertices[index];
+			}
+			center /= polygon.size();
+
+			const Vector2i tile = Vector2i((int)Math::floor(center.x / tile_width), (int)Math::floor(center.z / tile_width)) - tile_min;
+			if (tile.x >= 0 && tile.y >= 0 && tile.x < tile_grid_size.x && tile.y < tile_grid_size.y && tile_grid[tile.y * tile_grid_size.x + tile.x] != -1) {
+				continue;
+			}
+			r_polygons.push_back(polygon);
+		}
+	}
+
+	for (const NavMeshGeneratorTile3D &tile : tiled_bake.tiles) {
+		const int index_offset = r_vertices.size();
+		r_vertices.append_array(tile.vertices);
+		for (const Vector<int> &tile_polygon : tile.polygons) {
+			Vector<int> polygon = tile_polygon;
+			int *polygon_ptrw = polygon.ptrw();
+			for (int i = 0; i < polygon.size(); i++) {
+				polygon_ptrw[i] += index_offset;
+			}
+			r_polygons.push_back(polygon);
+		}
+	}
+
+	generator_stitch_tiles(p_navigation_mesh, tile_width, r_vertices, r_polygons);
+
+	return true;
+}
+
+void NavMeshGenerator3D::generator_bake_from_source_geometry_data(Ref<NavigationMesh> p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB *p_dirty_aabb) {
+	if (p_navigation_mesh.is_null() || p_source_geometry_data.is_null()) {
+		return;
+	}
+
+	Vector<float> source_geometry_vertices;
+	Vector<int> source_geometry_indices;
+	Vector<NavigationMeshSourceGeometryData3D::ProjectedObstruction> projected_obstructions;
+
+	p_source_geometry_data->get_data(
+			source_geometry_vertices,
+			source_geometry_indices,
+			projected_obstructions);
+
+	if (source_geometry_vertices.size() < 3 || source_geometry_indices.size() < 3) {
+		return;
+	}
+
+	const float *verts = source_geometry_vertices.ptr();
+	const int nverts = source_geometry_vertices.size() / 3;
+	const int *tris = source_geometry_indices.ptr();
+	const int ntris = source_geometry_indices.size() / 3;
+
+	float bmin[3], bmax[3];
+	rcCalcBounds(verts, nverts, bmin, bmax);
+
+	rcConfig cfg;
+	generator_recast_config(p_navigation_mesh, cfg);
+
+	cfg.bmin[0] = bmin[0];
+	cfg.bmin[1] = bmin[1];
+	cfg.bmin[2] = bmin[2];
+	cfg.bmax[0] = bmax[0];
+	cfg.bmax[1] = bmax[1];
+	cfg.bmax[2] = bmax[2];
+
+	AABB baking_aabb = p_navigation_mesh->get_filter_baking_aabb();
+	if (baking_aabb.has_volume()) {
+		Vector3 baking_aabb_offset = p_navigation_mesh->get_filter_baking_aabb_offset();
+		cfg.bmin[0] = baking_aabb.position[0] + baking_aabb_offset.x;
+		cfg.bmin[1] = baking_aabb.position[1] + baking_aabb_offset.y;
+		cfg.bmin[2] = baking_aabb.position[2] + baking_aabb_offset.z;
+		cfg.bmax[0] = cfg.bmin[0] + baking_aabb.size[0];
+		cfg.bmax[1] = cfg.bmin[1] + baking_aabb.size[1];
+		cfg.bmax[2] = cfg.bmin[2] + baking_aabb.size[2];
+	}
+
+	Vector<Vector3> nav_vertices;
+	Vector<Vector<int>> nav_polygons;
+	real_t tile_width = 0.0;
+
+	if (p_navigation_mesh->get_tile_size() > 0.0) {
+		if (!generator_bake_tiles(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, p_dirty_aabb, baking_use_multiple_threads, baking_use_high_priority_threads, nav_vertices, nav_polygons, tile_width)) {
+			return;
+		}
+	} else {
+		if (!generator_bake_recast(p_navigation_mesh, cfg, verts, nverts, tris, ntris, projected_obstructions, nav_vertices, nav_polygons)) {
+			return;
+		}
+	}
+
+	p_navigation_mesh->set_data(nav_vertices, nav_polygons, tile_width);
 }
 
 bool NavMeshGenerator3D::generator_emit_callback(const Callable &p_callback) {
@@ -45,7 +45,12 @@ class NavMeshQueries3D {
 public:
 	struct PathQuerySlot {
 		LocalVector<Nav3D::NavigationPoly> path_corridor;
+		// Ids of the path corridor polygons changed by the last query, reset before the next one.
+		LocalVector<uint32_t> path_corridor_touched;
 		Heap<Nav3D::NavigationPoly *, Nav3D::NavPolyTravelCostGreaterThan, Nav3D::NavPolyHeapIndexer> traversable_polys;
+		LocalVector<Nav3D::NavigationCluster> cluster_corridor;
+		Heap<Nav3D::NavClusterCost, Nav3D::NavClusterCostGreaterThan> traversable_clusters;
+		uint32_t cluster_corridor_pass = 0;
 		bool in_use = false;
 		uint32_t slot_index = 0;
 	};
@@ -79,11 +84,15 @@ public:
 		const Nav3D::Polygon *begin_polygon = nullptr;
 		const Nav3D::Polygon *end_polygon = nullptr;
 		uint32_t least_cost_id = 0;
+		bool use_cluster_corridor = false;
+		bool path_corridor_cacheable = false;
+		bool path_corridor_cache_hit = false;
 
 		// Map.
 		Vector3 map_up;
 		NavMap3D *map = nullptr;
 		PathQuerySlot *path_query_slot = nullptr;
+		uint32_t path_cache_size = 0;
 
 		// Path points.
 		LocalVector<Vector3> path_points;
@@ -127,13 +136,20 @@ public:
 	static RID map_iteration_get_closest_point_owner(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Nav3D::ClosestPointQueryResult map_iteration_get_closest_point_info(const NavMapIteration3D &p_map_iteration, const Vector3 &p_point);
 	static Vector3 map_iteration_get_random_point(const NavMapIteration3D &p_map_iteration, uint32_t p_navigation_layers, bool p_uniformly);
+	static Vector3 map_iteration_get_flow_field_next_position(NavMapIteration3D &p_map_iteration, const Vector3 &p_origin, const Vector3 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance);
 
 	static void map_query_path(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
+	static void map_query_path_async(NavMap3D *map, const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback);
 
 	static void query_task_map_iteration_get_path(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void query_task_dispatch_result(NavMeshPathQueryTask3D &p_query_task);
+	static void _query_task_setup(NavMeshPathQueryTask3D &r_query_task, const Ref<NavigationPathQueryParameters3D> &p_query_parameters);
 	static void _query_task_push_back_point_with_metadata(NavMeshPathQueryTask3D &p_query_task, const Vector3 &p_point, const Nav3D::Polygon *p_point_polygon);
 	static void _query_task_find_start_end_positions(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
-	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task);
+	static bool _query_task_build_cluster_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static void _query_task_build_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration);
+	static bool _query_task_restore_cached_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCorridorKey &p_key);
+	static void _query_task_cache_path_corridor(NavMeshPathQueryTask3D &p_query_task, const NavMapIteration3D &p_map_iteration, const Nav3D::PathCorridorKey &p_key);
 	static void _query_task_post_process_corridorfunnel(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_edgecentered(NavMeshPathQueryTask3D &p_query_task);
 	static void _query_task_post_process_nopostprocessing(NavMeshPathQueryTask3D &p_query_task);
@@ -141,6 +157,8 @@ public:
 	static void _query_task_simplified_path_points(NavMeshPathQueryTask3D &p_query_task);
 	static bool _query_task_is_connection_owner_usable(const NavMeshPathQueryTask3D &p_query_task, const NavBaseIteration3D *p_owner);
 
+	static void _flow_field_build(Nav3D::FlowField &r_flow_field, const NavMapIteration3D &p_map_iteration);
+
 	static void simplify_path_segment(int p_start_inx, int p_end_inx, const LocalVector<Vector3> &p_points, real_t p_epsilon, LocalVector<uint32_t> &r_simplified_path_indices);
 	static LocalVector<uint32_t> get_simplified_path_indices(const LocalVector<Vector3> &p_path, real_t p_epsilon);
 };
@@ -40,6 +40,10 @@ struct NavRegionIteration3D : NavBaseIteration3D {
 	real_t surface_area = 0.0;
 	AABB bounds;
 
+	// The polygon edges already merged within the region, and the edges left for the map to connect.
+	LocalVector<Nav3D::RegionEdgeConnectionPair> edge_connection_pairs;
+	LocalVector<Nav3D::RegionEdge> free_edges;
+
 	const Transform3D &get_transform() const { return transform; }
 	real_t get_surface_area() const { return surface_area; }
 	AABB get_bounds() const { return bounds; }
@@ -168,9 +168,18 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 	}
 
 	p_query_task.map_up = map_iteration.map_up;
+	p_query_task.path_cache_size = path_cache_size.get();
 
 	NavMeshQueries3D::query_task_map_iteration_get_path(p_query_task, map_iteration);
 
+	if (p_query_task.path_corridor_cacheable) {
+		if (p_query_task.path_corridor_cache_hit) {
+			path_cache_hit_count.increment();
+		} else {
+			path_cache_miss_count.increment();
+		}
+	}
+
 	map_iteration.path_query_slots_mutex.lock();
 	uint32_t used_slot_index = p_query_task.path_query_slot->slot_index;
 	map_iteration.path_query_slots[used_slot_index].in_use = false;
@@ -180,6 +189,57 @@ void NavMap3D::query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task
 	map_iteration.path_query_slots_semaphore.post();
 }
 
+void NavMap3D::queue_path_query(NavMeshQueries3D::NavMeshPathQueryTask3D *p_query_task) {
+	MutexLock lock(path_query_queue_mutex);
+	path_query_queue.push_back(p_query_task);
+}
+
+void NavMap3D::_process_queued_path_query(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_task) {
+	query_path(*p_query_task[p_index]);
+}
+
+void NavMap3D::process_path_query_queue() {
+	{
+		MutexLock lock(path_query_queue_mutex);
+		if (path_query_queue.is_empty()) {
+			return;
+		}
+
+		// Take the oldest queries, the others wait for the next physics step.
+		uint32_t batch_size = path_query_queue.size();
+		if (path_query_batch_max > 0 && batch_size > (uint32_t)path_query_batch_max) {
+			batch_size = path_query_batch_max;
+		}
+
+		path_query_batch.resize(batch_size);
+		for (uint32_t i = 0; i < batch_size; i++) {
+			path_query_batch[i] = path_query_queue[i];
+		}
+		for (uint32_t i = batch_size; i < path_query_queue.size(); i++) {
+			path_query_queue[i - batch_size] = path_query_queue[i];
+		}
+		path_query_queue.resize(path_query_queue.size() - batch_size);
+	}
+
+	// Limit the tasks to the path query slots so that no worker thread waits for a free slot.
+	if (use_threads && path_query_slots_max > 1 && path_query_batch.size() > 1) {
+		int tasks_needed = MIN(path_query_slots_max, (int)path_query_batch.size());
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::_process_queued_path_query, path_query_batch.ptr(), path_query_batch.size(), tasks_needed, true, SNAME("NavMapPathQueries3D"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else {
+		for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_batch) {
+			query_path(*query_task);
+		}
+	}
+
+	// Results and callbacks are delivered on the calling thread.
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_batch) {
+		NavMeshQueries3D::query_task_dispatch_result(*query_task);
+		memdelete(query_task);
+	}
+	path_query_batch.clear();
+}
+
 Vector3 NavMap3D::get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const {
 	if (iteration_id == 0) {
 		NAVMAP_ITERATION_ZERO_ERROR_MSG();
@@ -330,6 +390,17 @@ Vector3 NavMap3D::get_random_point(uint32_t p_navigation_layers, bool p_uniforml
 	return NavMeshQueries3D::map_iteration_get_random_point(map_iteration, p_navigation_layers, p_uniformly);
 }
 
+Vector3 NavMap3D::get_flow_field_next_position(const Vector3 &p_origin, const Vector3 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance) {
+	if (iteration_id == 0) {
+		NAVMAP_ITERATION_ZERO_ERROR_MSG();
+		return p_origin;
+	}
+
+	GET_MAP_ITERATION();
+
+	return NavMeshQueries3D::map_iteration_get_flow_field_next_position(map_iteration, p_origin, p_destination, p_navigation_layers, p_desired_distance);
+}
+
 void NavMap3D::_build_iteration() {
 	if (!iteration_dirty || iteration_building || iteration_ready) {
 		return;
@@ -360,7 +431,6 @@ void NavMap3D::_build_iteration() {
 
 	iteration_build.reset();
 
-	iteration_build.merge_rasterizer_cell_size = get_merge_rasterizer_cell_size();
 	iteration_build.use_edge_connections = get_use_edge_connections();
 	iteration_build.edge_connection_margin = get_edge_connection_margin();
 	iteration_build.link_connection_radius = get_link_connection_radius();
@@ -440,6 +510,7 @@ void NavMap3D::_sync_iteration() {
 	performance_data.pm_edge_merge_count = iteration_build.performance_data.pm_edge_merge_count;
 	performance_data.pm_edge_connection_count = iteration_build.performance_data.pm_edge_connection_count;
 	performance_data.pm_edge_free_count = iteration_build.performance_data.pm_edge_free_count;
+	performance_data.pm_iteration_build_usec = iteration_build.performance_data.pm_iteration_build_usec;
 
 	iteration_id = iteration_id % UINT32_MAX + 1;
 
@@ -458,6 +529,8 @@ void NavMap3D::sync() {
 	performance_data.pm_agent_count = agents.size();
 	performance_data.pm_link_count = links.size();
 	performance_data.pm_obstacle_count = obstacles.size();
+	performance_data.pm_path_cache_hit_count = path_cache_hit_count.get();
+	performance_data.pm_path_cache_miss_count = path_cache_miss_count.get();
 
 	_sync_dirty_map_update_requests();
 
@@ -573,45 +646,22 @@ void NavMap3D::_update_rvo_obstacles_tree_2d() {
 	rvo_simulation_2d.kdTree_->buildObstacleTree(raw_obstacles);
 }
 
-void NavMap3D::_update_rvo_agents_tree_2d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO2D::Agent2D *> raw_agents;
-	raw_agents.reserve(active_2d_avoidance_agents.size());
-	for (NavAgent3D *agent : active_2d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_2d());
-	}
-	rvo_simulation_2d.kdTree_->buildAgentTree(raw_agents);
-}
-
-void NavMap3D::_update_rvo_agents_tree_3d() {
-	// Cannot use LocalVector here as RVO library expects std::vector to build KdTree.
-	std::vector<RVO3D::Agent3D *> raw_agents;
-	raw_agents.reserve(active_3d_avoidance_agents.size());
-	for (NavAgent3D *agent : active_3d_avoidance_agents) {
-		raw_agents.push_back(agent->get_rvo_agent_3d());
-	}
-	rvo_simulation_3d.kdTree_->buildAgentTree(raw_agents);
-}
-
 void NavMap3D::_update_rvo_simulation() {
 	if (obstacles_dirty) {
 		_update_rvo_obstacles_tree_2d();
 	}
-	if (agents_dirty) {
-		_update_rvo_agents_tree_2d();
-		_update_rvo_agents_tree_3d();
-	}
 }
 
 void NavMap3D::compute_single_avoidance_step_2d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+	(*(agent + index))->get_rvo_agent_2d()->computeObstacleNeighbors(&rvo_simulation_2d);
+	avoidance_grid_2d.compute_agent_neighbors_2d((*(agent + index))->get_rvo_agent_2d());
 	(*(agent + index))->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 	(*(agent + index))->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 	(*(agent + index))->update();
 }
 
 void NavMap3D::compute_single_avoidance_step_3d(uint32_t index, NavAgent3D **agent) {
-	(*(agent + index))->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+	avoidance_grid_3d.compute_agent_neighbors_3d((*(agent + index))->get_rvo_agent_3d());
 	(*(agent + index))->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 	(*(agent + index))->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 	(*(agent + index))->update();
@@ -622,12 +672,15 @@ void NavMap3D::step(double p_delta_time) {
 	rvo_simulation_3d.setTimeStep(float(p_delta_time));
 
 	if (active_2d_avoidance_agents.size() > 0) {
+		// Agents move every step, so the neighbor grid is rebuilt from the current positions.
+		avoidance_grid_2d.build_2d(active_2d_avoidance_agents);
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_2d, active_2d_avoidance_agents.ptr(), active_2d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents2D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent3D *agent : active_2d_avoidance_agents) {
-				agent->get_rvo_agent_2d()->computeNeighbors(&rvo_simulation_2d);
+				agent->get_rvo_agent_2d()->computeObstacleNeighbors(&rvo_simulation_2d);
+				avoidance_grid_2d.compute_agent_neighbors_2d(agent->get_rvo_agent_2d());
 				agent->get_rvo_agent_2d()->computeNewVelocity(&rvo_simulation_2d);
 				agent->get_rvo_agent_2d()->update(&rvo_simulation_2d);
 				agent->update();
@@ -636,12 +689,13 @@ void NavMap3D::step(double p_delta_time) {
 	}
 
 	if (active_3d_avoidance_agents.size() > 0) {
+		avoidance_grid_3d.build_3d(active_3d_avoidance_agents);
 		if (use_threads && avoidance_use_multiple_threads) {
 			WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_template_group_task(this, &NavMap3D::compute_single_avoidance_step_3d, active_3d_avoidance_agents.ptr(), active_3d_avoidance_agents.size(), -1, true, SNAME("RVOAvoidanceAgents3D"));
 			WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
 		} else {
 			for (NavAgent3D *agent : active_3d_avoidance_agents) {
-				agent->get_rvo_agent_3d()->computeNeighbors(&rvo_simulation_3d);
+				avoidance_grid_3d.compute_agent_neighbors_3d(agent->get_rvo_agent_3d());
 				agent->get_rvo_agent_3d()->computeNewVelocity(&rvo_simulation_3d);
 				agent->get_rvo_agent_3d()->update(&rvo_simulation_3d);
 				agent->update();
@@ -831,6 +885,14 @@ bool NavMap3D::get_use_async_iterations() const {
 	return use_async_iterations;
 }
 
+void NavMap3D::set_path_cache_size(int p_size) {
+	path_cache_size.set(MAX(p_size, 0));
+}
+
+int NavMap3D::get_path_cache_size() const {
+	return path_cache_size.get();
+}
+
 NavMap3D::NavMap3D() {
 	avoidance_use_multiple_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_multiple_threads");
 	avoidance_use_high_priority_threads = GLOBAL_GET("navigation/avoidance/thread_model/avoidance_use_high_priority_threads");
@@ -848,6 +910,10 @@ NavMap3D::NavMap3D() {
 		path_query_slots_max = 1;
 	}
 
+	path_query_batch_max = GLOBAL_GET("navigation/pathfinding/max_async_queries_per_step");
+
+	set_path_cache_size(GLOBAL_GET("navigation/pathfinding/path_cache_size"));
+
 	iteration_slots.resize(2);
 
 	for (NavMapIteration3D &iteration_slot : iteration_slots) {
@@ -870,4 +936,12 @@ NavMap3D::~NavMap3D() {
 		WorkerThreadPool::get_singleton()->wait_for_task_completion(iteration_build_thread_task_id);
 		iteration_build_thread_task_id = WorkerThreadPool::INVALID_TASK_ID;
 	}
+
+	for (NavMeshQueries3D::NavMeshPathQueryTask3D *query_task : path_query_queue) {
+		memdelete(query_task);
+	}
+
+	for (NavMapIteration3D &iteration_slot : iteration_slots) {
+		iteration_slot.clear_flow_fields();
+	}
 }
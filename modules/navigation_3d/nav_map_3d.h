@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "3d/nav_avoidance_grid_3d.h"
 #include "3d/nav_map_iteration_3d.h"
 #include "3d/nav_mesh_queries_3d.h"
 #include "nav_rid_3d.h"
@@ -87,6 +88,10 @@ class NavMap3D : public NavRid3D {
 	LocalVector<NavAgent3D *> active_2d_avoidance_agents;
 	LocalVector<NavAgent3D *> active_3d_avoidance_agents;
 
+	/// Neighbor search grids of the avoidance controlled agents, rebuilt each step.
+	NavAvoidanceGrid3D avoidance_grid_2d;
+	NavAvoidanceGrid3D avoidance_grid_3d;
+
 	/// dirty flag when one of the agent's arrays are modified
 	bool agents_dirty = true;
 
@@ -118,6 +123,17 @@ class NavMap3D : public NavRid3D {
 
 	int path_query_slots_max = 4;
 
+	// Path queries requested with NavigationServer3D.query_path_async(), processed in batches on the WorkerThreadPool.
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> path_query_queue;
+	LocalVector<NavMeshQueries3D::NavMeshPathQueryTask3D *> path_query_batch;
+	Mutex path_query_queue_mutex;
+	int path_query_batch_max = 256;
+
+	// Path corridors kept per map iteration for queries between the same polygons, 0 disables the cache.
+	SafeNumeric<uint32_t> path_cache_size; // Read by queries running on other threads.
+	SafeNumeric<uint32_t> path_cache_hit_count;
+	SafeNumeric<uint32_t> path_cache_miss_count;
+
 	bool use_async_iterations = true;
 
 	uint32_t iteration_slot_index = 0;
@@ -179,6 +195,7 @@ public:
 	const Vector3 &get_merge_rasterizer_cell_size() const;
 
 	void query_path(NavMeshQueries3D::NavMeshPathQueryTask3D &p_query_task);
+	void queue_path_query(NavMeshQueries3D::NavMeshPathQueryTask3D *p_query_task);
 
 	Vector3 get_closest_point_to_segment(const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision) const;
 	Vector3 get_closest_point(const Vector3 &p_point) const;
@@ -216,10 +233,12 @@ public:
 	}
 
 	Vector3 get_random_point(uint32_t p_navigation_layers, bool p_uniformly) const;
+	Vector3 get_flow_field_next_position(const Vector3 &p_origin, const Vector3 &p_destination, uint32_t p_navigation_layers, real_t p_desired_distance);
 
 	void sync();
 	void step(double p_delta_time);
 	void dispatch_callbacks();
+	void process_path_query_queue();
 
 	// Performance Monitor
 	int get_pm_region_count() const { return performance_data.pm_region_count; }
@@ -231,6 +250,9 @@ public:
 	int get_pm_edge_connection_count() const { return performance_data.pm_edge_connection_count; }
 	int get_pm_edge_free_count() const { return performance_data.pm_edge_free_count; }
 	int get_pm_obstacle_count() const { return performance_data.pm_obstacle_count; }
+	int get_pm_iteration_build_usec() const { return performance_data.pm_iteration_build_usec; }
+	int get_pm_path_cache_hit_count() const { return performance_data.pm_path_cache_hit_count; }
+	int get_pm_path_cache_miss_count() const { return performance_data.pm_path_cache_miss_count; }
 
 	int get_region_connections_count(NavRegion3D *p_region) const;
 	Vector3 get_region_connection_pathway_start(NavRegion3D *p_region, int p_connection_id) const;
@@ -249,7 +271,12 @@ public:
 	void set_use_async_iterations(bool p_enabled);
 	bool get_use_async_iterations() const;
 
+	void set_path_cache_size(int p_size);
+	int get_path_cache_size() const;
+
 private:
+	void _process_queued_path_query(uint32_t p_index, NavMeshQueries3D::NavMeshPathQueryTask3D **p_query_task);
+
 	void _sync_dirty_map_update_requests();
 	void _sync_dirty_avoidance_update_requests();
 
@@ -261,8 +288,6 @@ private:
 	void _sync_avoidance();
 	void _update_rvo_simulation();
 	void _update_rvo_obstacles_tree_2d();
-	void _update_rvo_agents_tree_2d();
-	void _update_rvo_agents_tree_3d();
 
 	void _update_merge_rasterizer_cell_dimensions();
 };
@@ -64,8 +64,8 @@ void NavRegion3D::set_enabled(bool p_enabled) {
 	}
 	enabled = p_enabled;
 
-	// TODO: This should not require a full rebuild as the region has not really changed.
-	polygons_dirty = true;
+	// The polygons and their edge keys stay valid, the map only needs a new iteration.
+	region_dirty = true;
 
 	request_sync();
 }
@@ -73,7 +73,7 @@ void NavRegion3D::set_enabled(bool p_enabled) {
 void NavRegion3D::set_use_edge_connections(bool p_enabled) {
 	if (use_edge_connections != p_enabled) {
 		use_edge_connections = p_enabled;
-		polygons_dirty = true;
+		region_dirty = true;
 	}
 
 	request_sync();
@@ -206,6 +206,8 @@ void NavRegion3D::update_polygons() {
 		return;
 	}
 	navmesh_polygons.clear();
+	edge_connection_pairs.clear();
+	free_edges.clear();
 	surface_area = 0.0;
 	bounds = AABB();
 	polygons_dirty = false;
@@ -291,6 +293,10 @@ void NavRegion3D::update_polygons() {
 
 	surface_area = _new_region_surface_area;
 	bounds = _new_bounds;
+
+	// Merge the edges within the region once here, so that map iteration builds only have to connect
+	// the free edges of the regions instead of going through every polygon edge of the map.
+	NavMapBuilder3D::build_region_edges(navmesh_polygons, map->get_merge_rasterizer_cell_size(), edge_connection_pairs, free_edges);
 }
 
 void NavRegion3D::get_iteration_update(NavRegionIteration3D &r_iteration) {
@@ -306,6 +312,8 @@ void NavRegion3D::get_iteration_update(NavRegionIteration3D &r_iteration) {
 	r_iteration.owner_use_edge_connections = get_use_edge_connections();
 	r_iteration.bounds = get_bounds();
 	r_iteration.surface_area = get_surface_area();
+	r_iteration.edge_connection_pairs = edge_connection_pairs;
+	r_iteration.free_edges = free_edges;
 
 	r_iteration.navmesh_polygons.clear();
 	r_iteration.navmesh_polygons.resize(navmesh_polygons.size());
@@ -51,6 +51,8 @@ class NavRegion3D : public NavBase3D {
 	bool polygons_dirty = true;
 
 	LocalVector<Nav3D::Polygon> navmesh_polygons;
+	LocalVector<Nav3D::RegionEdgeConnectionPair> edge_connection_pairs;
+	LocalVector<Nav3D::RegionEdge> free_edges;
 
 	real_t surface_area = 0.0;
 	AABB bounds;
@@ -108,7 +108,15 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 		return;
 	}
 
-	for (Node3D *&E : data.children) {
+	// When the transform already changed since the last transform notifications, the whole subtree is still dirty
+	// and queued for notification. Reading a global transform in the subtree clears this node as well.
+	uint64_t pass = get_tree()->xform_change_pass.get();
+	if (data.xform_change_pass == pass && _test_dirty_bits(DIRTY_GLOBAL_TRANSFORM) && _test_dirty_bits(DIRTY_GLOBAL_INTERPOLATED_TRANSFORM)) {
+		return;
+	}
+	data.xform_change_pass = pass;
+
+	for (Node3D *E : data.children) {
 		if (E->data.top_level) {
 			continue; //don't propagate to a top_level
 		}
@@ -129,6 +137,13 @@ void Node3D::_propagate_transform_changed(Node3D *p_origin) {
 	_set_dirty_bits(DIRTY_GLOBAL_TRANSFORM | DIRTY_GLOBAL_INTERPOLATED_TRANSFORM);
 }
 
+void Node3D::_invalidate_transform_propagation() {
+	// The nodes to notify in the tree changed, so the next transform changes must reach every node again.
+	if (is_inside_tree()) {
+		get_tree()->xform_change_pass.increment();
+	}
+}
+
 void Node3D::_notification(int p_what) {
 	switch (p_what) {
 		case NOTIFICATION_ACCESSIBILITY_UPDATE: {
@@ -148,9 +163,10 @@ void Node3D::_notification(int p_what) {
 			}
 
 			if (data.parent) {
-				data.C = data.parent->data.children.push_back(this);
+				data.index_in_parent = data.parent->data.children.size();
+				data.parent->data.children.push_back(this);
 			} else {
-				data.C = nullptr;
+				data.index_in_parent = UINT32_MAX;
 			}
 
 			if (data.top_level && !Engine::get_singleton()->is_editor_hint()) {
@@ -202,11 +218,16 @@ void Node3D::_notification(int p_what) {
 			if (xform_change.in_list()) {
 				get_tree()->xform_change_list.remove(&xform_change);
 			}
-			if (data.C) {
-				data.parent->data.children.erase(data.C);
+			if (data.parent && data.index_in_parent != UINT32_MAX) {
+				LocalVector<Node3D *> &siblings = data.parent->data.children;
+				Node3D *last = siblings[siblings.size() - 1];
+				siblings[data.index_in_parent] = last;
+				last->data.index_in_parent = data.index_in_parent;
+				siblings.resize(siblings.size() - 1);
 			}
 			data.parent = nullptr;
-			data.C = nullptr;
+			data.index_in_parent = UINT32_MAX;
+			data.xform_change_pass = 0; // The next change must reach the subtree again, wherever it is added.
 			_update_visibility_parent(true);
 			_disable_client_physics_interpolation();
 		} break;
@@ -801,6 +822,7 @@ void Node3D::add_gizmo(Ref<Node3DGizmo> p_gizmo) {
 		return;
 	}
 	data.gizmos.push_back(p_gizmo);
+	_invalidate_transform_propagation();
 
 	if (p_gizmo.is_valid() && is_inside_world()) {
 		p_gizmo->create();
@@ -932,6 +954,7 @@ void Node3D::set_as_top_level(bool p_enabled) {
 	if (data.top_level == p_enabled) {
 		return;
 	}
+	_invalidate_transform_propagation();
 	if (is_inside_tree()) {
 		if (p_enabled) {
 			set_transform(get_global_transform());
@@ -947,6 +970,7 @@ void Node3D::set_as_top_level_keep_local(bool p_enabled) {
 	if (data.top_level == p_enabled) {
 		return;
 	}
+	_invalidate_transform_propagation();
 	data.top_level = p_enabled;
 	_propagate_transform_changed(this);
 }
@@ -1155,6 +1179,9 @@ Vector3 Node3D::to_global(Vector3 p_local) const {
 
 void Node3D::set_notify_transform(bool p_enabled) {
 	ERR_THREAD_GUARD;
+	if (p_enabled && !data.notify_transform) {
+		_invalidate_transform_propagation();
+	}
 	data.notify_transform = p_enabled;
 }
 
@@ -1180,6 +1207,7 @@ void Node3D::force_update_transform() {
 		return; //nothing to update
 	}
 	get_tree()->xform_change_list.remove(&xform_change);
+	_invalidate_transform_propagation();
 
 	notification(NOTIFICATION_TRANSFORM_CHANGED);
 }
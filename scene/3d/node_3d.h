@@ -147,8 +147,11 @@ private:
 		RID visibility_parent;
 
 		Node3D *parent = nullptr;
-		List<Node3D *> children;
-		List<Node3D *>::Element *C = nullptr;
+		LocalVector<Node3D *> children;
+		uint32_t index_in_parent = UINT32_MAX; // Index in the children of the parent, which are unordered.
+
+		// Tree transform pass in which the transform change was last propagated to the children.
+		uint64_t xform_change_pass = 0;
 
 		ClientPhysicsInterpolationData *client_physics_interpolation_data = nullptr;
 
@@ -172,6 +175,7 @@ private:
 	void _update_gizmos();
 	void _notify_dirty();
 	void _propagate_transform_changed(Node3D *p_origin);
+	void _invalidate_transform_propagation();
 
 	void _propagate_visibility_changed();
 
@@ -180,7 +184,13 @@ private:
 	void _propagate_transform_changed_deferred();
 
 protected:
-	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) { data.ignore_notification = p_ignore; }
+	_FORCE_INLINE_ void set_ignore_transform_notification(bool p_ignore) {
+		if (data.ignore_notification && !p_ignore) {
+			// Changes made while ignoring did not queue the notification, so the next one must not stop at this node.
+			_invalidate_transform_propagation();
+		}
+		data.ignore_notification = p_ignore;
+	}
 
 	_FORCE_INLINE_ void _update_local_transform() const;
 	_FORCE_INLINE_ void _update_rotation_and_scale() const;
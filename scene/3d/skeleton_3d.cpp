@@ -31,11 +31,15 @@
 #include "skeleton_3d.h"
 #include "skeleton_3d.compat.inc"
 
+#include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
 #include "scene/3d/skeleton_modifier_3d.h"
 #if !defined(DISABLE_DEPRECATED) && !defined(PHYSICS_3D_DISABLED)
 #include "scene/3d/physics/physical_bone_simulator_3d.h"
 #endif // _DISABLE_DEPRECATED && PHYSICS_3D_DISABLED
 
+LocalVector<ObjectID> Skeleton3D::batched_update_queue;
+
 void SkinReference::_skin_changed() {
 	if (skeleton_node) {
 		skeleton_node->_make_dirty();
@@ -323,7 +327,7 @@ void Skeleton3D::_notification(int p_what) {
 			setup_simulator();
 #endif // _DISABLE_DEPRECATED && PHYSICS_3D_DISABLED
 			update_flags = UPDATE_FLAG_POSE;
-			_notification(NOTIFICATION_UPDATE_SKELETON);
+			_update_skeleton();
 		} break;
 #ifdef TOOLS_ENABLED
 		case NOTIFICATION_EDITOR_PRE_SAVE: {
@@ -334,118 +338,191 @@ void Skeleton3D::_notification(int p_what) {
 		} break;
 #endif // TOOLS_ENABLED
 		case NOTIFICATION_UPDATE_SKELETON: {
-			// Update bone transforms to apply unprocessed poses.
-			force_update_all_dirty_bones();
+			if (_can_update_on_threads()) {
+				_queue_batched_update();
+			} else {
+				_update_skeleton();
+			}
+		} break;
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			advance(get_process_delta_time());
+		} break;
+		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
+			advance(get_physics_process_delta_time());
+		} break;
+	}
+}
 
-			updating = true;
+void Skeleton3D::_update_skeleton() {
+	// Update bone transforms to apply unprocessed poses.
+	force_update_all_dirty_bones();
 
-			Bone *bonesptr = bones.ptr();
-			int len = bones.size();
+	updating = true;
 
-			thread_local LocalVector<bool> bone_global_pose_dirty_backup;
+	Bone *bonesptr = bones.ptr();
 
-			// Process modifiers.
+	thread_local LocalVector<bool> bone_global_pose_dirty_backup;
 
-			thread_local LocalVector<BonePoseBackup> bones_backup;
-			_find_modifiers();
-			if (!modifiers.is_empty()) {
-				bones_backup.resize(bones.size());
-				// Store unmodified bone poses.
-				for (uint32_t i = 0; i < bones.size(); i++) {
-					bones_backup[i].save(bonesptr[i]);
-				}
-				// Store dirty flags for global bone poses.
-				bone_global_pose_dirty_backup = bone_global_pose_dirty;
+	// Process modifiers.
 
-				if (update_flags & UPDATE_FLAG_MODIFIER) {
-					_process_modifiers();
-				}
-			}
+	thread_local LocalVector<BonePoseBackup> bones_backup;
+	_find_modifiers();
+	if (!modifiers.is_empty()) {
+		bones_backup.resize(bones.size());
+		// Store unmodified bone poses.
+		for (uint32_t i = 0; i < bones.size(); i++) {
+			bones_backup[i].save(bonesptr[i]);
+		}
+		// Store dirty flags for global bone poses.
+		bone_global_pose_dirty_backup = bone_global_pose_dirty;
 
-			// Abort if pose is not changed.
-			if (!(update_flags & UPDATE_FLAG_POSE)) {
-				updating = false;
-				update_flags = UPDATE_FLAG_NONE;
-				return;
-			}
+		if (update_flags & UPDATE_FLAG_MODIFIER) {
+			_process_modifiers();
+		}
+	}
 
-			emit_signal(SceneStringName(skeleton_updated));
+	// Abort if pose is not changed.
+	if (!(update_flags & UPDATE_FLAG_POSE)) {
+		updating = false;
+		update_flags = UPDATE_FLAG_NONE;
+		return;
+	}
 
-			// Update skins.
-			RenderingServer *rs = RenderingServer::get_singleton();
-			for (SkinReference *E : skin_bindings) {
-				const Skin *skin = E->skin.operator->();
-				RID skeleton = E->skeleton;
-				uint32_t bind_count = skin->get_bind_count();
+	emit_signal(SceneStringName(skeleton_updated));
 
-				if (E->bind_count != bind_count) {
-					RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
-					E->bind_count = bind_count;
-					E->skin_bone_indices.resize(bind_count);
-					E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
-				}
+	// Update skins.
+	_update_skin_bindings();
+	_update_skin_transforms();
+	_apply_skin_transforms();
 
-				if (E->skeleton_version != version) {
-					for (uint32_t i = 0; i < bind_count; i++) {
-						StringName bind_name = skin->get_bind_name(i);
-
-						if (bind_name != StringName()) {
-							// Bind name used, use this.
-							bool found = false;
-							for (int j = 0; j < len; j++) {
-								if (bonesptr[j].name == bind_name) {
-									E->skin_bone_indices_ptrs[i] = j;
-									found = true;
-									break;
-								}
-							}
-
-							if (!found) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
-								E->skin_bone_indices_ptrs[i] = 0;
-							}
-						} else if (skin->get_bind_bone(i) >= 0) {
-							int bind_index = skin->get_bind_bone(i);
-							if (bind_index >= len) {
-								ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
-								E->skin_bone_indices_ptrs[i] = 0;
-							} else {
-								E->skin_bone_indices_ptrs[i] = bind_index;
-							}
-						} else {
-							ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
-							E->skin_bone_indices_ptrs[i] = 0;
-						}
-					}
+	if (!modifiers.is_empty()) {
+		// Restore unmodified bone poses.
+		for (uint32_t i = 0; i < bones.size(); i++) {
+			bones_backup[i].restore(bones[i]);
+		}
+		// Restore dirty flags for global bone poses.
+		bone_global_pose_dirty = bone_global_pose_dirty_backup;
+	}
 
-					E->skeleton_version = version;
-				}
+	updating = false;
+	update_flags = UPDATE_FLAG_NONE;
+}
 
-				for (uint32_t i = 0; i < bind_count; i++) {
-					uint32_t bone_index = E->skin_bone_indices_ptrs[i];
-					ERR_CONTINUE(bone_index >= (uint32_t)len);
-					rs->skeleton_bone_set_transform(skeleton, i, bonesptr[bone_index].global_pose * skin->get_bind_pose(i));
-				}
-			}
+bool Skeleton3D::_can_update_on_threads() {
+	if (!GLOBAL_GET_CACHED(bool, "animation/skeleton/multithreaded_update")) {
+		return false;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+#endif // TOOLS_ENABLED
+	if (!Thread::is_main_thread() || !(update_flags & UPDATE_FLAG_POSE)) {
+		return false;
+	}
+	// Modifiers may access other nodes, so they are processed one skeleton after another.
+	_find_modifiers();
+	return modifiers.is_empty();
+}
 
-			if (!modifiers.is_empty()) {
-				// Restore unmodified bone poses.
-				for (uint32_t i = 0; i < bones.size(); i++) {
-					bones_backup[i].restore(bones[i]);
-				}
-				// Restore dirty flags for global bone poses.
-				bone_global_pose_dirty = bone_global_pose_dirty_backup;
-			}
+void Skeleton3D::_queue_batched_update() {
+	if (batched_update_pending) {
+		return;
+	}
+	batched_update_pending = true;
+	if (batched_update_queue.is_empty()) {
+		// Runs when the message queue is flushed after the other skeletons were queued.
+		callable_mp_static(&Skeleton3D::_process_batched_updates).call_deferred();
+	}
+	batched_update_queue.push_back(get_instance_id());
+}
 
-			updating = false;
-			update_flags = UPDATE_FLAG_NONE;
-		} break;
-		case NOTIFICATION_INTERNAL_PROCESS: {
-			advance(get_process_delta_time());
-		} break;
-		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
-			advance(get_physics_process_delta_time());
-		} break;
+void Skeleton3D::_prepare_batched_update() {
+	_find_modifiers();
+	if (!modifiers.is_empty()) {
+		// Modifiers were added after the update was queued.
+		batched_update_pending = false;
+		_update_skeleton();
+		return;
+	}
+
+	// Everything that may emit signals or call the RenderingServer happens before the poses are computed on threads.
+	_update_process_order();
+	_update_skin_bindings();
+	updating = true;
+}
+
+void Skeleton3D::_finish_batched_update() {
+	if (!batched_update_pending) {
+		return;
+	}
+	batched_update_pending = false;
+
+	if (dirty) {
+		// The bone hierarchy changed while preparing the update.
+		_force_update_all_dirty_bones();
+		_update_skin_transforms();
+		batched_pose_dirty = true;
+	}
+	if (batched_rest_dirty) {
+		emit_signal(SNAME("rest_updated"));
+	}
+	if (batched_pose_dirty) {
+		emit_signal(SceneStringName(pose_updated));
+	}
+	emit_signal(SceneStringName(skeleton_updated));
+	_apply_skin_transforms();
+
+	updating = false;
+	update_flags = UPDATE_FLAG_NONE;
+}
+
+void Skeleton3D::_batched_update_poses(void *p_userdata, uint32_t p_index) {
+	Skeleton3D *skeleton = static_cast<Skeleton3D **>(p_userdata)[p_index];
+	skeleton->batched_pose_dirty = false;
+	skeleton->batched_rest_dirty = false;
+	if (skeleton->dirty && !skeleton->process_order_dirty) {
+		skeleton->batched_pose_dirty = true;
+		skeleton->batched_rest_dirty = skeleton->rest_dirty;
+		skeleton->_update_dirty_bone_global_poses();
+		skeleton->rest_dirty = false;
+		skeleton->dirty = false;
+	}
+	skeleton->_update_skin_transforms();
+}
+
+void Skeleton3D::_process_batched_updates() {
+	LocalVector<ObjectID> queue = std::move(batched_update_queue);
+	batched_update_queue.clear();
+
+	for (const ObjectID &id : queue) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton && skeleton->batched_update_pending) {
+			skeleton->_prepare_batched_update();
+		}
+	}
+
+	// Signals may free skeletons, so they are looked up again.
+	LocalVector<Skeleton3D *> skeletons;
+	for (const ObjectID &id : queue) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton && skeleton->batched_update_pending) {
+			skeletons.push_back(skeleton);
+		}
+	}
+
+	if (skeletons.size() > 1) {
+		WorkerThreadPool::GroupID group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&Skeleton3D::_batched_update_poses, skeletons.ptr(), skeletons.size(), -1, true, SNAME("Skeleton3DUpdate"));
+		WorkerThreadPool::get_singleton()->wait_for_group_task_completion(group_task);
+	} else if (skeletons.size() == 1) {
+		_batched_update_poses(skeletons.ptr(), 0);
+	}
+
+	for (const ObjectID &id : queue) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(id);
+		if (skeleton) {
+			skeleton->_finish_batched_update();
+		}
 	}
 }
 
@@ -997,6 +1074,87 @@ void Skeleton3D::_skin_changed() {
 	_make_dirty();
 }
 
+void Skeleton3D::_update_skin_bindings() {
+	const Bone *bonesptr = bones.ptr();
+	int len = bones.size();
+
+	for (SkinReference *E : skin_bindings) {
+		const Skin *skin = E->skin.operator->();
+		RID skeleton = E->skeleton;
+		uint32_t bind_count = skin->get_bind_count();
+
+		if (E->bind_count != bind_count) {
+			RS::get_singleton()->skeleton_allocate_data(skeleton, bind_count);
+			E->bind_count = bind_count;
+			E->skin_bone_indices.resize(bind_count);
+			E->skin_bone_indices_ptrs = E->skin_bone_indices.ptrw();
+			E->skin_transforms.resize(bind_count);
+		}
+
+		if (E->skeleton_version != version) {
+			for (uint32_t i = 0; i < bind_count; i++) {
+				StringName bind_name = skin->get_bind_name(i);
+
+				if (bind_name != StringName()) {
+					// Bind name used, use this.
+					bool found = false;
+					for (int j = 0; j < len; j++) {
+						if (bonesptr[j].name == bind_name) {
+							E->skin_bone_indices_ptrs[i] = j;
+							found = true;
+							break;
+						}
+					}
+
+					if (!found) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains named bind '" + String(bind_name) + "' but Skeleton3D has no bone by that name.");
+						E->skin_bone_indices_ptrs[i] = 0;
+					}
+				} else if (skin->get_bind_bone(i) >= 0) {
+					int bind_index = skin->get_bind_bone(i);
+					if (bind_index >= len) {
+						ERR_PRINT("Skin bind #" + itos(i) + " contains bone index bind: " + itos(bind_index) + " , which is greater than the skeleton bone count: " + itos(len) + ".");
+						E->skin_bone_indices_ptrs[i] = 0;
+					} else {
+						E->skin_bone_indices_ptrs[i] = bind_index;
+					}
+				} else {
+					ERR_PRINT("Skin bind #" + itos(i) + " does not contain a name nor a bone index.");
+					E->skin_bone_indices_ptrs[i] = 0;
+				}
+			}
+
+			E->skeleton_version = version;
+		}
+	}
+}
+
+void Skeleton3D::_update_skin_transforms() const {
+	const Bone *bonesptr = bones.ptr();
+	uint32_t len = bones.size();
+
+	// Only reads the skins and writes to the buffers of this skeleton, so skeletons can be updated on several threads.
+	for (SkinReference *E : skin_bindings) {
+		const Skin *skin = E->skin.operator->();
+		Transform3D *transforms = E->skin_transforms.ptr();
+		for (uint32_t i = 0; i < E->bind_count; i++) {
+			uint32_t bone_index = E->skin_bone_indices_ptrs[i];
+			ERR_CONTINUE(bone_index >= len);
+			transforms[i] = bonesptr[bone_index].global_pose * skin->get_bind_pose(i);
+		}
+	}
+}
+
+void Skeleton3D::_apply_skin_transforms() {
+	RenderingServer *rs = RenderingServer::get_singleton();
+	for (SkinReference *E : skin_bindings) {
+		const Transform3D *transforms = E->skin_transforms.ptr();
+		for (uint32_t i = 0; i < E->bind_count; i++) {
+			rs->skeleton_bone_set_transform(E->skeleton, i, transforms[i]);
+		}
+	}
+}
+
 Ref<Skin> Skeleton3D::create_skin_from_rest_transforms() {
 	Ref<Skin> skin;
 
@@ -1111,7 +1269,12 @@ void Skeleton3D::_force_update_bone_children_transforms(int p_bone_idx) const {
 	ERR_FAIL_INDEX(p_bone_idx, bone_size);
 
 	_update_process_order();
+	_update_dirty_bone_global_poses();
+}
 
+void Skeleton3D::_update_dirty_bone_global_poses() const {
+	// The process order must be up to date, parents always come before their children in the nested set.
+	const int bone_size = bones.size();
 	Bone *bonesptr = bones.ptr();
 
 	// Loop through nested set.
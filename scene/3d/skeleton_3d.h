@@ -41,6 +41,7 @@ class Skeleton3D;
 class SkinReference : public RefCounted {
 	GDCLASS(SkinReference, RefCounted)
 	friend class Skeleton3D;
+	friend class TestSkeleton3DInternalsAccessor;
 
 	Skeleton3D *skeleton_node = nullptr;
 	RID skeleton;
@@ -49,6 +50,7 @@ class SkinReference : public RefCounted {
 	uint64_t skeleton_version = 0;
 	Vector<uint32_t> skin_bone_indices;
 	uint32_t *skin_bone_indices_ptrs = nullptr;
+	LocalVector<Transform3D> skin_transforms;
 
 protected:
 	static void _bind_methods();
@@ -64,6 +66,7 @@ public:
 
 class Skeleton3D : public Node3D {
 	GDCLASS(Skeleton3D, Node3D);
+	friend class TestSkeleton3DInternalsAccessor;
 
 #ifdef TOOLS_ENABLED
 	bool saving = false;
@@ -159,6 +162,9 @@ private:
 
 	HashSet<SkinReference *> skin_bindings;
 	void _skin_changed();
+	void _update_skin_bindings();
+	void _update_skin_transforms() const;
+	void _apply_skin_transforms();
 
 	mutable LocalVector<Bone> bones;
 	mutable bool process_order_dirty = false;
@@ -188,6 +194,21 @@ private:
 	void _process_modifiers();
 	void _process_changed();
 	void _make_modifiers_dirty();
+	void _update_skeleton();
+
+	// Skeletons without modifiers updated in the same frame compute their global poses and skin transforms
+	// on the WorkerThreadPool, then emit their signals and send the skins one after another.
+	bool batched_update_pending = false;
+	bool batched_pose_dirty = false;
+	bool batched_rest_dirty = false;
+	static LocalVector<ObjectID> batched_update_queue;
+
+	bool _can_update_on_threads();
+	void _queue_batched_update();
+	void _prepare_batched_update();
+	void _finish_batched_update();
+	static void _batched_update_poses(void *p_userdata, uint32_t p_index);
+	static void _process_batched_updates();
 
 	// Global bone pose calculation.
 	mutable LocalVector<int> nested_set_offset_to_bone_index; // Map from Bone::nested_set_offset to bone index.
@@ -197,6 +218,7 @@ private:
 	void _make_bone_global_poses_dirty() const;
 	void _make_bone_global_pose_subtree_dirty(int p_bone) const;
 	void _update_bone_global_pose(int p_bone) const;
+	void _update_dirty_bone_global_poses() const;
 
 #ifndef DISABLE_DEPRECATED
 	void _add_bone_bind_compat_88791(const String &p_name);
@@ -33,6 +33,8 @@
 
 #include "core/config/engine.h"
 #include "core/config/project_settings.h"
+#include "core/object/worker_thread_pool.h"
+#include "core/os/thread.h"
 #include "core/string/string_name.h"
 #include "scene/2d/audio_stream_player_2d.h"
 #include "scene/animation/animation_player.h"
@@ -45,13 +47,21 @@
 #include "scene/3d/audio_stream_player_3d.h"
 #include "scene/3d/mesh_instance_3d.h"
 #include "scene/3d/node_3d.h"
+#include "scene/3d/camera_3d.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/main/viewport.h"
 #endif // _3D_DISABLED
 
 #ifdef TOOLS_ENABLED
 #include "editor/editor_undo_redo_manager.h"
 #endif // TOOLS_ENABLED
 
+LocalVector<ObjectID> AnimationMixer::threaded_blend_queue;
+WorkerThreadPool::GroupID AnimationMixer::threaded_blend_group_task = WorkerThreadPool::INVALID_TASK_ID;
+AnimationMixer::LODFrameInfo AnimationMixer::lod_frame_info;
+Mutex AnimationMixer::lod_frame_info_mutex;
+
 bool AnimationMixer::_set(const StringName &p_name, const Variant &p_value) {
 	String name = p_name;
 
@@ -483,6 +493,23 @@ bool AnimationMixer::is_deterministic() const {
 	return deterministic;
 }
 
+void AnimationMixer::set_lod_enabled(bool p_enabled) {
+	lod_enabled = p_enabled;
+}
+
+bool AnimationMixer::is_lod_enabled() const {
+	return lod_enabled;
+}
+
+void AnimationMixer::set_lod_update_interval_override(int p_interval) {
+	ERR_FAIL_COND(p_interval < 0);
+	lod_update_interval_override = p_interval;
+}
+
+int AnimationMixer::get_lod_update_interval_override() const {
+	return lod_update_interval_override;
+}
+
 void AnimationMixer::set_callback_mode_process(AnimationCallbackModeProcess p_mode) {
 	if (callback_mode_process == p_mode) {
 		return;
@@ -566,6 +593,7 @@ bool AnimationMixer::is_dummy() const {
 /* -------------------------------------------- */
 
 void AnimationMixer::_clear_caches() {
+	_finish_threaded_blend();
 	_init_root_motion_cache();
 	_clear_audio_streams();
 	_clear_playing_caches();
@@ -574,6 +602,7 @@ void AnimationMixer::_clear_caches() {
 	}
 	track_cache.clear();
 	animation_track_num_to_track_cache.clear();
+	skeleton_poses.clear();
 	cache_valid = false;
 	capture_cache.clear();
 
@@ -610,6 +639,88 @@ void AnimationMixer::_init_root_motion_cache() {
 	root_motion_scale_accumulator = Vector3(1, 1, 1);
 }
 
+void AnimationMixer::_build_skeleton_poses() {
+	skeleton_poses.clear();
+#ifndef _3D_DISABLED
+	AHashMap<ObjectID, uint32_t> skeleton_to_pose;
+	for (const KeyValue<Animation::TypeHash, TrackCache *> &K : track_cache) {
+		if (K.value->type != Animation::TYPE_POSITION_3D) {
+			continue;
+		}
+		TrackCacheTransform *t = static_cast<TrackCacheTransform *>(K.value);
+		t->skeleton_pose = -1;
+		if (!t->skeleton_id.is_valid() || t->bone_idx < 0) {
+			continue;
+		}
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
+		if (!skeleton || t->bone_idx >= skeleton->get_bone_count()) {
+			continue;
+		}
+
+		uint32_t pose_idx;
+		const uint32_t *existing_pose_idx = skeleton_to_pose.getptr(t->skeleton_id);
+		if (existing_pose_idx) {
+			pose_idx = *existing_pose_idx;
+		} else {
+			uint32_t bone_count = skeleton->get_bone_count();
+			SkeletonPose pose;
+			pose.skeleton_id = t->skeleton_id;
+			pose.tracks.resize(bone_count);
+			for (uint32_t i = 0; i < bone_count; i++) {
+				pose.tracks[i] = nullptr;
+			}
+			pose.init_positions.resize(bone_count);
+			pose.init_rotations.resize(bone_count);
+			pose.init_scales.resize(bone_count);
+			pose.positions.resize(bone_count);
+			pose.rotations.resize(bone_count);
+			pose.scales.resize(bone_count);
+			pose.previous_positions.resize(bone_count);
+			pose.previous_rotations.resize(bone_count);
+			pose.previous_scales.resize(bone_count);
+			pose_idx = skeleton_poses.size();
+			skeleton_poses.push_back(pose);
+			skeleton_to_pose.insert(t->skeleton_id, pose_idx);
+		}
+
+		SkeletonPose &pose = skeleton_poses[pose_idx];
+		pose.tracks[t->bone_idx] = t;
+		pose.init_positions[t->bone_idx] = t->init_loc;
+		pose.init_rotations[t->bone_idx] = t->init_rot;
+		pose.init_scales[t->bone_idx] = t->init_scale;
+		t->skeleton_pose = pose_idx;
+	}
+#endif // _3D_DISABLED
+}
+
+void AnimationMixer::_apply_skeleton_poses() {
+#ifndef _3D_DISABLED
+	for (const SkeletonPose &pose : skeleton_poses) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(pose.skeleton_id);
+		if (!skeleton) {
+			continue;
+		}
+		uint32_t bone_count = pose.tracks.size();
+		bool interpolate = pose.has_previous && lod_pose_weight < 1.0;
+		for (uint32_t i = 0; i < bone_count; i++) {
+			const TrackCacheTransform *t = pose.tracks[i];
+			if (!t || t->root_motion || (!deterministic && Math::is_zero_approx(t->total_weight))) {
+				continue;
+			}
+			if (t->loc_used) {
+				skeleton->set_bone_pose_position(i, interpolate ? pose.previous_positions[i].lerp(pose.positions[i], lod_pose_weight) : pose.positions[i]);
+			}
+			if (t->rot_used) {
+				skeleton->set_bone_pose_rotation(i, interpolate ? pose.previous_rotations[i].slerp(pose.rotations[i], lod_pose_weight) : pose.rotations[i]);
+			}
+			if (t->scale_used && !lod_reduce_tracks) {
+				skeleton->set_bone_pose_scale(i, interpolate ? pose.previous_scales[i].lerp(pose.scales[i], lod_pose_weight) : pose.scales[i]);
+			}
+		}
+	}
+#endif // _3D_DISABLED
+}
+
 void AnimationMixer::_create_track_num_to_track_cache_for_animation(Ref<Animation> &p_animation) {
 	if (animation_track_num_to_track_cache.has(p_animation)) {
 		// In AnimationMixer::_update_caches, it retrieves all animations via AnimationMixer::get_animation_list
@@ -632,6 +743,7 @@ void AnimationMixer::_create_track_num_to_track_cache_for_animation(Ref<Animatio
 
 bool AnimationMixer::_update_caches() {
 	setup_pass++;
+	skeleton_poses.clear();
 
 	root_motion_cache.loc = Vector3(0, 0, 0);
 	root_motion_cache.rot = Quaternion(0, 0, 0, 1);
@@ -648,6 +760,7 @@ bool AnimationMixer::_update_caches() {
 		cache_valid = false;
 		return false;
 	}
+	_update_lod_nodes(parent);
 
 #ifdef TOOLS_ENABLED
 	String mixer_name = "AnimationMixer";
@@ -974,6 +1087,8 @@ bool AnimationMixer::_update_caches() {
 
 	track_count = idx;
 
+	_build_skeleton_poses();
+
 	cache_valid = true;
 
 	return true;
@@ -996,6 +1111,240 @@ void AnimationMixer::_process_animation(double p_delta, bool p_update_only) {
 	clear_animation_instances();
 }
 
+bool AnimationMixer::_can_blend_on_threads() {
+	if (!GLOBAL_GET_CACHED(bool, "animation/mixer/multithreaded_blending")) {
+		return false;
+	}
+#ifdef TOOLS_ENABLED
+	if (Engine::get_singleton()->is_editor_hint()) {
+		return false;
+	}
+#endif // TOOLS_ENABLED
+	// Mixers processed in a thread group are blended right away, as are scripts post processing the key values.
+	return Thread::is_main_thread() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+}
+
+void AnimationMixer::_queue_threaded_blend(double p_delta) {
+	_blend_init();
+	if (!_blend_pre_process(p_delta, track_count, track_map)) {
+		clear_animation_instances();
+		return;
+	}
+	_blend_capture(p_delta);
+	_blend_calc_total_weight();
+
+	threaded_blend_pending = true;
+	threaded_blend_sampled = false;
+	threaded_blend_delta = p_delta;
+	if (threaded_blend_queue.is_empty()) {
+		// Runs when the message queue is flushed after processing the nodes.
+		callable_mp_static(&AnimationMixer::_process_threaded_blends).call_deferred();
+	}
+	threaded_blend_queue.push_back(get_instance_id());
+}
+
+void AnimationMixer::_finish_threaded_blend() {
+	if (!threaded_blend_pending) {
+		return;
+	}
+	threaded_blend_pending = false;
+
+	if (!threaded_blend_sampled) {
+		_blend_process(threaded_blend_delta, false, BLEND_PROCESS_TRACKS_SAMPLED);
+	}
+	_blend_process(threaded_blend_delta, false, BLEND_PROCESS_TRACKS_DEFERRED);
+	_blend_apply();
+	_blend_post_process();
+	emit_signal(SNAME("mixer_applied"));
+	clear_animation_instances();
+}
+
+// Used when the mixer is torn down. Applying the blend here would write to nodes that are being removed.
+void AnimationMixer::_discard_threaded_blend() {
+	if (!threaded_blend_pending) {
+		return;
+	}
+	threaded_blend_pending = false;
+
+	// The samples may still be written while the caches are freed.
+	_wait_for_threaded_blend_samples();
+	threaded_blend_sampled = false;
+	threaded_blend_queue.erase(get_instance_id());
+	clear_animation_instances();
+}
+
+void AnimationMixer::_wait_for_threaded_blend_samples() {
+	// Only mixers processed on the main thread blend on threads, so this is never accessed concurrently.
+	if (threaded_blend_group_task == WorkerThreadPool::INVALID_TASK_ID) {
+		return;
+	}
+	WorkerThreadPool::get_singleton()->wait_for_group_task_completion(threaded_blend_group_task);
+	threaded_blend_group_task = WorkerThreadPool::INVALID_TASK_ID;
+}
+
+void AnimationMixer::_threaded_blend_sample(void *p_userdata, uint32_t p_index) {
+	AnimationMixer *mixer = static_cast<AnimationMixer **>(p_userdata)[p_index];
+	mixer->_blend_process(mixer->threaded_blend_delta, false, BLEND_PROCESS_TRACKS_SAMPLED);
+	mixer->threaded_blend_sampled = true;
+}
+
+void AnimationMixer::_process_threaded_blends() {
+	LocalVector<ObjectID> queue = std::move(threaded_blend_queue);
+	threaded_blend_queue.clear();
+
+	LocalVector<AnimationMixer *> mixers;
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer && mixer->threaded_blend_pending && !mixer->threaded_blend_sampled) {
+			mixers.push_back(mixer);
+		}
+	}
+
+	if (mixers.size() > 1) {
+		threaded_blend_group_task = WorkerThreadPool::get_singleton()->add_native_group_task(&AnimationMixer::_threaded_blend_sample, mixers.ptr(), mixers.size(), -1, true, SNAME("AnimationMixerBlend"));
+		_wait_for_threaded_blend_samples();
+	}
+
+	// Method calls and signals may free mixers, so they are looked up again.
+	for (const ObjectID &id : queue) {
+		AnimationMixer *mixer = ObjectDB::get_instance<AnimationMixer>(id);
+		if (mixer) {
+			mixer->_finish_threaded_blend();
+		}
+	}
+}
+
+void AnimationMixer::_update_lod_nodes(Node *p_root) {
+	lod_root_id = ObjectID();
+	lod_notifier_id = ObjectID();
+#ifndef _3D_DISABLED
+	if (!Object::cast_to<Node3D>(p_root)) {
+		return;
+	}
+	lod_root_id = p_root->get_instance_id();
+	for (int i = 0; i < p_root->get_child_count(); i++) {
+		VisibleOnScreenNotifier3D *notifier = Object::cast_to<VisibleOnScreenNotifier3D>(p_root->get_child(i));
+		if (notifier) {
+			lod_notifier_id = notifier->get_instance_id();
+			break;
+		}
+	}
+#endif // _3D_DISABLED
+}
+
+uint32_t AnimationMixer::_get_lod_update_interval(bool &r_reduce_tracks) const {
+	r_reduce_tracks = false;
+#ifndef _3D_DISABLED
+	Node3D *root = ObjectDB::get_instance<Node3D>(lod_root_id);
+	if (!root || !root->is_inside_tree()) {
+		return 1;
+	}
+	bool reduce_tracks = GLOBAL_GET_CACHED(bool, "animation/lod/reduce_far_tracks");
+
+	VisibleOnScreenNotifier3D *notifier = ObjectDB::get_instance<VisibleOnScreenNotifier3D>(lod_notifier_id);
+	if (notifier && notifier->is_inside_tree() && !notifier->is_on_screen()) {
+		r_reduce_tracks = reduce_tracks;
+		return MAX(1, GLOBAL_GET_CACHED(int, "animation/lod/offscreen_update_interval"));
+	}
+
+	Camera3D *camera = root->get_viewport()->get_camera_3d();
+	if (!camera) {
+		return 1;
+	}
+	real_t distance = camera->get_global_position().distance_to(root->get_global_position());
+	if (distance >= GLOBAL_GET_CACHED(real_t, "animation/lod/far_distance")) {
+		r_reduce_tracks = reduce_tracks;
+		return MAX(1, GLOBAL_GET_CACHED(int, "animation/lod/far_update_interval"));
+	}
+	if (distance >= GLOBAL_GET_CACHED(real_t, "animation/lod/medium_distance")) {
+		return MAX(1, GLOBAL_GET_CACHED(int, "animation/lod/medium_update_interval"));
+	}
+#endif // _3D_DISABLED
+	return 1;
+}
+
+bool AnimationMixer::_lod_process(double &r_delta) {
+	bool use_lod = lod_enabled && (lod_update_interval_override > 0 || GLOBAL_GET_CACHED(bool, "animation/lod/enabled")) && Thread::is_main_thread();
+#ifdef TOOLS_ENABLED
+	use_lod = use_lod && !Engine::get_singleton()->is_editor_hint();
+#endif // TOOLS_ENABLED
+	if (!use_lod) {
+		lod_update_interval = 1;
+		lod_skipped_frames = 0;
+		lod_delta = 0.0;
+		lod_reduce_tracks = false;
+		lod_interpolate_poses = false;
+		lod_pose_weight = 1.0;
+		return true;
+	}
+
+	lod_delta += r_delta;
+	lod_skipped_frames++;
+	if (lod_skipped_frames < lod_update_interval) {
+		// The motion of the skipped frames is reported with the next blend.
+		root_motion_position = Vector3(0, 0, 0);
+		root_motion_rotation = Quaternion(0, 0, 0, 1);
+		root_motion_scale = Vector3(0, 0, 0);
+		if (lod_interpolate_poses && use_skeleton_poses) {
+			lod_pose_weight = real_t(lod_skipped_frames) / real_t(lod_update_interval);
+			_apply_skeleton_poses();
+		}
+		_count_lod_frame(false);
+		return false;
+	}
+
+	r_delta = lod_delta;
+	lod_delta = 0.0;
+	lod_skipped_frames = 0;
+	if (lod_update_interval_override > 0) {
+		lod_update_interval = lod_update_interval_override;
+		lod_reduce_tracks = false;
+	} else {
+		lod_update_interval = _get_lod_update_interval(lod_reduce_tracks);
+	}
+	// Starts from the previous pose, so the skipped frames can move toward the new one.
+	lod_interpolate_poses = lod_update_interval > 1 && GLOBAL_GET_CACHED(bool, "animation/lod/interpolate_poses");
+	lod_pose_weight = lod_interpolate_poses ? 0.0 : 1.0;
+	_count_lod_frame(true);
+	return true;
+}
+
+void AnimationMixer::_count_lod_frame(bool p_updated) {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	MutexLock lock(lod_frame_info_mutex);
+	if (lod_frame_info.frame != frame) {
+		bool consecutive = lod_frame_info.frame + 1 == frame;
+		lod_frame_info.previous_updated = consecutive ? lod_frame_info.updated : 0;
+		lod_frame_info.previous_skipped = consecutive ? lod_frame_info.skipped : 0;
+		lod_frame_info.updated = 0;
+		lod_frame_info.skipped = 0;
+		lod_frame_info.frame = frame;
+	}
+	if (p_updated) {
+		lod_frame_info.updated++;
+	} else {
+		lod_frame_info.skipped++;
+	}
+}
+
+uint32_t AnimationMixer::get_lod_updated_mixer_count() {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	MutexLock lock(lod_frame_info_mutex);
+	if (lod_frame_info.frame == frame) {
+		return lod_frame_info.previous_updated;
+	}
+	return lod_frame_info.frame + 1 == frame ? lod_frame_info.updated : 0;
+}
+
+uint32_t AnimationMixer::get_lod_skipped_mixer_count() {
+	uint64_t frame = Engine::get_singleton()->get_process_frames();
+	MutexLock lock(lod_frame_info_mutex);
+	if (lod_frame_info.frame == frame) {
+		return lod_frame_info.previous_skipped;
+	}
+	return lod_frame_info.frame + 1 == frame ? lod_frame_info.skipped : 0;
+}
+
 Variant AnimationMixer::_post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant &p_value, ObjectID p_object_id, int p_object_sub_idx) {
 #ifndef _3D_DISABLED
 	switch (p_anim->track_get_type(p_track)) {
@@ -1027,6 +1376,9 @@ Variant AnimationMixer::post_process_key_value(const Ref<Animation> &p_anim, int
 }
 
 void AnimationMixer::_blend_init() {
+	// A blend that is still waiting for the other mixers must be applied before the track caches are reset.
+	_finish_threaded_blend();
+
 	// Check all tracks, see if they need modification.
 	root_motion_position = Vector3(0, 0, 0);
 	root_motion_rotation = Quaternion(0, 0, 0, 1);
@@ -1034,6 +1386,7 @@ void AnimationMixer::_blend_init() {
 	root_motion_position_accumulator = Vector3(0, 0, 0);
 	root_motion_rotation_accumulator = Quaternion(0, 0, 0, 1);
 	root_motion_scale_accumulator = Vector3(1, 1, 1);
+	use_skeleton_poses = false;
 
 	if (!cache_valid) {
 		if (!_update_caches()) {
@@ -1081,6 +1434,35 @@ void AnimationMixer::_blend_init() {
 			} break;
 		}
 	}
+
+	use_skeleton_poses = !skeleton_poses.is_empty() && !GDVIRTUAL_IS_OVERRIDDEN(_post_process_key_value);
+	if (use_skeleton_poses) {
+		_init_skeleton_poses();
+	}
+}
+
+void AnimationMixer::_init_skeleton_poses() {
+#ifndef _3D_DISABLED
+	for (SkeletonPose &pose : skeleton_poses) {
+		Skeleton3D *skeleton = ObjectDB::get_instance<Skeleton3D>(pose.skeleton_id);
+		pose.motion_scale = skeleton ? skeleton->get_motion_scale() : 1.0;
+		uint32_t bone_count = pose.tracks.size();
+		pose.has_previous = lod_interpolate_poses && pose.blended;
+		if (pose.has_previous) {
+			for (uint32_t i = 0; i < bone_count; i++) {
+				pose.previous_positions[i] = pose.positions[i];
+				pose.previous_rotations[i] = pose.rotations[i];
+				pose.previous_scales[i] = pose.scales[i];
+			}
+		}
+		for (uint32_t i = 0; i < bone_count; i++) {
+			pose.positions[i] = pose.init_positions[i];
+			pose.rotations[i] = pose.init_rotations[i];
+			pose.scales[i] = pose.init_scales[i];
+		}
+		pose.blended = true;
+	}
+#endif // _3D_DISABLED
 }
 
 bool AnimationMixer::_blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map) {
@@ -1165,7 +1547,23 @@ void AnimationMixer::_blend_calc_total_weight() {
 	}
 }
 
-void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
+bool AnimationMixer::_is_deferred_track(const Ref<Animation> &p_animation, int p_track) const {
+	switch (p_animation->track_get_type(p_track)) {
+		case Animation::TYPE_METHOD:
+		case Animation::TYPE_AUDIO:
+		case Animation::TYPE_ANIMATION: {
+			return true;
+		} break;
+		case Animation::TYPE_VALUE: {
+			return p_animation->value_track_get_update_mode(p_track) == Animation::UPDATE_DISCRETE && callback_mode_discrete != ANIMATION_CALLBACK_MODE_DISCRETE_FORCE_CONTINUOUS;
+		} break;
+		default: {
+		} break;
+	}
+	return false;
+}
+
+void AnimationMixer::_blend_process(double p_delta, bool p_update_only, BlendProcessTracks p_tracks) {
 	// Apply value/transform/blend/bezier blends to track caches and execute method/audio/animation tracks.
 #ifdef TOOLS_ENABLED
 	bool can_call = is_inside_tree() && !Engine::get_singleton()->is_editor_hint();
@@ -1193,11 +1591,16 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 		Animation::Track *const *tracks_ptr = tracks.ptr();
 		real_t a_length = a->get_length();
 		int count = tracks.size();
+		// Compressed transform tracks are decoded together rather than one track at a time.
+		bool use_compressed_pose = p_tracks != BLEND_PROCESS_TRACKS_DEFERRED && a->is_compressed() && a->sample_compressed_transform_tracks(time, compressed_pose);
 		for (int i = 0; i < count; i++) {
 			const Animation::Track *animation_track = tracks_ptr[i];
 			if (!animation_track->enabled) {
 				continue;
 			}
+			if (p_tracks != BLEND_PROCESS_TRACKS_ALL && _is_deferred_track(a, i) != (p_tracks == BLEND_PROCESS_TRACKS_DEFERRED)) {
+				continue;
+			}
 			TrackCache *track = track_num_to_track_cache[i];
 			if (track == nullptr) {
 				continue; // No path, but avoid error spamming.
@@ -1214,6 +1617,9 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 				blend = blend / track->total_weight;
 			}
 			Animation::TrackType ttype = animation_track->type;
+			if (lod_reduce_tracks && (ttype == Animation::TYPE_SCALE_3D || ttype == Animation::TYPE_BLEND_SHAPE)) {
+				continue; // Keeps the values applied before the mixer was far away.
+			}
 			track->root_motion = root_motion_track == animation_track->path;
 			switch (ttype) {
 				case Animation::TYPE_POSITION_3D: {
@@ -1350,8 +1756,17 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 loc;
-						Error err = a->try_position_track_interpolate(i, time, &loc);
-						if (err != OK) {
+						if (use_compressed_pose && compressed_pose.sampled[i]) {
+							loc = compressed_pose.positions_scales[i];
+						} else {
+							Error err = a->try_position_track_interpolate(i, time, &loc);
+							if (err != OK) {
+								continue;
+							}
+						}
+						if (use_skeleton_poses && t->skeleton_pose >= 0 && !track->root_motion) {
+							SkeletonPose &pose = skeleton_poses[t->skeleton_pose];
+							pose.positions[t->bone_idx] += (loc * pose.motion_scale - pose.init_positions[t->bone_idx]) * blend;
 							continue;
 						}
 						loc = post_process_key_value(a, i, loc, t->object_id, t->bone_idx);
@@ -1438,8 +1853,17 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Quaternion rot;
-						Error err = a->try_rotation_track_interpolate(i, time, &rot);
-						if (err != OK) {
+						if (use_compressed_pose && compressed_pose.sampled[i]) {
+							rot = compressed_pose.rotations[i];
+						} else {
+							Error err = a->try_rotation_track_interpolate(i, time, &rot);
+							if (err != OK) {
+								continue;
+							}
+						}
+						if (use_skeleton_poses && t->skeleton_pose >= 0 && !track->root_motion) {
+							SkeletonPose &pose = skeleton_poses[t->skeleton_pose];
+							pose.rotations[t->bone_idx] = (pose.rotations[t->bone_idx] * Quaternion().slerp(pose.init_rotations[t->bone_idx].inverse() * rot, blend)).normalized();
 							continue;
 						}
 						rot = post_process_key_value(a, i, rot, t->object_id, t->bone_idx);
@@ -1526,8 +1950,17 @@ void AnimationMixer::_blend_process(double p_delta, bool p_update_only) {
 					}
 					{
 						Vector3 scale;
-						Error err = a->try_scale_track_interpolate(i, time, &scale);
-						if (err != OK) {
+						if (use_compressed_pose && compressed_pose.sampled[i]) {
+							scale = compressed_pose.positions_scales[i];
+						} else {
+							Error err = a->try_scale_track_interpolate(i, time, &scale);
+							if (err != OK) {
+								continue;
+							}
+						}
+						if (use_skeleton_poses && t->skeleton_pose >= 0 && !track->root_motion) {
+							SkeletonPose &pose = skeleton_poses[t->skeleton_pose];
+							pose.scales[t->bone_idx] += (scale - pose.init_scales[t->bone_idx]) * blend;
 							continue;
 						}
 						scale = post_process_key_value(a, i, scale, t->object_id, t->bone_idx);
@@ -1870,6 +2303,8 @@ void AnimationMixer::_blend_apply() {
 					root_motion_position_accumulator = t->loc;
 					root_motion_rotation_accumulator = t->rot;
 					root_motion_scale_accumulator = t->scale;
+				} else if (use_skeleton_poses && t->skeleton_pose >= 0) {
+					// Applied with the rest of the skeleton pose.
 				} else if (t->skeleton_id.is_valid() && t->bone_idx >= 0) {
 					Skeleton3D *t_skeleton = ObjectDB::get_instance<Skeleton3D>(t->skeleton_id);
 					if (!t_skeleton) {
@@ -1881,7 +2316,7 @@ void AnimationMixer::_blend_apply() {
 					if (t->rot_used) {
 						t_skeleton->set_bone_pose_rotation(t->bone_idx, t->rot);
 					}
-					if (t->scale_used) {
+					if (t->scale_used && !lod_reduce_tracks) {
 						t_skeleton->set_bone_pose_scale(t->bone_idx, t->scale);
 					}
 
@@ -1896,7 +2331,7 @@ void AnimationMixer::_blend_apply() {
 					if (t->rot_used) {
 						t_node_3d->set_rotation(t->rot.get_euler());
 					}
-					if (t->scale_used) {
+					if (t->scale_used && !lod_reduce_tracks) {
 						t_node_3d->set_scale(t->scale);
 					}
 				}
@@ -1907,7 +2342,7 @@ void AnimationMixer::_blend_apply() {
 				TrackCacheBlendShape *t = static_cast<TrackCacheBlendShape *>(track);
 
 				MeshInstance3D *t_mesh_3d = ObjectDB::get_instance<MeshInstance3D>(t->object_id);
-				if (t_mesh_3d) {
+				if (t_mesh_3d && !lod_reduce_tracks) {
 					t_mesh_3d->set_blend_shape_value(t->shape_index, t->value);
 				}
 #endif // _3D_DISABLED
@@ -2014,6 +2449,10 @@ void AnimationMixer::_blend_apply() {
 			} // The rest don't matter.
 		}
 	}
+
+	if (use_skeleton_poses) {
+		_apply_skeleton_poses();
+	}
 }
 
 void AnimationMixer::_call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred) {
@@ -2253,6 +2692,10 @@ void AnimationMixer::reset() {
 void AnimationMixer::restore(const Ref<AnimatedValuesBackup> &p_backup) {
 	ERR_FAIL_COND(p_backup.is_null());
 	track_cache = p_backup->get_data();
+	// The backup holds its own values, the skeleton poses belong to the replaced track caches.
+	skeleton_poses.clear();
+	use_skeleton_poses = false;
+	lod_reduce_tracks = false;
 	_blend_apply();
 	track_cache = AHashMap<Animation::TypeHash, AnimationMixer::TrackCache *, HashHasher>();
 	cache_valid = false;
@@ -2337,6 +2780,7 @@ void AnimationMixer::capture(const StringName &p_name, double p_duration, Tween:
 /* -------------------------------------------- */
 
 void AnimationMixer::_node_removed(Node *p_node) {
+	_discard_threaded_blend();
 	_clear_caches();
 }
 
@@ -2352,17 +2796,34 @@ void AnimationMixer::_notification(int p_what) {
 
 		case NOTIFICATION_INTERNAL_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_IDLE) {
-				_process_animation(get_process_delta_time());
+				double delta = get_process_delta_time();
+				if (!_lod_process(delta)) {
+					break;
+				}
+				if (_can_blend_on_threads()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_INTERNAL_PHYSICS_PROCESS: {
 			if (active && callback_mode_process == ANIMATION_CALLBACK_MODE_PROCESS_PHYSICS) {
-				_process_animation(get_physics_process_delta_time());
+				double delta = get_physics_process_delta_time();
+				if (!_lod_process(delta)) {
+					break;
+				}
+				if (_can_blend_on_threads()) {
+					_queue_threaded_blend(delta);
+				} else {
+					_process_animation(delta);
+				}
 			}
 		} break;
 
 		case NOTIFICATION_EXIT_TREE: {
+			_discard_threaded_blend();
 			_clear_caches();
 		} break;
 	}
@@ -2410,6 +2871,11 @@ void AnimationMixer::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_deterministic", "deterministic"), &AnimationMixer::set_deterministic);
 	ClassDB::bind_method(D_METHOD("is_deterministic"), &AnimationMixer::is_deterministic);
 
+	ClassDB::bind_method(D_METHOD("set_lod_enabled", "enabled"), &AnimationMixer::set_lod_enabled);
+	ClassDB::bind_method(D_METHOD("is_lod_enabled"), &AnimationMixer::is_lod_enabled);
+	ClassDB::bind_method(D_METHOD("set_lod_update_interval_override", "interval"), &AnimationMixer::set_lod_update_interval_override);
+	ClassDB::bind_method(D_METHOD("get_lod_update_interval_override"), &AnimationMixer::get_lod_update_interval_override);
+
 	ClassDB::bind_method(D_METHOD("set_root_node", "path"), &AnimationMixer::set_root_node);
 	ClassDB::bind_method(D_METHOD("get_root_node"), &AnimationMixer::get_root_node);
 
@@ -2455,6 +2921,8 @@ void AnimationMixer::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "deterministic"), "set_deterministic", "is_deterministic");
 	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "reset_on_save", PROPERTY_HINT_NONE, ""), "set_reset_on_save_enabled", "is_reset_on_save_enabled");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_node"), "set_root_node", "get_root_node");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "lod_enabled"), "set_lod_enabled", "is_lod_enabled");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "lod_update_interval_override", PROPERTY_HINT_RANGE, "0,60,1,or_greater"), "set_lod_update_interval_override", "get_lod_update_interval_override");
 
 	ADD_GROUP("Root Motion", "root_motion_");
 	ADD_PROPERTY(PropertyInfo(Variant::NODE_PATH, "root_motion_track"), "set_root_motion_track", "get_root_motion_track");
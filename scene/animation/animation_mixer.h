@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include "core/object/worker_thread_pool.h"
 #include "core/templates/a_hash_map.h"
 #include "scene/animation/tween.h"
 #include "scene/main/node.h"
@@ -168,6 +169,7 @@ protected:
 		ObjectID skeleton_id;
 #endif // _3D_DISABLED
 		int bone_idx = -1;
+		int skeleton_pose = -1; // Index in skeleton_poses, the bone is blended there instead of in loc, rot and scale.
 		bool loc_used = false;
 		bool rot_used = false;
 		bool scale_used = false;
@@ -200,6 +202,25 @@ protected:
 		}
 	};
 
+	// Bone transforms of a skeleton blended in contiguous arrays indexed by bone, instead of one track cache at a time.
+	struct SkeletonPose {
+		ObjectID skeleton_id;
+		real_t motion_scale = 1.0;
+		LocalVector<TrackCacheTransform *> tracks; // Null for bones that are not animated.
+		LocalVector<Vector3> init_positions;
+		LocalVector<Quaternion> init_rotations;
+		LocalVector<Vector3> init_scales;
+		LocalVector<Vector3> positions;
+		LocalVector<Quaternion> rotations;
+		LocalVector<Vector3> scales;
+		// The pose blended before the last one, interpolated toward the last one while level of detail skips frames.
+		LocalVector<Vector3> previous_positions;
+		LocalVector<Quaternion> previous_rotations;
+		LocalVector<Vector3> previous_scales;
+		bool blended = false;
+		bool has_previous = false;
+	};
+
 	struct RootMotionCache {
 		Vector3 loc = Vector3(0, 0, 0);
 		Quaternion rot = Quaternion(0, 0, 0, 1);
@@ -308,12 +329,18 @@ protected:
 	AHashMap<Ref<Animation>, LocalVector<TrackCache *>> animation_track_num_to_track_cache;
 	HashSet<TrackCache *> playing_caches;
 	Vector<Node *> playing_audio_stream_players;
+	Animation::CompressedTransformPose compressed_pose; // Reused by every compressed animation blended by this mixer.
+	LocalVector<SkeletonPose> skeleton_poses;
+	bool use_skeleton_poses = false; // Scripts post processing the key values need the track cache path.
 
 	// Helpers.
 	void _clear_caches();
 	void _clear_audio_streams();
 	void _clear_playing_caches();
 	void _init_root_motion_cache();
+	void _build_skeleton_poses();
+	void _init_skeleton_poses();
+	void _apply_skeleton_poses();
 	bool _update_caches();
 	void _create_track_num_to_track_cache_for_animation(Ref<Animation> &p_animation);
 
@@ -362,15 +389,68 @@ protected:
 	Variant post_process_key_value(const Ref<Animation> &p_anim, int p_track, Variant p_value, ObjectID p_object_id, int p_object_sub_idx = -1);
 	GDVIRTUAL5RC(Variant, _post_process_key_value, Ref<Animation>, int, Variant, ObjectID, int);
 
+	// The tracks handled by _blend_process(), so that sampling can run on other threads.
+	enum BlendProcessTracks {
+		BLEND_PROCESS_TRACKS_ALL,
+		BLEND_PROCESS_TRACKS_SAMPLED, // Tracks that only write to the track caches.
+		BLEND_PROCESS_TRACKS_DEFERRED, // Tracks that set properties, call methods or play audio and animations.
+	};
+
 	void _blend_init();
 	virtual bool _blend_pre_process(double p_delta, int p_track_count, const AHashMap<NodePath, int> &p_track_map);
 	virtual void _blend_capture(double p_delta);
 	void _blend_calc_total_weight(); // For indeterministic blending.
-	void _blend_process(double p_delta, bool p_update_only = false);
+	bool _is_deferred_track(const Ref<Animation> &p_animation, int p_track) const;
+	void _blend_process(double p_delta, bool p_update_only = false, BlendProcessTracks p_tracks = BLEND_PROCESS_TRACKS_ALL);
 	void _blend_apply();
 	virtual void _blend_post_process();
 	void _call_object(ObjectID p_object_id, const StringName &p_method, const Vector<Variant> &p_params, bool p_deferred);
 
+	/* ---- Multithreaded blending ---- */
+	// Mixers processed in the same frame sample their tracks on the WorkerThreadPool,
+	// then apply the results one after another once all nodes were processed.
+	bool threaded_blend_pending = false;
+	bool threaded_blend_sampled = false;
+	double threaded_blend_delta = 0.0;
+	static LocalVector<ObjectID> threaded_blend_queue;
+	static WorkerThreadPool::GroupID threaded_blend_group_task;
+
+	bool _can_blend_on_threads();
+	void _queue_threaded_blend(double p_delta);
+	void _finish_threaded_blend();
+	void _discard_threaded_blend();
+	static void _wait_for_threaded_blend_samples();
+	static void _threaded_blend_sample(void *p_userdata, uint32_t p_index);
+	static void _process_threaded_blends();
+
+	/* ---- Level of detail ---- */
+	// Distant and offscreen mixers blend every few frames and skip the less visible tracks, see the animation/lod project settings.
+	struct LODFrameInfo {
+		uint64_t frame = 0;
+		uint32_t updated = 0;
+		uint32_t skipped = 0;
+		uint32_t previous_updated = 0;
+		uint32_t previous_skipped = 0;
+	};
+
+	bool lod_enabled = true;
+	int lod_update_interval_override = 0; // Frames between two blends, 0 to derive it from the distance and visibility.
+	ObjectID lod_root_id;
+	ObjectID lod_notifier_id;
+	double lod_delta = 0.0; // Time of the frames skipped since the last blend.
+	uint32_t lod_update_interval = 1;
+	uint32_t lod_skipped_frames = 0;
+	bool lod_reduce_tracks = false;
+	bool lod_interpolate_poses = false;
+	real_t lod_pose_weight = 1.0;
+	static LODFrameInfo lod_frame_info;
+	static Mutex lod_frame_info_mutex;
+
+	void _update_lod_nodes(Node *p_root);
+	uint32_t _get_lod_update_interval(bool &r_reduce_tracks) const;
+	bool _lod_process(double &r_delta);
+	static void _count_lod_frame(bool p_updated);
+
 	/* ---- Capture feature ---- */
 	struct CaptureCache {
 		Ref<Animation> animation;
@@ -433,6 +513,14 @@ public:
 	void set_callback_mode_discrete(AnimationCallbackModeDiscrete p_mode);
 	AnimationCallbackModeDiscrete get_callback_mode_discrete() const;
 
+	void set_lod_enabled(bool p_enabled);
+	bool is_lod_enabled() const;
+	void set_lod_update_interval_override(int p_interval);
+	int get_lod_update_interval_override() const;
+
+	static uint32_t get_lod_updated_mixer_count();
+	static uint32_t get_lod_skipped_mixer_count();
+
 	/* ---- Audio ---- */
 	void set_audio_max_polyphony(int p_audio_max_polyphony);
 	int get_audio_max_polyphony() const;
@@ -81,6 +81,7 @@ public:
 		PROCESS_THREAD_GROUP_INHERIT,
 		PROCESS_THREAD_GROUP_MAIN_THREAD,
 		PROCESS_THREAD_GROUP_SUB_THREAD,
+		PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL,
 	};
 
 	enum ProcessThreadMessages {
@@ -189,6 +189,7 @@ void SceneTree::remove_from_group(const StringName &p_group, Node *p_node) {
 void SceneTree::flush_transform_notifications() {
 	_THREAD_SAFE_METHOD_
 
+	xform_change_pass.increment();
 	SelfList<Node> *n = xform_change_list.first();
 	while (n) {
 		Node *node = n->self();
@@ -1130,6 +1131,9 @@ bool SceneTree::is_suspended() const {
 	return suspended;
 }
 
+// Nodes of parallel process groups are split in chunks of at least this size.
+static constexpr uint32_t PARALLEL_PROCESS_MIN_CHUNK_SIZE = 64;
+
 void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// When reading this function, keep in mind that this code must work in a way where
 	// if any node is removed, this needs to continue working.
@@ -1156,11 +1160,18 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 	// Make a copy, so if nodes are added/removed from process, this does not break
 	Vector<Node *> nodes_copy = nodes;
 
-	uint32_t node_count = nodes_copy.size();
-	Node **nodes_ptr = (Node **)nodes_copy.ptr(); // Force cast, pointer will not change.
+	_process_group_nodes(nodes_copy.ptr(), nodes_copy.size(), p_physics);
 
-	for (uint32_t i = 0; i < node_count; i++) {
-		Node *n = nodes_ptr[i];
+	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+}
+
+bool SceneTree::_is_process_group_threaded(const ProcessGroup *p_group) {
+	return p_group->owner != nullptr && (p_group->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD || p_group->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL);
+}
+
+void SceneTree::_process_group_nodes(Node *const *p_nodes, uint32_t p_node_count, bool p_physics) {
+	for (uint32_t i = 0; i < p_node_count; i++) {
+		Node *n = p_nodes[i];
 		if (nodes_removed_on_group_call.has(n)) {
 			// Node may have been removed during process, skip it.
 			// Keep in mind removals can only happen on the main thread.
@@ -1187,13 +1198,42 @@ void SceneTree::_process_group(ProcessGroup *p_group, bool p_physics) {
 			}
 		}
 	}
+}
 
-	p_group->call_queue.flush(); // Flush messages also after processing (for potential deferred calls).
+uint32_t SceneTree::_prepare_parallel_process_group(ProcessGroup *p_group, bool p_physics) {
+	// Done on the calling thread, on behalf of the group, since the chunks can't share this work.
+	Node::current_process_thread_group = p_group->owner;
+	p_group->call_queue.flush(); // Flush messages before processing.
+	Node::current_process_thread_group = nullptr;
+
+	Vector<Node *> &nodes = p_physics ? p_group->physics_nodes : p_group->nodes;
+	if (p_physics) {
+		if (p_group->physics_node_order_dirty) {
+			nodes.sort_custom<Node::ComparatorWithPhysicsPriority>();
+			p_group->physics_node_order_dirty = false;
+		}
+	} else {
+		if (p_group->node_order_dirty) {
+			nodes.sort_custom<Node::ComparatorWithPriority>();
+			p_group->node_order_dirty = false;
+		}
+	}
+
+	p_group->parallel_nodes.resize(nodes.size());
+	if (!nodes.is_empty()) {
+		memcpy(p_group->parallel_nodes.ptr(), nodes.ptr(), sizeof(Node *) * nodes.size());
+	}
+	return p_group->parallel_nodes.size();
 }
 
 void SceneTree::_process_groups_thread(uint32_t p_index, bool p_physics) {
-	Node::current_process_thread_group = local_process_group_cache[p_index]->owner;
-	_process_group(local_process_group_cache[p_index], p_physics);
+	const ProcessGroupTask &task = local_process_group_cache[p_index];
+	Node::current_process_thread_group = task.group->owner;
+	if (task.parallel) {
+		_process_group_nodes(task.group->parallel_nodes.ptr() + task.from, task.to - task.from, p_physics);
+	} else {
+		_process_group(task.group, p_physics);
+	}
 	Node::current_process_thread_group = nullptr;
 }
 
@@ -1241,27 +1281,46 @@ void SceneTree::_process(bool p_physics) {
 	nodes_removed_on_group_call_lock++;
 
 	int current_order = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group_order : 0;
-	bool current_threaded = process_groups[0]->owner ? process_groups[0]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+	bool current_threaded = _is_process_group_threaded(process_groups[0]);
 
 	for (uint32_t i = 0; i <= group_count; i++) {
 		int order = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group_order : 0;
-		bool threaded = i < group_count && process_groups[i]->owner ? process_groups[i]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD : false;
+		bool threaded = i < group_count && _is_process_group_threaded(process_groups[i]);
 
 		if (i == group_count || current_order != order || current_threaded != threaded) {
 			if (process_count > 0) {
 				// Proceed to process the group.
-				bool using_threads = process_groups[from]->owner && process_groups[from]->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD && !node_threading_disabled;
+				bool using_threads = _is_process_group_threaded(process_groups[from]) && !node_threading_disabled;
+				bool has_parallel_groups = false;
 
 				if (using_threads) {
 					local_process_group_cache.clear();
 				}
 				for (uint32_t j = from; j < i; j++) {
-					if (process_groups[j]->last_pass == process_last_pass) {
-						if (using_threads) {
-							local_process_group_cache.push_back(process_groups[j]);
-						} else {
-							_process_group(process_groups[j], p_physics);
+					ProcessGroup *pg = process_groups[j];
+					if (pg->last_pass != process_last_pass) {
+						continue;
+					}
+					if (!using_threads) {
+						_process_group(pg, p_physics);
+					} else if (pg->owner->data.process_thread_group != Node::PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL) {
+						ProcessGroupTask task;
+						task.group = pg;
+						local_process_group_cache.push_back(task);
+					} else {
+						// Split the nodes of parallel groups in chunks processed by different tasks.
+						uint32_t node_count = _prepare_parallel_process_group(pg, p_physics);
+						uint32_t chunk_count = CLAMP(node_count / PARALLEL_PROCESS_MIN_CHUNK_SIZE, 1u, (uint32_t)WorkerThreadPool::get_singleton()->get_thread_count() * 4);
+						uint32_t chunk_size = (node_count + chunk_count - 1) / chunk_count;
+						for (uint32_t from_node = 0; from_node < node_count; from_node += chunk_size) {
+							ProcessGroupTask task;
+							task.group = pg;
+							task.parallel = true;
+							task.from = from_node;
+							task.to = MIN(from_node + chunk_size, node_count);
+							local_process_group_cache.push_back(task);
 						}
+						has_parallel_groups = true;
 					}
 				}
 
@@ -1269,6 +1328,25 @@ void SceneTree::_process(bool p_physics) {
 					WorkerThreadPool::GroupID id = WorkerThreadPool::get_singleton()->add_template_group_task(this, &SceneTree::_process_groups_thread, p_physics, local_process_group_cache.size(), -1, true);
 					WorkerThreadPool::get_singleton()->wait_for_group_task_completion(id);
 				}
+
+				if (has_parallel_groups) {
+					// Messages sent to parallel groups while processing are flushed once all of their chunks are done,
+					// since a message may target any node of the group.
+					for (uint32_t j = from; j < i; j++) {
+						ProcessGroup *pg = process_groups[j];
+						// The group may have been removed by messages flushed for a previous group.
+						bool parallel = pg->owner && pg->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL;
+						if (pg->last_pass != process_last_pass || (!parallel && pg->parallel_nodes.is_empty())) {
+							continue;
+						}
+						if (parallel) {
+							Node::current_process_thread_group = pg->owner;
+							pg->call_queue.flush();
+							Node::current_process_thread_group = nullptr;
+						}
+						pg->parallel_nodes.clear();
+					}
+				}
 			}
 
 			if (i == group_count) {
@@ -1320,8 +1398,8 @@ bool SceneTree::ProcessGroupSort::operator()(const ProcessGroup *p_left, const P
 	int right_order = p_right->owner ? p_right->owner->data.process_thread_group_order : 0;
 
 	if (left_order == right_order) {
-		int left_threaded = p_left->owner != nullptr && p_left->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
-		int right_threaded = p_right->owner != nullptr && p_right->owner->data.process_thread_group == Node::PROCESS_THREAD_GROUP_SUB_THREAD ? 0 : 1;
+		int left_threaded = _is_process_group_threaded(p_left) ? 0 : 1;
+		int right_threaded = _is_process_group_threaded(p_right) ? 0 : 1;
 		return left_threaded < right_threaded;
 	} else {
 		return left_order < right_order;
@@ -94,6 +94,7 @@ private:
 		CallQueue call_queue;
 		Vector<Node *> nodes;
 		Vector<Node *> physics_nodes;
+		LocalVector<Node *> parallel_nodes; // Nodes processed in chunks when the group is parallel.
 		bool node_order_dirty = true;
 		bool physics_node_order_dirty = true;
 		bool removed = false;
@@ -101,6 +102,14 @@ private:
 		uint64_t last_pass = 0;
 	};
 
+	// A group processed by a single task, or a range of the nodes of a parallel group.
+	struct ProcessGroupTask {
+		ProcessGroup *group = nullptr;
+		bool parallel = false;
+		uint32_t from = 0;
+		uint32_t to = 0;
+	};
+
 	struct ProcessGroupSort {
 		_FORCE_INLINE_ bool operator()(const ProcessGroup *p_left, const ProcessGroup *p_right) const;
 	};
@@ -109,7 +118,7 @@ private:
 
 	LocalVector<ProcessGroup *> process_groups;
 	bool process_groups_dirty = true;
-	LocalVector<ProcessGroup *> local_process_group_cache; // Used when processing to group what needs to
+	LocalVector<ProcessGroupTask> local_process_group_cache; // Used when processing to group what needs to
 	uint64_t process_last_pass = 1;
 
 	ProcessGroup default_process_group;
@@ -228,7 +237,10 @@ private:
 	Group *add_to_group(const StringName &p_group, Node *p_node);
 	void remove_from_group(const StringName &p_group, Node *p_node);
 
+	_FORCE_INLINE_ static bool _is_process_group_threaded(const ProcessGroup *p_group);
+	void _process_group_nodes(Node *const *p_nodes, uint32_t p_node_count, bool p_physics);
 	void _process_group(ProcessGroup *p_group, bool p_physics);
+	uint32_t _prepare_parallel_process_group(ProcessGroup *p_group, bool p_physics);
 	void _process_groups_thread(uint32_t p_index, bool p_physics);
 	void _process(bool p_physics);
 
@@ -247,6 +259,7 @@ private:
 	friend class Viewport;
 
 	SelfList<Node>::List xform_change_list;
+	SafeNumeric<uint64_t> xform_change_pass{ 1 }; // Incremented when transform notifications are flushed.
 
 #ifdef DEBUG_ENABLED // No live editor in release build.
 	friend class LiveEditor;
@@ -82,6 +82,7 @@ bool NavigationPolygon::_edit_is_selected_on_click(const Point2 &p_point, double
 
 void NavigationPolygon::set_vertices(const Vector<Vector2> &p_vertices) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	{
 		MutexLock lock(navigation_mesh_generation);
 		navigation_mesh.unref();
@@ -97,6 +98,7 @@ Vector<Vector2> NavigationPolygon::get_vertices() const {
 
 void NavigationPolygon::_set_polygons(const TypedArray<Vector<int32_t>> &p_array) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	{
 		MutexLock lock(navigation_mesh_generation);
 		navigation_mesh.unref();
@@ -140,6 +142,7 @@ TypedArray<Vector<Vector2>> NavigationPolygon::_get_outlines() const {
 
 void NavigationPolygon::add_polygon(const Vector<int> &p_polygon) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	polygons.push_back(p_polygon);
 	{
 		MutexLock lock(navigation_mesh_generation);
@@ -166,6 +169,7 @@ Vector<int> NavigationPolygon::get_polygon(int p_idx) {
 
 void NavigationPolygon::clear_polygons() {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	polygons.clear();
 	{
 		MutexLock lock(navigation_mesh_generation);
@@ -175,6 +179,7 @@ void NavigationPolygon::clear_polygons() {
 
 void NavigationPolygon::clear() {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	polygons.clear();
 	vertices.clear();
 	{
@@ -183,10 +188,11 @@ void NavigationPolygon::clear() {
 	}
 }
 
-void NavigationPolygon::set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons) {
+void NavigationPolygon::set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons, real_t p_baked_tile_width) {
 	RWLockWrite write_lock(rwlock);
 	vertices = p_vertices;
 	polygons = p_polygons;
+	baked_tile_width = p_baked_tile_width;
 	{
 		MutexLock lock(navigation_mesh_generation);
 		navigation_mesh.unref();
@@ -195,6 +201,7 @@ void NavigationPolygon::set_data(const Vector<Vector2> &p_vertices, const Vector
 
 void NavigationPolygon::set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons, const Vector<Vector<Vector2>> &p_outlines) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	vertices = p_vertices;
 	polygons = p_polygons;
 	outlines = p_outlines;
@@ -218,6 +225,11 @@ void NavigationPolygon::get_data(Vector<Vector2> &r_vertices, Vector<Vector<int>
 	r_outlines = outlines;
 }
 
+real_t NavigationPolygon::get_baked_tile_width() const {
+	RWLockRead read_lock(rwlock);
+	return baked_tile_width;
+}
+
 Ref<NavigationMesh> NavigationPolygon::get_navigation_mesh() {
 	MutexLock lock(navigation_mesh_generation);
 
@@ -260,6 +272,7 @@ Vector<Vector<Vector2>> NavigationPolygon::get_outlines() const {
 
 void NavigationPolygon::set_polygons(const Vector<Vector<int>> &p_polygons) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	polygons = p_polygons;
 	{
 		MutexLock lock(navigation_mesh_generation);
@@ -312,6 +325,7 @@ void NavigationPolygon::clear_outlines() {
 #ifndef DISABLE_DEPRECATED
 void NavigationPolygon::make_polygons_from_outlines() {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0;
 	WARN_PRINT("Function make_polygons_from_outlines() is deprecated."
 			   "\nUse NavigationServer2D.parse_source_geometry_data() and NavigationServer2D.bake_from_source_geometry_data() instead.");
 
@@ -433,6 +447,15 @@ real_t NavigationPolygon::get_border_size() const {
 	return border_size;
 }
 
+void NavigationPolygon::set_tile_size(real_t p_value) {
+	ERR_FAIL_COND(p_value < 0.0);
+	tile_size = p_value;
+}
+
+real_t NavigationPolygon::get_tile_size() const {
+	return tile_size;
+}
+
 void NavigationPolygon::set_sample_partition_type(SamplePartitionType p_value) {
 	ERR_FAIL_INDEX(p_value, SAMPLE_PARTITION_MAX);
 	partition_type = p_value;
@@ -556,6 +579,9 @@ void NavigationPolygon::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_border_size", "border_size"), &NavigationPolygon::set_border_size);
 	ClassDB::bind_method(D_METHOD("get_border_size"), &NavigationPolygon::get_border_size);
 
+	ClassDB::bind_method(D_METHOD("set_tile_size", "tile_size"), &NavigationPolygon::set_tile_size);
+	ClassDB::bind_method(D_METHOD("get_tile_size"), &NavigationPolygon::get_tile_size);
+
 	ClassDB::bind_method(D_METHOD("set_sample_partition_type", "sample_partition_type"), &NavigationPolygon::set_sample_partition_type);
 	ClassDB::bind_method(D_METHOD("get_sample_partition_type"), &NavigationPolygon::get_sample_partition_type);
 
@@ -600,6 +626,7 @@ void NavigationPolygon::_bind_methods() {
 	ADD_GROUP("Cells", "");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_size", PROPERTY_HINT_RANGE, "1.0,50.0,1.0,or_greater,suffix:px"), "set_cell_size", "get_cell_size");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "border_size", PROPERTY_HINT_RANGE, "0.0,500.0,1.0,or_greater,suffix:px"), "set_border_size", "get_border_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "tile_size", PROPERTY_HINT_RANGE, "0.0,10000.0,1.0,or_greater,suffix:px"), "set_tile_size", "get_tile_size");
 	ADD_GROUP("Agents", "agent_");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_radius", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:px"), "set_agent_radius", "get_agent_radius");
 	ADD_GROUP("Filters", "");
@@ -52,6 +52,9 @@ class NavigationPolygon : public Resource {
 
 	real_t cell_size = NavigationDefaults2D::NAV_MESH_CELL_SIZE;
 	real_t border_size = 0.0f;
+	real_t tile_size = 0.0f;
+	// The tile width the polygons were baked with, 0.0 when they were not baked in tiles.
+	real_t baked_tile_width = 0.0f;
 
 	Rect2 baking_rect;
 	Vector2 baking_rect_offset;
@@ -155,6 +158,9 @@ public:
 	void set_border_size(real_t p_value);
 	real_t get_border_size() const;
 
+	void set_tile_size(real_t p_value);
+	real_t get_tile_size() const;
+
 	void set_baking_rect(const Rect2 &p_rect);
 	Rect2 get_baking_rect() const;
 
@@ -163,10 +169,11 @@ public:
 
 	void clear();
 
-	void set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons);
+	void set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons, real_t p_baked_tile_width = 0.0);
 	void set_data(const Vector<Vector2> &p_vertices, const Vector<Vector<int>> &p_polygons, const Vector<Vector<Vector2>> &p_outlines);
 	void get_data(Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons);
 	void get_data(Vector<Vector2> &r_vertices, Vector<Vector<int>> &r_polygons, Vector<Vector<Vector2>> &r_outlines);
+	real_t get_baked_tile_width() const;
 };
 
 VARIANT_ENUM_CAST(NavigationPolygon::SamplePartitionType);
@@ -2220,6 +2220,10 @@ real_t Animation::track_get_key_transition(int p_track, int p_key_idx) const {
 	ERR_FAIL_V(0);
 }
 
+bool Animation::is_compressed() const {
+	return compression.enabled;
+}
+
 bool Animation::track_is_compressed(int p_track) const {
 	ERR_FAIL_INDEX_V(p_track, tracks.size(), false);
 	Track *t = tracks[p_track];
@@ -5319,17 +5323,144 @@ bool Animation::_blend_shape_interpolate_compressed(uint32_t p_compressed_track,
 	return true;
 }
 
+void Animation::CompressedTransformPose::Batch::clear() {
+	tracks.clear();
+	compressed_tracks.clear();
+	for (uint32_t i = 0; i < 3; i++) {
+		from[i].clear();
+		to[i].clear();
+	}
+	weights.clear();
+}
+
+void Animation::CompressedTransformPose::Batch::push_back(uint32_t p_track, uint32_t p_compressed_track, const Vector3i &p_from, const Vector3i &p_to, real_t p_weight) {
+	tracks.push_back(p_track);
+	compressed_tracks.push_back(p_compressed_track);
+	for (uint32_t i = 0; i < 3; i++) {
+		from[i].push_back(p_from[i]);
+		to[i].push_back(p_to[i]);
+	}
+	weights.push_back(p_weight);
+}
+
+bool Animation::sample_compressed_transform_tracks(double p_time, CompressedTransformPose &r_pose) const {
+	ERR_FAIL_COND_V(!compression.enabled, false);
+
+	uint32_t track_count = tracks.size();
+	r_pose.positions_scales.resize(track_count);
+	r_pose.rotations.resize(track_count);
+	r_pose.sampled.resize(track_count);
+	memset(r_pose.sampled.ptr(), 0, track_count);
+	r_pose.pos_scale_batch.clear();
+	r_pose.rotation_batch.clear();
+
+	// All tracks are decoded from the same page, walking its data front to back.
+	double fetch_time = CLAMP(p_time, 0, length);
+	int32_t page_index = _find_compressed_page(fetch_time);
+	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+
+	for (uint32_t i = 0; i < track_count; i++) {
+		const Track *t = tracks[i];
+		int32_t compressed_track = -1;
+		switch (t->type) {
+			case TYPE_POSITION_3D: {
+				compressed_track = static_cast<const PositionTrack *>(t)->compressed_track;
+			} break;
+			case TYPE_ROTATION_3D: {
+				compressed_track = static_cast<const RotationTrack *>(t)->compressed_track;
+			} break;
+			case TYPE_SCALE_3D: {
+				compressed_track = static_cast<const ScaleTrack *>(t)->compressed_track;
+			} break;
+			default: {
+			} break;
+		}
+		if (compressed_track < 0) {
+			continue;
+		}
+
+		Vector3i current;
+		Vector3i next;
+		double time_current;
+		double time_next;
+		_fetch_compressed_in_page<3>(page_index, compressed_track, fetch_time, current, time_current, next, time_next);
+
+		// Same key selection as the single track interpolation, a zero weight keeps the first key as is.
+		real_t weight = 0.0;
+		if (time_current >= p_time || time_current == time_next) {
+			next = current;
+		} else if (p_time >= time_next) {
+			current = next;
+		} else {
+			weight = (p_time - time_current) / (time_next - time_current);
+		}
+
+		CompressedTransformPose::Batch &batch = t->type == TYPE_ROTATION_3D ? r_pose.rotation_batch : r_pose.pos_scale_batch;
+		batch.push_back(i, compressed_track, current, next, weight);
+		r_pose.sampled[i] = 1;
+	}
+
+	// Positions and scales, one component at a time.
+	{
+		const CompressedTransformPose::Batch &batch = r_pose.pos_scale_batch;
+		uint32_t count = batch.tracks.size();
+		const uint32_t *compressed_tracks = batch.compressed_tracks.ptr();
+		const real_t *weights = batch.weights.ptr();
+		const AABB *bounds = compression.bounds.ptr();
+		for (uint32_t j = 0; j < 3; j++) {
+			r_pose.pos_scale_values[j].resize(count);
+			real_t *values = r_pose.pos_scale_values[j].ptr();
+			const uint16_t *from = batch.from[j].ptr();
+			const uint16_t *to = batch.to[j].ptr();
+			for (uint32_t k = 0; k < count; k++) {
+				const AABB &aabb = bounds[compressed_tracks[k]];
+				real_t a = aabb.position[j] + real_t(float(from[k]) / 65535.0) * aabb.size[j];
+				real_t b = aabb.position[j] + real_t(float(to[k]) / 65535.0) * aabb.size[j];
+				values[k] = a + (b - a) * weights[k];
+			}
+		}
+
+		const real_t *x = r_pose.pos_scale_values[0].ptr();
+		const real_t *y = r_pose.pos_scale_values[1].ptr();
+		const real_t *z = r_pose.pos_scale_values[2].ptr();
+		for (uint32_t k = 0; k < count; k++) {
+			r_pose.positions_scales[batch.tracks[k]] = Vector3(x[k], y[k], z[k]);
+		}
+	}
+
+	// Rotations.
+	{
+		const CompressedTransformPose::Batch &batch = r_pose.rotation_batch;
+		uint32_t count = batch.tracks.size();
+		for (uint32_t k = 0; k < count; k++) {
+			Quaternion from = _uncompress_quaternion(Vector3i(batch.from[0][k], batch.from[1][k], batch.from[2][k]));
+			real_t weight = batch.weights[k];
+			if (weight == 0.0) {
+				r_pose.rotations[batch.tracks[k]] = from;
+			} else {
+				Quaternion to = _uncompress_quaternion(Vector3i(batch.to[0][k], batch.to[1][k], batch.to[2][k]));
+				r_pose.rotations[batch.tracks[k]] = from.slerp(to, weight);
+			}
+		}
+	}
+
+	return true;
+}
+
 template <uint32_t COMPONENTS>
 bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
 	ERR_FAIL_COND_V(!compression.enabled, false);
 	ERR_FAIL_UNSIGNED_INDEX_V(p_compressed_track, compression.bounds.size(), false);
 	p_time = CLAMP(p_time, 0, length);
-	if (key_index) {
-		*key_index = 0;
-	}
 
-	double frame_to_sec = 1.0 / double(compression.fps);
+	int32_t page_index = _find_compressed_page(p_time);
+	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+
+	_fetch_compressed_in_page<COMPONENTS>(page_index, p_compressed_track, p_time, r_current_value, r_current_time, r_next_value, r_next_time, key_index);
+	return true;
+}
 
+int32_t Animation::_find_compressed_page(double p_time) const {
 	int32_t page_index = -1;
 	for (uint32_t i = 0; i < compression.pages.size(); i++) {
 		if (compression.pages[i].time_offset > p_time) {
@@ -5337,8 +5468,17 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		}
 		page_index = i;
 	}
+	return page_index;
+}
 
-	ERR_FAIL_COND_V(page_index == -1, false); //should not happen
+template <uint32_t COMPONENTS>
+void Animation::_fetch_compressed_in_page(uint32_t p_page_index, uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index) const {
+	if (key_index) {
+		*key_index = 0;
+	}
+
+	double frame_to_sec = 1.0 / double(compression.fps);
+	uint32_t page_index = p_page_index;
 
 	double page_base_time = compression.pages[page_index].time_offset;
 	const uint8_t *page_data = compression.pages[page_index].data.ptr();
@@ -5461,8 +5601,6 @@ bool Animation::_fetch_compressed(uint32_t p_compressed_track, double p_time, Ve
 		r_current_value[i] = decode[i];
 		r_next_value[i] = decode_next[i];
 	}
-
-	return true;
 }
 
 template <uint32_t COMPONENTS>
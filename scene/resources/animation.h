@@ -361,6 +361,9 @@ private:
 	bool _blend_shape_interpolate_compressed(uint32_t p_compressed_track, double p_time, float &r_ret) const;
 	template <uint32_t COMPONENTS>
 	bool _fetch_compressed(uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
+	int32_t _find_compressed_page(double p_time) const;
+	template <uint32_t COMPONENTS>
+	void _fetch_compressed_in_page(uint32_t p_page_index, uint32_t p_compressed_track, double p_time, Vector3i &r_current_value, double &r_current_time, Vector3i &r_next_value, double &r_next_time, uint32_t *key_index = nullptr) const;
 	template <uint32_t COMPONENTS>
 	bool _fetch_compressed_by_index(uint32_t p_compressed_track, int p_index, Vector3i &r_value, double &r_time) const;
 	int _get_compressed_key_count(uint32_t p_compressed_track) const;
@@ -462,6 +465,32 @@ public:
 	Error try_scale_track_interpolate(int p_track, double p_time, Vector3 *r_interpolation, bool p_backward = false) const;
 	Vector3 scale_track_interpolate(int p_track, double p_time, bool p_backward = false) const;
 
+	// Values of the compressed 3D transform tracks sampled at the same time, indexed by track.
+	// The decoded keys are kept as structure of arrays, so the interpolation runs over all tracks in tight loops.
+	struct CompressedTransformPose {
+		struct Batch {
+			LocalVector<uint32_t> tracks;
+			LocalVector<uint32_t> compressed_tracks;
+			LocalVector<uint16_t> from[3];
+			LocalVector<uint16_t> to[3];
+			LocalVector<real_t> weights;
+
+			void clear();
+			void push_back(uint32_t p_track, uint32_t p_compressed_track, const Vector3i &p_from, const Vector3i &p_to, real_t p_weight);
+		};
+
+		LocalVector<Vector3> positions_scales; // Position and scale tracks.
+		LocalVector<Quaternion> rotations; // Rotation tracks.
+		LocalVector<uint8_t> sampled; // Whether the track has a value.
+
+		Batch pos_scale_batch;
+		Batch rotation_batch;
+		LocalVector<real_t> pos_scale_values[3];
+	};
+
+	bool is_compressed() const;
+	bool sample_compressed_transform_tracks(double p_time, CompressedTransformPose &r_pose) const;
+
 	int blend_shape_track_insert_key(int p_track, double p_time, float p_blend);
 	Error blend_shape_track_get_key(int p_track, int p_key, float *r_blend) const;
 	Error try_blend_shape_track_interpolate(int p_track, double p_time, float *r_blend, bool p_backward = false) const;
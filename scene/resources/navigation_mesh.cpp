@@ -36,6 +36,7 @@
 
 void NavigationMesh::create_from_mesh(const Ref<Mesh> &p_mesh) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	ERR_FAIL_COND(p_mesh.is_null());
 
 	vertices = Vector<Vector3>();
@@ -162,6 +163,15 @@ float NavigationMesh::get_border_size() const {
 	return border_size;
 }
 
+void NavigationMesh::set_tile_size(float p_value) {
+	ERR_FAIL_COND(p_value < 0);
+	tile_size = p_value;
+}
+
+float NavigationMesh::get_tile_size() const {
+	return tile_size;
+}
+
 void NavigationMesh::set_agent_height(float p_value) {
 	ERR_FAIL_COND(p_value < 0);
 	agent_height = p_value;
@@ -305,6 +315,7 @@ Vector3 NavigationMesh::get_filter_baking_aabb_offset() const {
 
 void NavigationMesh::set_vertices(const Vector<Vector3> &p_vertices) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	vertices = p_vertices;
 	notify_property_list_changed();
 }
@@ -316,6 +327,7 @@ Vector<Vector3> NavigationMesh::get_vertices() const {
 
 void NavigationMesh::_set_polygons(const Array &p_array) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	polygons.resize(p_array.size());
 	for (int i = 0; i < p_array.size(); i++) {
 		polygons.write[i] = p_array[i];
@@ -336,6 +348,7 @@ Array NavigationMesh::_get_polygons() const {
 
 void NavigationMesh::set_polygons(const Vector<Vector<int>> &p_polygons) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	polygons = p_polygons;
 	notify_property_list_changed();
 }
@@ -347,6 +360,7 @@ Vector<Vector<int>> NavigationMesh::get_polygons() const {
 
 void NavigationMesh::add_polygon(const Vector<int> &p_polygon) {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	polygons.push_back(p_polygon);
 	notify_property_list_changed();
 }
@@ -364,19 +378,22 @@ Vector<int> NavigationMesh::get_polygon(int p_idx) {
 
 void NavigationMesh::clear_polygons() {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	polygons.clear();
 }
 
 void NavigationMesh::clear() {
 	RWLockWrite write_lock(rwlock);
+	baked_tile_width = 0.0f;
 	polygons.clear();
 	vertices.clear();
 }
 
-void NavigationMesh::set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons) {
+void NavigationMesh::set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons, float p_baked_tile_width) {
 	RWLockWrite write_lock(rwlock);
 	vertices = p_vertices;
 	polygons = p_polygons;
+	baked_tile_width = p_baked_tile_width;
 }
 
 void NavigationMesh::get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons) {
@@ -385,6 +402,11 @@ void NavigationMesh::get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &
 	r_polygons = polygons;
 }
 
+float NavigationMesh::get_baked_tile_width() const {
+	RWLockRead read_lock(rwlock);
+	return baked_tile_width;
+}
+
 #ifdef DEBUG_ENABLED
 Ref<ArrayMesh> NavigationMesh::get_debug_mesh() {
 	if (debug_mesh.is_valid()) {
@@ -508,6 +530,9 @@ void NavigationMesh::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("set_border_size", "border_size"), &NavigationMesh::set_border_size);
 	ClassDB::bind_method(D_METHOD("get_border_size"), &NavigationMesh::get_border_size);
 
+	ClassDB::bind_method(D_METHOD("set_tile_size", "tile_size"), &NavigationMesh::set_tile_size);
+	ClassDB::bind_method(D_METHOD("get_tile_size"), &NavigationMesh::get_tile_size);
+
 	ClassDB::bind_method(D_METHOD("set_agent_height", "agent_height"), &NavigationMesh::set_agent_height);
 	ClassDB::bind_method(D_METHOD("get_agent_height"), &NavigationMesh::get_agent_height);
 
@@ -585,6 +610,7 @@ void NavigationMesh::_bind_methods() {
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_size", PROPERTY_HINT_RANGE, "0.01,500.0,0.01,or_greater,suffix:m"), "set_cell_size", "get_cell_size");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "cell_height", PROPERTY_HINT_RANGE, "0.01,500.0,0.01,or_greater,suffix:m"), "set_cell_height", "get_cell_height");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "border_size", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_border_size", "get_border_size");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "tile_size", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_tile_size", "get_tile_size");
 	ADD_GROUP("Agents", "agent_");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_height", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_agent_height", "get_agent_height");
 	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "agent_radius", PROPERTY_HINT_RANGE, "0.0,500.0,0.01,or_greater,suffix:m"), "set_agent_radius", "get_agent_radius");
@@ -80,6 +80,9 @@ protected:
 	float cell_size = NavigationDefaults3D::NAV_MESH_CELL_SIZE;
 	float cell_height = NavigationDefaults3D::NAV_MESH_CELL_HEIGHT;
 	float border_size = 0.0f;
+	float tile_size = 0.0f;
+	// The tile width the polygons were baked with, 0.0 when they were not baked in tiles.
+	float baked_tile_width = 0.0f;
 	float agent_height = 1.5f;
 	float agent_radius = 0.5f;
 	float agent_max_climb = 0.25f;
@@ -134,6 +137,9 @@ public:
 	void set_border_size(float p_value);
 	float get_border_size() const;
 
+	void set_tile_size(float p_value);
+	float get_tile_size() const;
+
 	void set_agent_height(float p_value);
 	float get_agent_height() const;
 
@@ -196,8 +202,9 @@ public:
 
 	void clear();
 
-	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons);
+	void set_data(const Vector<Vector3> &p_vertices, const Vector<Vector<int>> &p_polygons, float p_baked_tile_width = 0.0f);
 	void get_data(Vector<Vector3> &r_vertices, Vector<Vector<int>> &r_polygons);
+	float get_baked_tile_width() const;
 
 #ifdef DEBUG_ENABLED
 	Ref<ArrayMesh> get_debug_mesh();
@@ -50,6 +50,9 @@
 SceneState::InstantiationWarningNotify SceneState::instantiation_warn_notify = nullptr;
 #endif
 
+SafeNumeric<uint64_t> PackedScene::total_pooled_instance_count;
+SafeNumeric<uint64_t> PackedScene::total_reused_instance_count;
+
 bool SceneState::can_instantiate() const {
 	return nodes.size() > 0;
 }
@@ -125,6 +128,13 @@ Ref<Resource> SceneState::get_remap_resource(const Ref<Resource> &p_resource, Ha
 }
 
 Node *SceneState::instantiate(GenEditState p_edit_state) const {
+	if (p_edit_state == GEN_EDIT_STATE_DISABLED && !Engine::get_singleton()->is_editor_hint()) {
+		const InstantiationPlan *plan = _get_instantiation_plan();
+		if (plan) {
+			return _instantiate_from_plan(*plan);
+		}
+	}
+
 	// Nodes where instantiation failed (because something is missing.)
 	List<Node *> stray_instances;
 
@@ -629,6 +639,396 @@ Node *SceneState::instantiate(GenEditState p_edit_state) const {
 	return ret_nodes[0];
 }
 
+const SceneState::InstantiationPlan *SceneState::_get_instantiation_plan() const {
+	MutexLock lock(instantiation_plan_mutex);
+	if (!instantiation_plan_built) {
+		_build_instantiation_plan();
+		instantiation_plan_built = true;
+	}
+	return instantiation_plan.valid ? &instantiation_plan : nullptr;
+}
+
+void SceneState::_build_instantiation_plan() const {
+	InstantiationPlan &plan = instantiation_plan;
+	plan.valid = false;
+	plan.nodes.clear();
+	plan.properties.clear();
+	plan.connections.clear();
+
+	// Inherited scenes, editable children and nodes overridden in sub-scenes need the complete instantiation.
+	int nc = nodes.size();
+	if (nc == 0 || base_scene_idx >= 0 || !editable_instances.is_empty()) {
+		return;
+	}
+
+	const StringName *snames = names.ptr();
+	int sname_count = names.size();
+	int prop_count = variants.size();
+
+	plan.nodes.resize(nc);
+	for (int i = 0; i < nc; i++) {
+		const NodeData &n = nodes[i];
+		InstantiationPlan::PlanNode &pn = plan.nodes[i];
+
+		// Parents and owners are nodes of this scene created before this one.
+		if (i == 0 ? n.parent != -1 : (n.parent < 0 || n.parent >= i)) {
+			return;
+		}
+		if (n.owner >= i || (n.owner >= 0 && (n.owner & FLAG_ID_IS_PATH))) {
+			return;
+		}
+		if (n.name < 0 || n.name >= sname_count) {
+			return;
+		}
+		if (i > 0) {
+			plan.nodes[n.parent].child_count++;
+		}
+		pn.parent = n.parent;
+		pn.owner = n.owner;
+		pn.index = n.index;
+		pn.name = snames[n.name];
+
+		StringName type;
+		if (n.instance >= 0) {
+			if ((n.instance & FLAG_INSTANCE_IS_PLACEHOLDER) || (n.instance & FLAG_MASK) >= prop_count) {
+				return;
+			}
+			pn.scene = variants[n.instance & FLAG_MASK];
+			if (pn.scene.is_null()) {
+				return;
+			}
+		} else {
+			if (n.type < 0 || n.type >= sname_count) {
+				return;
+			}
+			type = snames[n.type];
+			if (!ClassDB::is_parent_class(type, SNAME("Node"))) {
+				return;
+			}
+			pn.type = type;
+			pn.creation_func = ClassDB::get_native_creation_func(type);
+			if (!pn.creation_func) {
+				return;
+			}
+		}
+
+		// Once a script is set, the properties that follow may belong to it and must be set by name.
+		bool set_by_name = pn.scene.is_valid();
+		pn.property_from = plan.properties.size();
+		for (const NodeData::Property &prop : n.properties) {
+			if ((prop.name & FLAG_PATH_PROPERTY_IS_NODE) || prop.name < 0 || prop.name >= sname_count || prop.value < 0 || prop.value >= prop_count) {
+				return;
+			}
+
+			// Containers and resources local to the scene are set up again for every instance.
+			const Variant &value = variants[prop.value];
+			if (value.get_type() == Variant::ARRAY || value.get_type() == Variant::DICTIONARY) {
+				return;
+			}
+			if (value.get_type() == Variant::OBJECT) {
+				Ref<Resource> res = value;
+				if (res.is_valid() && (res->is_local_to_scene() || Object::cast_to<MissingResource>(res.ptr()))) {
+					return;
+				}
+			}
+
+			InstantiationPlan::Property property;
+			property.name = snames[prop.name];
+			property.value = prop.value;
+			if (property.name == CoreStringName(script)) {
+				set_by_name = true;
+			} else if (!set_by_name) {
+				const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(type, property.name);
+				if (psg && psg->_setptr) {
+					property.setter = psg->_setptr;
+					property.index = psg->index;
+				}
+			}
+			plan.properties.push_back(property);
+		}
+		pn.property_count = plan.properties.size() - pn.property_from;
+
+		for (int group : n.groups) {
+			if (group < 0 || group >= sname_count) {
+				return;
+			}
+			pn.groups.push_back(snames[group]);
+		}
+	}
+
+	for (const ConnectionData &c : connections) {
+		if (c.from < 0 || c.from >= nc || c.to < 0 || c.to >= nc || c.signal < 0 || c.signal >= sname_count || c.method < 0 || c.method >= sname_count) {
+			return;
+		}
+
+		InstantiationPlan::Connection connection;
+		connection.from = c.from;
+		connection.to = c.to;
+		connection.signal = snames[c.signal];
+		connection.method = snames[c.method];
+		connection.flags = CONNECT_PERSIST | c.flags | CONNECT_INHERITED;
+		connection.unbinds = c.unbinds;
+		for (int bind : c.binds) {
+			if (bind < 0 || bind >= prop_count) {
+				return;
+			}
+			connection.binds.push_back(variants[bind]);
+		}
+		plan.connections.push_back(connection);
+	}
+
+	plan.valid = true;
+}
+
+void SceneState::_clear_instantiation_plan() {
+	MutexLock lock(instantiation_plan_mutex);
+	instantiation_plan_built = false;
+	instantiation_plan.valid = false;
+	instantiation_plan.nodes.clear();
+	instantiation_plan.properties.clear();
+	instantiation_plan.connections.clear();
+	instantiation_plan.reset_built = false;
+	instantiation_plan.reset_valid = false;
+	instantiation_plan.reset_property_from.clear();
+	instantiation_plan.reset_properties.clear();
+}
+
+bool SceneState::reset_instance(Node *p_instance) const {
+	ERR_FAIL_NULL_V(p_instance, false);
+	const InstantiationPlan *plan = _get_instantiation_plan();
+	if (!plan) {
+		return false;
+	}
+
+	// Only the nodes of this scene are recorded, so the instance must still have the same structure.
+	int nc = plan->nodes.size();
+	Node **instance_nodes = (Node **)alloca(sizeof(Node *) * nc);
+	for (int i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = plan->nodes[i];
+		if (pn.scene.is_valid()) {
+			return false;
+		}
+
+		Node *node = i == 0 ? p_instance : instance_nodes[pn.parent]->_get_child_by_name(pn.name);
+		if (!node || node->get_class_name() != pn.type || node->get_child_count(false) != (int)pn.child_count) {
+			return false;
+		}
+		if (i > 0 && node->get_owner() != (pn.owner >= 0 ? instance_nodes[pn.owner] : nullptr)) {
+			return false;
+		}
+		instance_nodes[i] = node;
+	}
+
+	{
+		MutexLock lock(instantiation_plan_mutex);
+		if (!plan->reset_built) {
+			_build_reset_plan(instance_nodes);
+		}
+	}
+	if (!plan->reset_valid) {
+		return false;
+	}
+
+	for (int i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = plan->nodes[i];
+		Node *node = instance_nodes[i];
+
+		for (uint32_t j = plan->reset_property_from[i]; j < plan->reset_property_from[i + 1]; j++) {
+			const InstantiationPlan::ResetProperty &property = plan->reset_properties[j];
+			// Containers are duplicated, so changes to them do not affect the next reset.
+			Variant value = (property.value.get_type() == Variant::ARRAY || property.value.get_type() == Variant::DICTIONARY) ? property.value.duplicate(true) : property.value;
+			if (!property.setter) {
+				node->set(property.name, value);
+				continue;
+			}
+
+			Callable::CallError ce;
+			if (property.index >= 0) {
+				Variant index = property.index;
+				const Variant *args[2] = { &index, &value };
+				property.setter->call(node, args, 2, ce);
+			} else {
+				const Variant *args[1] = { &value };
+				property.setter->call(node, args, 1, ce);
+			}
+		}
+
+		List<Node::GroupInfo> groups;
+		node->get_groups(&groups);
+		for (const Node::GroupInfo &group : groups) {
+			if (!pn.groups.has(group.name) && !String(group.name).begins_with("_")) {
+				node->remove_from_group(group.name);
+			}
+		}
+		for (const StringName &group : pn.groups) {
+			node->add_to_group(group, true);
+		}
+	}
+
+	p_instance->set_name(plan->nodes[0].name);
+	return true;
+}
+
+void SceneState::_build_reset_plan(Node **p_instance_nodes) const {
+	InstantiationPlan &plan = instantiation_plan;
+	plan.reset_built = true;
+	plan.reset_valid = false;
+	plan.reset_property_from.clear();
+	plan.reset_properties.clear();
+
+	// Values from inherited or instantiating scenes do not apply, only the records of this scene.
+	const Vector<SceneState::PackState> states_stack;
+	for (uint32_t i = 0; i < plan.nodes.size(); i++) {
+		const InstantiationPlan::PlanNode &pn = plan.nodes[i];
+		Node *node = p_instance_nodes[i];
+		plan.reset_property_from.push_back(plan.reset_properties.size());
+
+		HashMap<StringName, int> recorded;
+		for (uint32_t j = pn.property_from; j < pn.property_from + pn.property_count; j++) {
+			recorded[plan.properties[j].name] = plan.properties[j].value;
+		}
+		bool has_script = recorded.has(CoreStringName(script));
+
+		List<PropertyInfo> property_list;
+		node->get_property_list(&property_list);
+		for (const PropertyInfo &pi : property_list) {
+			if (!(pi.usage & PROPERTY_USAGE_STORAGE) || pi.name == CoreStringName(script)) {
+				continue;
+			}
+
+			InstantiationPlan::ResetProperty property;
+			property.name = pi.name;
+			HashMap<StringName, int>::Iterator E = recorded.find(property.name);
+			if (E) {
+				property.value = variants[E->value];
+				recorded.remove(E);
+			} else {
+				bool is_valid = false;
+				property.value = PropertyUtils::get_property_default_value(node, property.name, &is_valid, &states_stack);
+				if (!is_valid) {
+					continue;
+				}
+			}
+
+			if (!has_script) {
+				const ClassDB::PropertySetGet *psg = ClassDB::get_property_setget(pn.type, property.name);
+				if (psg && psg->_setptr) {
+					property.setter = psg->_setptr;
+					property.index = psg->index;
+				}
+			}
+			plan.reset_properties.push_back(property);
+		}
+
+		// Recorded properties missing from the property list, such as metadata, are set by name.
+		for (uint32_t j = pn.property_from; j < pn.property_from + pn.property_count; j++) {
+			const InstantiationPlan::Property &property = plan.properties[j];
+			if (property.name != CoreStringName(script) && recorded.has(property.name)) {
+				InstantiationPlan::ResetProperty reset_property;
+				reset_property.name = property.name;
+				reset_property.value = variants[property.value];
+				plan.reset_properties.push_back(reset_property);
+			}
+		}
+	}
+	plan.reset_property_from.push_back(plan.reset_properties.size());
+	plan.reset_valid = true;
+}
+
+Node *SceneState::_instantiate_from_plan(const InstantiationPlan &p_plan) const {
+	const Variant *props = variants.ptr();
+	int nc = p_plan.nodes.size();
+	Node **ret_nodes = (Node **)alloca(sizeof(Node *) * nc);
+
+	for (int i = 0; i < nc; i++) {
+		const InstantiationPlan::PlanNode &pn = p_plan.nodes[i];
+
+		Node *node = nullptr;
+		if (pn.scene.is_valid()) {
+			node = pn.scene->instantiate();
+			if (!node) {
+				if (i > 0) {
+					memdelete(ret_nodes[0]);
+				}
+				ERR_FAIL_V_MSG(nullptr, vformat("Failed to load scene dependency: \"%s\". Make sure the required scene is valid.", pn.scene->get_path()));
+			}
+		} else {
+			node = static_cast<Node *>(pn.creation_func(true));
+		}
+
+		const InstantiationPlan::Property *properties = p_plan.properties.ptr() + pn.property_from;
+		for (uint32_t j = 0; j < pn.property_count; j++) {
+			const InstantiationPlan::Property &property = properties[j];
+			const Variant &value = props[property.value];
+			if (!property.setter) {
+				if (property.name == CoreStringName(script) && node->get_script_instance()) {
+					// Keep the variables of the script set by the sub-scene, same as instantiate().
+					List<Pair<StringName, Variant>> old_state;
+					node->get_script_instance()->get_property_state(old_state);
+					node->set(property.name, value);
+					for (const Pair<StringName, Variant> &E : old_state) {
+						node->set(E.first, E.second);
+					}
+				} else {
+					node->set(property.name, value);
+				}
+				continue;
+			}
+
+			// Same as ClassDB::set_property(), without looking up the property.
+			Callable::CallError ce;
+			if (property.index >= 0) {
+				Variant index = property.index;
+				const Variant *args[2] = { &index, &value };
+				property.setter->call(node, args, 2, ce);
+			} else {
+				const Variant *args[1] = { &value };
+				property.setter->call(node, args, 1, ce);
+			}
+		}
+
+		for (const StringName &group : pn.groups) {
+			node->add_to_group(group, true);
+		}
+
+		if (i > 0) {
+			Node *parent = ret_nodes[pn.parent];
+			parent->_add_child_nocheck(node, pn.name);
+			if (pn.index >= 0 && pn.index < parent->get_child_count() - 1) {
+				parent->move_child(node, pn.index);
+			}
+		} else {
+			node->_set_name_nocheck(pn.name);
+		}
+
+		if (pn.owner >= 0) {
+			node->_set_owner_nocheck(ret_nodes[pn.owner]);
+			if (node->data.unique_name_in_owner) {
+				node->_acquire_unique_name_in_owner();
+			}
+		}
+
+		node->remove_meta("_edit_pinned_properties_");
+		ret_nodes[i] = node;
+	}
+
+	for (const InstantiationPlan::Connection &connection : p_plan.connections) {
+		Callable callable(ret_nodes[connection.to], connection.method);
+		if (connection.unbinds > 0) {
+			callable = callable.unbind(connection.unbinds);
+		} else if (!connection.binds.is_empty()) {
+			const Variant **argptrs = (const Variant **)alloca(sizeof(Variant *) * connection.binds.size());
+			for (int j = 0; j < connection.binds.size(); j++) {
+				argptrs[j] = &connection.binds[j];
+			}
+			callable = callable.bindp(argptrs, connection.binds.size());
+		}
+		ret_nodes[connection.from]->connect(connection.signal, callable, connection.flags);
+	}
+
+	return ret_nodes[0];
+}
+
 Variant SceneState::make_local_resource(Variant &p_value, const SceneState::NodeData &p_node_data, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const {
 	Ref<Resource> res = p_value;
 	if (res.is_null() || !res->is_local_to_scene()) {
@@ -1307,6 +1707,7 @@ String SceneState::get_path() const {
 }
 
 void SceneState::clear() {
+	_clear_instantiation_plan();
 	names.clear();
 	variants.clear();
 	nodes.clear();
@@ -1498,6 +1899,8 @@ void SceneState::set_bundled_scene(const Dictionary &p_dictionary) {
 	ERR_FAIL_COND(!p_dictionary.has("conns"));
 	//ERR_FAIL_COND( !p_dictionary.has("path"));
 
+	_clear_instantiation_plan();
+
 	int version = 1;
 	if (p_dictionary.has("version")) {
 		version = p_dictionary["version"];
@@ -1966,21 +2369,25 @@ Ref<Resource> SceneState::get_sub_resource(const String &p_path) {
 //add
 
 int SceneState::add_name(const StringName &p_name) {
+	_clear_instantiation_plan();
 	names.push_back(p_name);
 	return names.size() - 1;
 }
 
 int SceneState::add_value(const Variant &p_value) {
+	_clear_instantiation_plan();
 	variants.push_back(p_value);
 	return variants.size() - 1;
 }
 
 int SceneState::add_node_path(const NodePath &p_path) {
+	_clear_instantiation_plan();
 	node_paths.push_back(p_path);
 	return (node_paths.size() - 1) | FLAG_ID_IS_PATH;
 }
 
 int SceneState::add_node(int p_parent, int p_owner, int p_type, int p_name, int p_instance, int p_index) {
+	_clear_instantiation_plan();
 	NodeData nd;
 	nd.parent = p_parent;
 	nd.owner = p_owner;
@@ -1999,6 +2406,7 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 	ERR_FAIL_INDEX(p_name, names.size());
 	ERR_FAIL_INDEX(p_value, variants.size());
 
+	_clear_instantiation_plan();
 	NodeData::Property prop;
 	prop.name = p_name;
 	if (p_deferred_node_path) {
@@ -2011,11 +2419,13 @@ void SceneState::add_node_property(int p_node, int p_name, int p_value, bool p_d
 void SceneState::add_node_group(int p_node, int p_group) {
 	ERR_FAIL_INDEX(p_node, nodes.size());
 	ERR_FAIL_INDEX(p_group, names.size());
+	_clear_instantiation_plan();
 	nodes.write[p_node].groups.push_back(p_group);
 }
 
 void SceneState::set_base_scene(int p_idx) {
 	ERR_FAIL_INDEX(p_idx, variants.size());
+	_clear_instantiation_plan();
 	base_scene_idx = p_idx;
 }
 
@@ -2026,6 +2436,7 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 	for (int i = 0; i < p_binds.size(); i++) {
 		ERR_FAIL_INDEX(p_binds[i], variants.size());
 	}
+	_clear_instantiation_plan();
 	ConnectionData c;
 	c.from = p_from;
 	c.to = p_to;
@@ -2038,10 +2449,12 @@ void SceneState::add_connection(int p_from, int p_to, int p_signal, int p_method
 }
 
 void SceneState::add_editable_instance(const NodePath &p_path) {
+	_clear_instantiation_plan();
 	editable_instances.push_back(p_path);
 }
 
 bool SceneState::remove_group_references(const StringName &p_name) {
+	_clear_instantiation_plan();
 	bool edited = false;
 	for (NodeData &node : nodes) {
 		for (const int &group : node.groups) {
@@ -2056,6 +2469,7 @@ bool SceneState::remove_group_references(const StringName &p_name) {
 }
 
 bool SceneState::rename_group_references(const StringName &p_old_name, const StringName &p_new_name) {
+	_clear_instantiation_plan();
 	bool edited = false;
 	for (const NodeData &node : nodes) {
 		for (const int &group : node.groups) {
@@ -2137,10 +2551,12 @@ Dictionary PackedScene::_get_bundled_scene() const {
 }
 
 Error PackedScene::pack(Node *p_scene) {
+	clear_pool();
 	return state->pack(p_scene);
 }
 
 void PackedScene::clear() {
+	clear_pool();
 	state->clear();
 }
 
@@ -2193,7 +2609,152 @@ Node *PackedScene::instantiate(GenEditState p_edit_state) const {
 	return s;
 }
 
+void PackedScene::_request_ready_recursive(Node *p_node) {
+	p_node->request_ready();
+	for (int i = 0; i < p_node->get_child_count(); i++) {
+		_request_ready_recursive(p_node->get_child(i));
+	}
+}
+
+Node *PackedScene::instantiate_pooled() {
+	{
+		MutexLock lock(pool_mutex);
+		while (!pool.is_empty()) {
+			ObjectID id = pool[pool.size() - 1];
+			pool.remove_at(pool.size() - 1);
+			total_pooled_instance_count.decrement();
+
+			// Pooled instances may have been freed by the user.
+			Node *node = ObjectDB::get_instance<Node>(id);
+			if (node) {
+				total_reused_instance_count.increment();
+				return node;
+			}
+		}
+	}
+	return instantiate();
+}
+
+bool PackedScene::release_instance(Node *p_instance) {
+	ERR_FAIL_NULL_V(p_instance, false);
+	ERR_FAIL_COND_V_MSG(p_instance->is_queued_for_deletion(), false, "Cannot release an instance that is queued for deletion.");
+	const ObjectID id = p_instance->get_instance_id();
+	{
+		MutexLock lock(pool_mutex);
+		ERR_FAIL_COND_V_MSG(pool.has(id), false, "Cannot release an instance that is already in the pool.");
+	}
+
+	if (p_instance->get_parent()) {
+		p_instance->get_parent()->remove_child(p_instance);
+	}
+
+	bool has_room = false;
+	{
+		MutexLock lock(pool_mutex);
+		has_room = (int)pool.size() < pool_max_size;
+	}
+
+	// Instances that cannot be reset, for example because nodes were added or removed, are freed.
+	if (!has_room || !state->reset_instance(p_instance)) {
+		p_instance->queue_free();
+		return false;
+	}
+	_request_ready_recursive(p_instance);
+
+	MutexLock lock(pool_mutex);
+	// Another thread may have released the same instance while it was being reset.
+	ERR_FAIL_COND_V_MSG(pool.has(id), false, "Cannot release an instance that is already in the pool.");
+	pool.push_back(id);
+	total_pooled_instance_count.increment();
+	return true;
+}
+
+void PackedScene::prewarm_pool(int p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	int count = MIN(p_count, get_pool_max_size()) - get_pooled_instance_count();
+	for (int i = 0; i < count; i++) {
+		Node *node = instantiate();
+		ERR_FAIL_NULL(node);
+
+		MutexLock lock(pool_mutex);
+		pool.push_back(node->get_instance_id());
+		total_pooled_instance_count.increment();
+	}
+}
+
+void PackedScene::clear_pool() {
+	LocalVector<ObjectID> pooled;
+	{
+		MutexLock lock(pool_mutex);
+		pooled = std::move(pool);
+		pool.clear();
+		total_pooled_instance_count.sub(pooled.size());
+	}
+	for (const ObjectID &id : pooled) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pooled_instance_count() const {
+	MutexLock lock(pool_mutex);
+	return pool.size();
+}
+
+void PackedScene::set_pool_max_size(int p_max_size) {
+	ERR_FAIL_COND(p_max_size < 0);
+
+	LocalVector<ObjectID> excess;
+	{
+		MutexLock lock(pool_mutex);
+		pool_max_size = p_max_size;
+		while ((int)pool.size() > pool_max_size) {
+			excess.push_back(pool[pool.size() - 1]);
+			pool.remove_at(pool.size() - 1);
+			total_pooled_instance_count.decrement();
+		}
+	}
+	for (const ObjectID &id : excess) {
+		Node *node = ObjectDB::get_instance<Node>(id);
+		if (node) {
+			memdelete(node);
+		}
+	}
+}
+
+int PackedScene::get_pool_max_size() const {
+	MutexLock lock(pool_mutex);
+	return pool_max_size;
+}
+
+uint64_t PackedScene::get_total_pooled_instance_count() {
+	return total_pooled_instance_count.get();
+}
+
+uint64_t PackedScene::get_total_reused_instance_count() {
+	return total_reused_instance_count.get();
+}
+
+TypedArray<Node> PackedScene::instantiate_many(int p_count, GenEditState p_edit_state) const {
+	ERR_FAIL_COND_V(p_count < 0, TypedArray<Node>());
+
+	TypedArray<Node> instances;
+	instances.resize(p_count);
+	for (int i = 0; i < p_count; i++) {
+		Node *node = instantiate(p_edit_state);
+		if (!node) {
+			instances.resize(i);
+			break;
+		}
+		instances[i] = node;
+	}
+	return instances;
+}
+
 void PackedScene::replace_state(Ref<SceneState> p_by) {
+	clear_pool();
 	state = p_by;
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2202,6 +2763,7 @@ void PackedScene::replace_state(Ref<SceneState> p_by) {
 }
 
 void PackedScene::recreate_state() {
+	clear_pool();
 	state.instantiate();
 	state->set_path(get_path());
 #ifdef TOOLS_ENABLED
@@ -2279,6 +2841,14 @@ void PackedScene::reset_state() {
 void PackedScene::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("pack", "path"), &PackedScene::pack);
 	ClassDB::bind_method(D_METHOD("instantiate", "edit_state"), &PackedScene::instantiate, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_many", "count", "edit_state"), &PackedScene::instantiate_many, DEFVAL(GEN_EDIT_STATE_DISABLED));
+	ClassDB::bind_method(D_METHOD("instantiate_pooled"), &PackedScene::instantiate_pooled);
+	ClassDB::bind_method(D_METHOD("release_instance", "instance"), &PackedScene::release_instance);
+	ClassDB::bind_method(D_METHOD("prewarm_pool", "count"), &PackedScene::prewarm_pool);
+	ClassDB::bind_method(D_METHOD("clear_pool"), &PackedScene::clear_pool);
+	ClassDB::bind_method(D_METHOD("get_pooled_instance_count"), &PackedScene::get_pooled_instance_count);
+	ClassDB::bind_method(D_METHOD("set_pool_max_size", "max_size"), &PackedScene::set_pool_max_size);
+	ClassDB::bind_method(D_METHOD("get_pool_max_size"), &PackedScene::get_pool_max_size);
 	ClassDB::bind_method(D_METHOD("can_instantiate"), &PackedScene::can_instantiate);
 	ClassDB::bind_method(D_METHOD("_set_bundled_scene", "scene"), &PackedScene::_set_bundled_scene);
 	ClassDB::bind_method(D_METHOD("_get_bundled_scene"), &PackedScene::_get_bundled_scene);
@@ -2295,3 +2865,7 @@ void PackedScene::_bind_methods() {
 PackedScene::PackedScene() {
 	state.instantiate();
 }
+
+PackedScene::~PackedScene() {
+	clear_pool();
+}
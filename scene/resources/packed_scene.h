@@ -31,6 +31,10 @@
 #pragma once
 
 #include "core/io/resource.h"
+#include "core/object/class_db.h"
+#include "core/os/mutex.h"
+#include "core/templates/local_vector.h"
+#include "core/templates/safe_refcount.h"
 #include "scene/main/node.h"
 
 class SceneState : public RefCounted {
@@ -88,6 +92,69 @@ class SceneState : public RefCounted {
 
 	Vector<ConnectionData> connections;
 
+	// Scenes made only of nodes of native classes are instantiated from a plan built once,
+	// with the constructors, property setters and connection binds already resolved.
+	struct InstantiationPlan {
+		struct Property {
+			StringName name;
+			int value = 0;
+			MethodBind *setter = nullptr; // Null when the property must be set by name.
+			int index = -1;
+		};
+
+		struct PlanNode {
+			StringName type;
+			ClassDB::CreationFunc creation_func = nullptr;
+			Ref<PackedScene> scene; // Used instead of the constructor for instantiated sub-scenes.
+			int parent = -1;
+			int owner = -1;
+			int index = -1;
+			StringName name;
+			uint32_t property_from = 0;
+			uint32_t property_count = 0;
+			Vector<StringName> groups;
+			uint32_t child_count = 0;
+		};
+
+		// Stored properties set back to their values in the scene, or to their defaults, when an instance is reset.
+		struct ResetProperty {
+			StringName name;
+			Variant value;
+			MethodBind *setter = nullptr;
+			int index = -1;
+		};
+
+		struct Connection {
+			int from = 0;
+			int to = 0;
+			StringName signal;
+			StringName method;
+			int flags = 0;
+			int unbinds = 0;
+			Vector<Variant> binds;
+		};
+
+		bool valid = false;
+		LocalVector<PlanNode> nodes;
+		LocalVector<Property> properties;
+		LocalVector<Connection> connections;
+
+		bool reset_built = false;
+		bool reset_valid = false;
+		LocalVector<uint32_t> reset_property_from; // Indexed by node, with a last entry for the end.
+		LocalVector<ResetProperty> reset_properties;
+	};
+
+	mutable Mutex instantiation_plan_mutex;
+	mutable InstantiationPlan instantiation_plan;
+	mutable bool instantiation_plan_built = false;
+
+	const InstantiationPlan *_get_instantiation_plan() const;
+	void _build_instantiation_plan() const;
+	void _clear_instantiation_plan();
+	Node *_instantiate_from_plan(const InstantiationPlan &p_plan) const;
+	void _build_reset_plan(Node **p_instance_nodes) const;
+
 	Error _parse_node(Node *p_owner, Node *p_node, int p_parent_idx, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 	Error _parse_connections(Node *p_owner, Node *p_node, HashMap<StringName, int> &name_map, HashMap<Variant, int, VariantHasher, VariantComparator> &variant_map, HashMap<Node *, int> &node_map, HashMap<Node *, int> &nodepath_map);
 
@@ -155,6 +222,7 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state) const;
+	bool reset_instance(Node *p_instance) const;
 
 	Array setup_resources_in_array(Array &array_to_scan, const SceneState::NodeData &n, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_sub_scene, Node *node, const StringName sname, HashMap<Ref<Resource>, Ref<Resource>> &resources_local_to_scene, int i, Node **ret_nodes, SceneState::GenEditState p_edit_state) const;
 	Dictionary setup_resources_in_dictionary(Dictionary &p_dictionary_to_scan, const SceneState::NodeData &p_n, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_sub_scene, Node *p_node, const StringName p_sname, HashMap<Ref<Resource>, Ref<Resource>> &p_resources_local_to_scene, int p_i, Node **p_ret_nodes, SceneState::GenEditState p_edit_state) const;
@@ -234,6 +302,15 @@ class PackedScene : public Resource {
 
 	Ref<SceneState> state;
 
+	// Instances released to be reused by instantiate_pooled(), owned by the scene.
+	mutable Mutex pool_mutex;
+	LocalVector<ObjectID> pool;
+	int pool_max_size = 64;
+	static SafeNumeric<uint64_t> total_pooled_instance_count;
+	static SafeNumeric<uint64_t> total_reused_instance_count;
+
+	static void _request_ready_recursive(Node *p_node);
+
 	void _set_bundled_scene(const Dictionary &p_scene);
 	Dictionary _get_bundled_scene() const;
 
@@ -256,6 +333,18 @@ public:
 
 	bool can_instantiate() const;
 	Node *instantiate(GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+	TypedArray<Node> instantiate_many(int p_count, GenEditState p_edit_state = GEN_EDIT_STATE_DISABLED) const;
+
+	Node *instantiate_pooled();
+	bool release_instance(Node *p_instance);
+	void prewarm_pool(int p_count);
+	void clear_pool();
+	int get_pooled_instance_count() const;
+	void set_pool_max_size(int p_max_size);
+	int get_pool_max_size() const;
+
+	static uint64_t get_total_pooled_instance_count();
+	static uint64_t get_total_reused_instance_count();
 
 	void recreate_state();
 	void replace_state(Ref<SceneState> p_by);
@@ -276,6 +365,7 @@ public:
 	Ref<SceneState> get_state() const;
 
 	PackedScene();
+	~PackedScene();
 };
 
 VARIANT_ENUM_CAST(PackedScene::GenEditState)
@@ -42,6 +42,7 @@ protected:
 public:
 	enum PathfindingAlgorithm {
 		PATHFINDING_ALGORITHM_ASTAR = NavigationUtilities::PATHFINDING_ALGORITHM_ASTAR,
+		PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR = NavigationUtilities::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR,
 	};
 
 	enum PathPostProcessing {
@@ -57,6 +57,7 @@ void NavigationServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer2D::map_set_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_link_connection_radius", "map"), &NavigationServer2D::map_get_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer2D::map_get_path, DEFVAL(1));
+	ClassDB::bind_method(D_METHOD("map_get_flow_field_next_position", "map", "origin", "destination", "navigation_layers", "desired_distance"), &NavigationServer2D::map_get_flow_field_next_position, DEFVAL(1), DEFVAL(1.0));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer2D::map_get_closest_point);
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_owner", "map", "to_point"), &NavigationServer2D::map_get_closest_point_owner);
 
@@ -69,10 +70,13 @@ void NavigationServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_iteration_id", "map"), &NavigationServer2D::map_get_iteration_id);
 	ClassDB::bind_method(D_METHOD("map_set_use_async_iterations", "map", "enabled"), &NavigationServer2D::map_set_use_async_iterations);
 	ClassDB::bind_method(D_METHOD("map_get_use_async_iterations", "map"), &NavigationServer2D::map_get_use_async_iterations);
+	ClassDB::bind_method(D_METHOD("map_set_path_cache_size", "map", "size"), &NavigationServer2D::map_set_path_cache_size);
+	ClassDB::bind_method(D_METHOD("map_get_path_cache_size", "map"), &NavigationServer2D::map_get_path_cache_size);
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer2D::map_get_random_point);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer2D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer2D::query_path_async, DEFVAL(Callable()));
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer2D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer2D::region_get_iteration_id);
@@ -177,6 +181,8 @@ void NavigationServer2D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse_source_geometry_data", "navigation_polygon", "source_geometry_data", "root_node", "callback"), &NavigationServer2D::parse_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data", "navigation_polygon", "source_geometry_data", "callback"), &NavigationServer2D::bake_from_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data_async", "navigation_polygon", "source_geometry_data", "callback"), &NavigationServer2D::bake_from_source_geometry_data_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data", "navigation_polygon", "source_geometry_data", "dirty_rect", "callback"), &NavigationServer2D::rebake_tiles_from_source_geometry_data, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data_async", "navigation_polygon", "source_geometry_data", "dirty_rect", "callback"), &NavigationServer2D::rebake_tiles_from_source_geometry_data_async, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("is_baking_navigation_polygon", "navigation_polygon"), &NavigationServer2D::is_baking_navigation_polygon);
 
 	ClassDB::bind_method(D_METHOD("source_geometry_parser_create"), &NavigationServer2D::source_geometry_parser_create);
@@ -208,6 +214,9 @@ void NavigationServer2D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_ITERATION_BUILD_TIME);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_HIT_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_MISS_COUNT);
 }
 
 NavigationServer2D *NavigationServer2D::get_singleton() {
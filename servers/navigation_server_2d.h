@@ -80,6 +80,7 @@ public:
 	virtual real_t map_get_link_connection_radius(RID p_map) const = 0;
 
 	virtual Vector<Vector2> map_get_path(RID p_map, Vector2 p_origin, Vector2 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) = 0;
+	virtual Vector2 map_get_flow_field_next_position(RID p_map, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers = 1, real_t p_desired_distance = 1.0) = 0;
 
 	virtual Vector2 map_get_closest_point(RID p_map, const Vector2 &p_point) const = 0;
 	virtual RID map_get_closest_point_owner(RID p_map, const Vector2 &p_point) const = 0;
@@ -95,6 +96,9 @@ public:
 	virtual void map_set_use_async_iterations(RID p_map, bool p_enabled) = 0;
 	virtual bool map_get_use_async_iterations(RID p_map) const = 0;
 
+	virtual void map_set_path_cache_size(RID p_map, int p_size) = 0;
+	virtual int map_get_path_cache_size(RID p_map) const = 0;
+
 	virtual Vector2 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
 	/* REGION API */
@@ -245,12 +249,15 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 	/* NAVMESH BAKE API */
 
 	virtual void parse_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_polygon(Ref<NavigationPolygon> p_navigation_polygon) const = 0;
 
 protected:
@@ -290,6 +297,9 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_ITERATION_BUILD_TIME,
+		INFO_PATH_CACHE_HIT_COUNT,
+		INFO_PATH_CACHE_MISS_COUNT,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
@@ -50,6 +50,7 @@ public:
 	void map_set_link_connection_radius(RID p_map, real_t p_connection_radius) override {}
 	real_t map_get_link_connection_radius(RID p_map) const override { return 0; }
 	Vector<Vector2> map_get_path(RID p_map, Vector2 p_origin, Vector2 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) override { return Vector<Vector2>(); }
+	Vector2 map_get_flow_field_next_position(RID p_map, const Vector2 &p_origin, const Vector2 &p_destination, uint32_t p_navigation_layers = 1, real_t p_desired_distance = 1.0) override { return Vector2(); }
 	Vector2 map_get_closest_point(RID p_map, const Vector2 &p_point) const override { return Vector2(); }
 	RID map_get_closest_point_owner(RID p_map, const Vector2 &p_point) const override { return RID(); }
 	TypedArray<RID> map_get_links(RID p_map) const override { return TypedArray<RID>(); }
@@ -61,6 +62,8 @@ public:
 	uint32_t map_get_iteration_id(RID p_map) const override { return 0; }
 	void map_set_use_async_iterations(RID p_map, bool p_enabled) override {}
 	bool map_get_use_async_iterations(RID p_map) const override { return false; }
+	void map_set_path_cache_size(RID p_map, int p_size) override {}
+	int map_get_path_cache_size(RID p_map) const override { return 0; }
 
 	RID region_create() override { return RID(); }
 	uint32_t region_get_iteration_id(RID p_region) const override { return 0; }
@@ -163,6 +166,7 @@ public:
 	uint32_t obstacle_get_avoidance_layers(RID p_agent) const override { return 0; }
 
 	void query_path(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override {}
+	void query_path_async(const Ref<NavigationPathQueryParameters2D> &p_query_parameters, Ref<NavigationPathQueryResult2D> p_query_result, const Callable &p_callback = Callable()) override {}
 
 	void set_active(bool p_active) override {}
 	void process(double p_delta_time) override {}
@@ -178,6 +182,8 @@ public:
 	void parse_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) override {}
 	void bake_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) override {}
 	void bake_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Callable &p_callback = Callable()) override {}
+	void rebake_tiles_from_source_geometry_data(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) override {}
+	void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationPolygon> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData2D> &p_source_geometry_data, const Rect2 &p_dirty_rect, const Callable &p_callback = Callable()) override {}
 	bool is_baking_navigation_polygon(Ref<NavigationPolygon> p_navigation_polygon) const override { return false; }
 
 	RID source_geometry_parser_create() override { return RID(); }
@@ -63,6 +63,7 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_set_link_connection_radius", "map", "radius"), &NavigationServer3D::map_set_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_link_connection_radius", "map"), &NavigationServer3D::map_get_link_connection_radius);
 	ClassDB::bind_method(D_METHOD("map_get_path", "map", "origin", "destination", "optimize", "navigation_layers"), &NavigationServer3D::map_get_path, DEFVAL(1));
+	ClassDB::bind_method(D_METHOD("map_get_flow_field_next_position", "map", "origin", "destination", "navigation_layers", "desired_distance"), &NavigationServer3D::map_get_flow_field_next_position, DEFVAL(1), DEFVAL(1.0));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_to_segment", "map", "start", "end", "use_collision"), &NavigationServer3D::map_get_closest_point_to_segment, DEFVAL(false));
 	ClassDB::bind_method(D_METHOD("map_get_closest_point", "map", "to_point"), &NavigationServer3D::map_get_closest_point);
 	ClassDB::bind_method(D_METHOD("map_get_closest_point_normal", "map", "to_point"), &NavigationServer3D::map_get_closest_point_normal);
@@ -77,10 +78,13 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("map_get_iteration_id", "map"), &NavigationServer3D::map_get_iteration_id);
 	ClassDB::bind_method(D_METHOD("map_set_use_async_iterations", "map", "enabled"), &NavigationServer3D::map_set_use_async_iterations);
 	ClassDB::bind_method(D_METHOD("map_get_use_async_iterations", "map"), &NavigationServer3D::map_get_use_async_iterations);
+	ClassDB::bind_method(D_METHOD("map_set_path_cache_size", "map", "size"), &NavigationServer3D::map_set_path_cache_size);
+	ClassDB::bind_method(D_METHOD("map_get_path_cache_size", "map"), &NavigationServer3D::map_get_path_cache_size);
 
 	ClassDB::bind_method(D_METHOD("map_get_random_point", "map", "navigation_layers", "uniformly"), &NavigationServer3D::map_get_random_point);
 
 	ClassDB::bind_method(D_METHOD("query_path", "parameters", "result", "callback"), &NavigationServer3D::query_path, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("query_path_async", "parameters", "result", "callback"), &NavigationServer3D::query_path_async, DEFVAL(Callable()));
 
 	ClassDB::bind_method(D_METHOD("region_create"), &NavigationServer3D::region_create);
 	ClassDB::bind_method(D_METHOD("region_get_iteration_id", "region"), &NavigationServer3D::region_get_iteration_id);
@@ -200,6 +204,8 @@ void NavigationServer3D::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("parse_source_geometry_data", "navigation_mesh", "source_geometry_data", "root_node", "callback"), &NavigationServer3D::parse_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("bake_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "callback"), &NavigationServer3D::bake_from_source_geometry_data_async, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data", "navigation_mesh", "source_geometry_data", "dirty_aabb", "callback"), &NavigationServer3D::rebake_tiles_from_source_geometry_data, DEFVAL(Callable()));
+	ClassDB::bind_method(D_METHOD("rebake_tiles_from_source_geometry_data_async", "navigation_mesh", "source_geometry_data", "dirty_aabb", "callback"), &NavigationServer3D::rebake_tiles_from_source_geometry_data_async, DEFVAL(Callable()));
 	ClassDB::bind_method(D_METHOD("is_baking_navigation_mesh", "navigation_mesh"), &NavigationServer3D::is_baking_navigation_mesh);
 #endif // _3D_DISABLED
 
@@ -232,6 +238,9 @@ void NavigationServer3D::_bind_methods() {
 	BIND_ENUM_CONSTANT(INFO_EDGE_CONNECTION_COUNT);
 	BIND_ENUM_CONSTANT(INFO_EDGE_FREE_COUNT);
 	BIND_ENUM_CONSTANT(INFO_OBSTACLE_COUNT);
+	BIND_ENUM_CONSTANT(INFO_ITERATION_BUILD_TIME);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_HIT_COUNT);
+	BIND_ENUM_CONSTANT(INFO_PATH_CACHE_MISS_COUNT);
 }
 
 NavigationServer3D *NavigationServer3D::get_singleton() {
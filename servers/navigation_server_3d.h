@@ -85,6 +85,7 @@ public:
 	virtual real_t map_get_link_connection_radius(RID p_map) const = 0;
 
 	virtual Vector<Vector3> map_get_path(RID p_map, Vector3 p_origin, Vector3 p_destination, bool p_optimize, uint32_t p_navigation_layers = 1) = 0;
+	virtual Vector3 map_get_flow_field_next_position(RID p_map, const Vector3 &p_origin, const Vector3 &p_destination, uint32_t p_navigation_layers = 1, real_t p_desired_distance = 1.0) = 0;
 
 	virtual Vector3 map_get_closest_point_to_segment(RID p_map, const Vector3 &p_from, const Vector3 &p_to, const bool p_use_collision = false) const = 0;
 	virtual Vector3 map_get_closest_point(RID p_map, const Vector3 &p_point) const = 0;
@@ -102,6 +103,9 @@ public:
 	virtual void map_set_use_async_iterations(RID p_map, bool p_enabled) = 0;
 	virtual bool map_get_use_async_iterations(RID p_map) const = 0;
 
+	virtual void map_set_path_cache_size(RID p_map, int p_size) = 0;
+	virtual int map_get_path_cache_size(RID p_map) const = 0;
+
 	virtual Vector3 map_get_random_point(RID p_map, uint32_t p_navigation_layers, bool p_uniformly) const = 0;
 
 	/* REGION API */
@@ -275,6 +279,7 @@ public:
 	/* QUERY API */
 
 	virtual void query_path(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
+	virtual void query_path_async(const Ref<NavigationPathQueryParameters3D> &p_query_parameters, Ref<NavigationPathQueryResult3D> p_query_result, const Callable &p_callback = Callable()) = 0;
 
 	/* NAVMESH BAKE API */
 
@@ -282,6 +287,8 @@ public:
 	virtual void parse_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, Node *p_root_node, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
 	virtual void bake_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
+	virtual void rebake_tiles_from_source_geometry_data_async(const Ref<NavigationMesh> &p_navigation_mesh, const Ref<NavigationMeshSourceGeometryData3D> &p_source_geometry_data, const AABB &p_dirty_aabb, const Callable &p_callback = Callable()) = 0;
 	virtual bool is_baking_navigation_mesh(Ref<NavigationMesh> p_navigation_mesh) const = 0;
 #endif // _3D_DISABLED
 
@@ -322,6 +329,9 @@ public:
 		INFO_EDGE_CONNECTION_COUNT,
 		INFO_EDGE_FREE_COUNT,
 		INFO_OBSTACLE_COUNT,
+		INFO_ITERATION_BUILD_TIME,
+		INFO_PATH_CACHE_HIT_COUNT,
+		INFO_PATH_CACHE_MISS_COUNT,
 	};
 
 	virtual int get_process_info(ProcessInfo p_info) const = 0;
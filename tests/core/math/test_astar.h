@@ -31,6 +31,7 @@
 #pragma once
 
 #include "core/math/a_star.h"
+#include "core/math/a_star_grid_2d.h"
 
 #include "tests/test_macros.h"
 
@@ -84,6 +85,30 @@ TEST_CASE("[AStar3D] ABCX path") {
 	CHECK(path[3] == ABCX::C);
 }
 
+TEST_CASE("[AStar3D] Bidirectional search") {
+	ABCX abcx;
+	abcx.set_bidirectional_search_enabled(true);
+	Vector<int64_t> path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 4);
+	CHECK(path[0] == ABCX::X);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::B);
+	CHECK(path[3] == ABCX::C);
+
+	// One-way connections are followed in their direction only.
+	abcx.disconnect_points(ABCX::B, ABCX::C);
+	abcx.connect_points(ABCX::C, ABCX::B, false);
+	path = abcx.get_id_path(ABCX::X, ABCX::C);
+	REQUIRE(path.size() == 3);
+	CHECK(path[0] == ABCX::X);
+	CHECK(path[1] == ABCX::A);
+	CHECK(path[2] == ABCX::C);
+
+	abcx.set_point_disabled(ABCX::A);
+	CHECK(abcx.get_id_path(ABCX::X, ABCX::C).is_empty());
+	CHECK(abcx.get_id_path(ABCX::A, ABCX::C).size() == 2);
+}
+
 TEST_CASE("[AStar3D] Add/Remove") {
 	AStar3D a;
 
@@ -219,6 +244,7 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 
 	for (int test = 0; test < 1000; test++) {
 		AStar3D a;
+		a.set_bidirectional_search_enabled(test % 2);
 		Vector3 p[N];
 		bool adj[N][N] = { { false } };
 
@@ -356,4 +382,42 @@ TEST_CASE("[Stress][AStar3D] Find paths") {
 		CHECK_MESSAGE(match, "Found all paths.");
 	}
 }
+
+TEST_CASE("[AStarGrid2D] Paths found at once should match paths found one by one") {
+	Ref<AStarGrid2D> a;
+	a.instantiate();
+	a->set_region(Rect2i(0, 0, 32, 32));
+	a->update();
+	a->fill_solid_region(Rect2i(8, 0, 1, 28));
+	a->fill_solid_region(Rect2i(20, 4, 1, 28));
+	a->set_point_solid(Vector2i(4, 4));
+
+	TypedArray<Vector2i> from_ids;
+	TypedArray<Vector2i> to_ids;
+	for (int i = 0; i < 16; i++) {
+		from_ids.push_back(Vector2i(i % 4, i * 2));
+		to_ids.push_back(Vector2i(31, 31 - i * 2));
+	}
+
+	for (int jumping = 0; jumping < 2; jumping++) {
+		a->set_jumping_enabled(jumping);
+		TypedArray<Array> id_paths = a->get_id_paths(from_ids, to_ids);
+		TypedArray<PackedVector2Array> point_paths = a->get_point_paths(from_ids, to_ids);
+		REQUIRE(id_paths.size() == from_ids.size());
+		REQUIRE(point_paths.size() == from_ids.size());
+		for (int i = 0; i < from_ids.size(); i++) {
+			CHECK_FALSE(Array(id_paths[i]).is_empty());
+			CHECK_EQ(Array(id_paths[i]), Array(a->get_id_path(from_ids[i], to_ids[i])));
+			CHECK_EQ(PackedVector2Array(point_paths[i]), a->get_point_path(from_ids[i], to_ids[i]));
+		}
+	}
+
+	// Closing the gap in the first wall separates both sides, opening one point connects them again.
+	a->fill_solid_region(Rect2i(8, 28, 1, 4));
+	CHECK(a->get_id_path(Vector2i(0, 0), Vector2i(31, 31)).is_empty());
+	a->set_point_solid(Vector2i(8, 30), false);
+	TypedArray<Vector2i> path = a->get_id_path(Vector2i(0, 0), Vector2i(31, 31));
+	CHECK_FALSE(path.is_empty());
+	CHECK_EQ(Array(a->get_id_paths(from_ids, to_ids)[0]), Array(a->get_id_path(from_ids[0], to_ids[0])));
+}
 } // namespace TestAStar
@@ -455,6 +455,130 @@ TEST_CASE("[Object] Signals") {
 	}
 }
 
+class _SignalReceiver : public Object {
+public:
+	int call_count = 0;
+	Object *emitter = nullptr;
+	Callable to_disconnect;
+	Callable to_connect;
+
+	void on_signal() {
+		call_count++;
+		if (to_disconnect.is_valid()) {
+			emitter->disconnect("my_signal", to_disconnect);
+			to_disconnect = Callable();
+		}
+		if (to_connect.is_valid()) {
+			emitter->connect("my_signal", to_connect);
+			to_connect = Callable();
+		}
+	}
+};
+
+TEST_CASE("[Object] Signal emission") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("my_signal"));
+	emitter.add_user_signal(MethodInfo("value_changed", PropertyInfo(Variant::INT, "value")));
+
+	SUBCASE("Methods of native classes receive the arguments") {
+		_TestDerivedObject target;
+		emitter.connect("value_changed", Callable(&target, "set_property"));
+		CHECK(emitter.emit_signal("value_changed", 5) == OK);
+		CHECK(target.get_property() == 5);
+		CHECK(emitter.emit_signal("value_changed", 7) == OK);
+		CHECK(target.get_property() == 7);
+
+		ERR_PRINT_OFF;
+		CHECK(emitter.emit_signal("value_changed") == ERR_METHOD_NOT_FOUND);
+		ERR_PRINT_ON;
+	}
+
+	SUBCASE("Script instances take precedence over methods of native classes") {
+		_TestDerivedObject target;
+		target.set_property(1);
+		emitter.connect("value_changed", Callable(&target, "set_property"));
+		emitter.emit_signal("value_changed", 2);
+		CHECK(target.get_property() == 2);
+
+		// The mock script instance handles every call without doing anything.
+		target.set_script_instance(memnew(_MockScriptInstance));
+		emitter.emit_signal("value_changed", 3);
+		CHECK(target.get_property() == 2);
+	}
+
+	SUBCASE("Connections changed while emitting apply to the next emission") {
+		_SignalReceiver first;
+		_SignalReceiver second;
+		_SignalReceiver third;
+		first.emitter = &emitter;
+		first.to_disconnect = callable_mp(&second, &_SignalReceiver::on_signal);
+		first.to_connect = callable_mp(&third, &_SignalReceiver::on_signal);
+		emitter.connect("my_signal", callable_mp(&first, &_SignalReceiver::on_signal));
+		emitter.connect("my_signal", callable_mp(&second, &_SignalReceiver::on_signal));
+
+		emitter.emit_signal("my_signal");
+		CHECK(first.call_count == 1);
+		CHECK(second.call_count == 1);
+		CHECK(third.call_count == 0);
+
+		emitter.emit_signal("my_signal");
+		CHECK(first.call_count == 2);
+		CHECK(second.call_count == 1);
+		CHECK(third.call_count == 1);
+	}
+
+	SUBCASE("One-shot connections are only called once") {
+		_SignalReceiver receiver;
+		emitter.connect("my_signal", callable_mp(&receiver, &_SignalReceiver::on_signal), Object::CONNECT_ONE_SHOT);
+		emitter.emit_signal("my_signal");
+		emitter.emit_signal("my_signal");
+		CHECK(receiver.call_count == 1);
+		CHECK_FALSE(emitter.is_connected("my_signal", callable_mp(&receiver, &_SignalReceiver::on_signal)));
+	}
+
+	SUBCASE("Freed targets are skipped") {
+		_TestDerivedObject *target = memnew(_TestDerivedObject);
+		emitter.connect("value_changed", Callable(target, "set_property"));
+		emitter.emit_signal("value_changed", 1);
+		memdelete(target);
+		CHECK(emitter.emit_signal("value_changed", 2) == OK);
+	}
+}
+
+TEST_CASE("[Stress][Object] Signal emission") {
+	GDREGISTER_CLASS(_TestDerivedObject);
+	const int emission_count = 1000000;
+
+	Object emitter;
+	emitter.add_user_signal(MethodInfo("value_changed", PropertyInfo(Variant::INT, "value")));
+	_TestDerivedObject targets[4];
+	for (_TestDerivedObject &target : targets) {
+		emitter.connect("value_changed", Callable(&target, "set_property"));
+	}
+
+	for (int i = 0; i < emission_count; i++) {
+		emitter.emit_signal("value_changed", i);
+	}
+	for (const _TestDerivedObject &target : targets) {
+		CHECK(target.get_property() == emission_count - 1);
+	}
+
+	Object pointer_emitter;
+	pointer_emitter.add_user_signal(MethodInfo("value_changed", PropertyInfo(Variant::INT, "value")));
+	for (_TestDerivedObject &target : targets) {
+		target.set_property(-1);
+		pointer_emitter.connect("value_changed", callable_mp(&target, &_TestDerivedObject::set_property));
+	}
+
+	for (int i = 0; i < emission_count; i++) {
+		pointer_emitter.emit_signal("value_changed", i);
+	}
+	for (const _TestDerivedObject &target : targets) {
+		CHECK(target.get_property() == emission_count - 1);
+	}
+}
+
 class NotificationObjectSuperclass : public Object {
 	GDCLASS(NotificationObjectSuperclass, Object);
 
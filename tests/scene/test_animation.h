@@ -308,4 +308,88 @@ TEST_CASE("[Animation] Create Bezier track") {
 	ERR_PRINT_ON;
 }
 
+static Ref<Animation> create_compressed_transform_animation(int p_bone_count, int p_key_count) {
+	Ref<Animation> animation = memnew(Animation);
+	animation->set_length(2.0);
+	for (int i = 0; i < p_bone_count; i++) {
+		const String path = vformat("Skeleton3D:bone_%d", i);
+		const int position_track = animation->add_track(Animation::TYPE_POSITION_3D);
+		const int rotation_track = animation->add_track(Animation::TYPE_ROTATION_3D);
+		const int scale_track = animation->add_track(Animation::TYPE_SCALE_3D);
+		animation->track_set_path(position_track, NodePath(path));
+		animation->track_set_path(rotation_track, NodePath(path));
+		animation->track_set_path(scale_track, NodePath(path));
+		for (int j = 0; j < p_key_count; j++) {
+			const double time = 2.0 * j / (p_key_count - 1);
+			const real_t phase = i * 0.7 + j * 0.3;
+			animation->position_track_insert_key(position_track, time, Vector3(Math::sin(phase), Math::cos(phase * 1.3), i * 0.1));
+			animation->rotation_track_insert_key(rotation_track, time, Quaternion(Vector3(0.3, 1, 0.2).normalized(), phase));
+			animation->scale_track_insert_key(scale_track, time, Vector3(1, 1, 1) * (1.5 + 0.5 * Math::sin(phase)));
+		}
+	}
+	animation->compress();
+	return animation;
+}
+
+TEST_CASE("[Animation] Sample compressed 3D transform tracks at once") {
+	const Ref<Animation> animation = create_compressed_transform_animation(8, 13);
+	REQUIRE(animation->is_compressed());
+	CHECK(animation->track_is_compressed(0));
+
+	Animation::CompressedTransformPose pose;
+	for (double time = -0.1; time < 2.2; time += 0.0173) {
+		REQUIRE(animation->sample_compressed_transform_tracks(time, pose));
+		for (int i = 0; i < animation->get_track_count(); i++) {
+			CHECK(pose.sampled[i]);
+			switch (animation->track_get_type(i)) {
+				case Animation::TYPE_POSITION_3D: {
+					CHECK(pose.positions_scales[i].is_equal_approx(animation->position_track_interpolate(i, time)));
+				} break;
+				case Animation::TYPE_ROTATION_3D: {
+					CHECK(pose.rotations[i].is_equal_approx(animation->rotation_track_interpolate(i, time)));
+				} break;
+				case Animation::TYPE_SCALE_3D: {
+					CHECK(pose.positions_scales[i].is_equal_approx(animation->scale_track_interpolate(i, time)));
+				} break;
+				default: {
+				} break;
+			}
+		}
+	}
+
+	const Ref<Animation> uncompressed = memnew(Animation);
+	ERR_PRINT_OFF;
+	CHECK(!uncompressed->sample_compressed_transform_tracks(0.0, pose));
+	ERR_PRINT_ON;
+}
+
+TEST_CASE("[Stress][Animation] Sample compressed 3D transform tracks at once") {
+	const Ref<Animation> animation = create_compressed_transform_animation(80, 61);
+	const int track_count = animation->get_track_count();
+	real_t checksum = 0.0;
+
+	for (double time = 0.0; time < 2.0; time += 0.0005) {
+		for (int i = 0; i < track_count; i += 3) {
+			Vector3 position;
+			Quaternion rotation;
+			Vector3 scale;
+			animation->try_position_track_interpolate(i, time, &position);
+			animation->try_rotation_track_interpolate(i + 1, time, &rotation);
+			animation->try_scale_track_interpolate(i + 2, time, &scale);
+			checksum += position.x + rotation.w + scale.x;
+		}
+	}
+
+	Animation::CompressedTransformPose pose;
+	real_t pose_checksum = 0.0;
+	for (double time = 0.0; time < 2.0; time += 0.0005) {
+		animation->sample_compressed_transform_tracks(time, pose);
+		for (int i = 0; i < track_count; i += 3) {
+			pose_checksum += pose.positions_scales[i].x + pose.rotations[i + 1].w + pose.positions_scales[i + 2].x;
+		}
+	}
+
+	CHECK_MESSAGE(checksum == doctest::Approx(pose_checksum), "Sampling all tracks at once should give the same values as sampling one track at a time.");
+}
+
 } // namespace TestAnimation
@@ -0,0 +1,318 @@
+/**************************************************************************/
+/*  test_animation_mixer.h                                                */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+#pragma once
+
+#include "core/config/project_settings.h"
+#include "core/object/message_queue.h"
+#include "scene/3d/skeleton_3d.h"
+#include "scene/3d/visible_on_screen_notifier_3d.h"
+#include "scene/animation/animation_blend_tree.h"
+#include "scene/animation/animation_player.h"
+#include "scene/animation/animation_tree.h"
+#include "scene/main/window.h"
+#include "scene/resources/animation_library.h"
+
+#include "tests/test_macros.h"
+
+namespace TestAnimationMixer {
+
+// A character with a skeleton and a target node, animated by its own player.
+static Node3D *create_character(const Ref<AnimationLibrary> &p_library, int p_bone_count, double p_speed_scale) {
+	Node3D *character = memnew(Node3D);
+
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton3D");
+	for (int i = 0; i < p_bone_count; i++) {
+		skeleton->add_bone(vformat("bone_%d", i));
+		if (i > 0) {
+			skeleton->set_bone_parent(i, i - 1);
+		}
+	}
+	character->add_child(skeleton);
+
+	Node3D *target = memnew(Node3D);
+	target->set_name("Target");
+	character->add_child(target);
+
+	AnimationPlayer *player = memnew(AnimationPlayer);
+	player->set_name("AnimationPlayer");
+	player->add_animation_library("", p_library);
+	player->set_speed_scale(p_speed_scale);
+	character->add_child(player);
+
+	SceneTree::get_singleton()->get_root()->add_child(character);
+	player->play("walk");
+	return character;
+}
+
+static Ref<AnimationLibrary> create_walk_library(int p_bone_count) {
+	Ref<Animation> animation;
+	animation.instantiate();
+	animation->set_length(1.0);
+	animation->set_loop_mode(Animation::LOOP_LINEAR);
+
+	for (int i = 0; i < p_bone_count; i++) {
+		int track = animation->add_track(Animation::TYPE_ROTATION_3D);
+		animation->track_set_path(track, NodePath(vformat("Skeleton3D:bone_%d", i)));
+		animation->rotation_track_insert_key(track, 0.0, Quaternion());
+		animation->rotation_track_insert_key(track, 0.5, Quaternion(Vector3(0, 1, 0), 0.1 * (i + 1)));
+		animation->rotation_track_insert_key(track, 1.0, Quaternion());
+	}
+
+	int track = animation->add_track(Animation::TYPE_POSITION_3D);
+	animation->track_set_path(track, NodePath("Target"));
+	animation->position_track_insert_key(track, 0.0, Vector3());
+	animation->position_track_insert_key(track, 1.0, Vector3(10, 0, 0));
+
+	track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath("Target:scale"));
+	animation->track_insert_key(track, 0.0, Vector3(1, 1, 1));
+	animation->track_insert_key(track, 1.0, Vector3(2, 2, 2));
+
+	track = animation->add_track(Animation::TYPE_VALUE);
+	animation->track_set_path(track, NodePath("Target:visible"));
+	animation->value_track_set_update_mode(track, Animation::UPDATE_DISCRETE);
+	animation->track_insert_key(track, 0.0, true);
+	animation->track_insert_key(track, 0.45, false);
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("walk", animation);
+	return library;
+}
+
+// Processes a crowd of characters and returns the poses and target states of the last frame.
+static Array process_crowd(int p_character_count, int p_bone_count, int p_frame_count, bool p_multithreaded) {
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/multithreaded_blending", p_multithreaded);
+
+	Ref<AnimationLibrary> library = create_walk_library(p_bone_count);
+	LocalVector<Node3D *> characters;
+	for (int i = 0; i < p_character_count; i++) {
+		characters.push_back(create_character(library, p_bone_count, 1.0 + i * 0.01));
+	}
+
+	for (int i = 0; i < p_frame_count; i++) {
+		SceneTree::get_singleton()->process(0.05);
+	}
+
+	Array result;
+	for (Node3D *character : characters) {
+		Skeleton3D *skeleton = Object::cast_to<Skeleton3D>(character->get_node(NodePath("Skeleton3D")));
+		for (int i = 0; i < p_bone_count; i++) {
+			result.push_back(skeleton->get_bone_pose_rotation(i));
+		}
+		Node3D *target = Object::cast_to<Node3D>(character->get_node(NodePath("Target")));
+		result.push_back(target->get_position());
+		result.push_back(target->get_scale());
+		result.push_back(target->is_visible());
+		memdelete(character);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/multithreaded_blending", false);
+	return result;
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Multithreaded blending") {
+	Array serial = process_crowd(16, 8, 12, false);
+	Array multithreaded = process_crowd(16, 8, 12, true);
+	CHECK_MESSAGE(serial == multithreaded, "Mixers blended on multiple threads should apply the same values as mixers blended one after another.");
+
+	// The discrete track has been applied on the main thread.
+	CHECK(serial[serial.size() - 1] == Variant(false));
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Discard pending blends when leaving the tree") {
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/multithreaded_blending", true);
+	Node3D *character = create_character(create_walk_library(2), 2, 1.0);
+	AnimationPlayer *player = Object::cast_to<AnimationPlayer>(character->get_node(NodePath("AnimationPlayer")));
+	Node3D *target = Object::cast_to<Node3D>(character->get_node(NodePath("Target")));
+	SceneTree::get_singleton()->process(0.05);
+	const Vector3 position = target->get_position();
+
+	player->notification(Node::NOTIFICATION_INTERNAL_PROCESS);
+	SceneTree::get_singleton()->get_root()->remove_child(character);
+	MessageQueue::get_singleton()->flush();
+	CHECK(target->get_position() == position);
+
+	memdelete(character);
+	ProjectSettings::get_singleton()->set_setting("animation/mixer/multithreaded_blending", false);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Blend skeleton bones") {
+	Node3D *character = memnew(Node3D);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->set_name("Skeleton3D");
+	skeleton->add_bone("bone_0");
+	skeleton->add_bone("bone_1");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_motion_scale(2.0);
+	character->add_child(skeleton);
+
+	Ref<Animation> animation_a;
+	animation_a.instantiate();
+	int track = animation_a->add_track(Animation::TYPE_POSITION_3D);
+	animation_a->track_set_path(track, NodePath("Skeleton3D:bone_0"));
+	animation_a->position_track_insert_key(track, 0.0, Vector3(1, 0, 0));
+	track = animation_a->add_track(Animation::TYPE_ROTATION_3D);
+	animation_a->track_set_path(track, NodePath("Skeleton3D:bone_1"));
+	animation_a->rotation_track_insert_key(track, 0.0, Quaternion(Vector3(0, 1, 0), 0.4));
+
+	Ref<Animation> animation_b;
+	animation_b.instantiate();
+	track = animation_b->add_track(Animation::TYPE_POSITION_3D);
+	animation_b->track_set_path(track, NodePath("Skeleton3D:bone_0"));
+	animation_b->position_track_insert_key(track, 0.0, Vector3(0, 2, 0));
+	track = animation_b->add_track(Animation::TYPE_SCALE_3D);
+	animation_b->track_set_path(track, NodePath("Skeleton3D:bone_1"));
+	animation_b->scale_track_insert_key(track, 0.0, Vector3(3, 3, 3));
+
+	Ref<AnimationLibrary> library;
+	library.instantiate();
+	library->add_animation("a", animation_a);
+	library->add_animation("b", animation_b);
+
+	Ref<AnimationNodeAnimation> node_a;
+	node_a.instantiate();
+	node_a->set_animation("a");
+	Ref<AnimationNodeAnimation> node_b;
+	node_b.instantiate();
+	node_b->set_animation("b");
+	Ref<AnimationNodeBlend2> blend;
+	blend.instantiate();
+	Ref<AnimationNodeBlendTree> blend_tree;
+	blend_tree.instantiate();
+	blend_tree->add_node("a", node_a);
+	blend_tree->add_node("b", node_b);
+	blend_tree->add_node("blend", blend);
+	blend_tree->connect_node("blend", 0, "a");
+	blend_tree->connect_node("blend", 1, "b");
+	blend_tree->connect_node("output", 0, "blend");
+
+	AnimationTree *animation_tree = memnew(AnimationTree);
+	animation_tree->add_animation_library("", library);
+	animation_tree->set_root_animation_node(blend_tree);
+	animation_tree->set_callback_mode_process(AnimationMixer::ANIMATION_CALLBACK_MODE_PROCESS_MANUAL);
+	character->add_child(animation_tree);
+	SceneTree::get_singleton()->get_root()->add_child(character);
+
+	animation_tree->set("parameters/blend/blend_amount", 0.25);
+	animation_tree->advance(0.0);
+
+	// Positions are scaled by the skeleton motion scale.
+	CHECK(skeleton->get_bone_pose_position(0).is_equal_approx(Vector3(1.5, 1.0, 0.0)));
+	CHECK(skeleton->get_bone_pose_rotation(1).is_equal_approx(Quaternion(Vector3(0, 1, 0), 0.3)));
+	CHECK(skeleton->get_bone_pose_scale(1).is_equal_approx(Vector3(1.5, 1.5, 1.5)));
+
+	memdelete(character);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Level of detail") {
+	ProjectSettings::get_singleton()->set_setting("animation/lod/enabled", true);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/offscreen_update_interval", 4);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/interpolate_poses", false);
+
+	Ref<AnimationLibrary> library = create_walk_library(2);
+	Node3D *reference = create_character(library, 2, 1.0);
+	Object::cast_to<AnimationMixer>(reference->get_node(NodePath("AnimationPlayer")))->set_lod_enabled(false);
+	Node3D *offscreen = create_character(library, 2, 1.0);
+	// Nothing is rendered, so the notifier is never on screen.
+	offscreen->add_child(memnew(VisibleOnScreenNotifier3D));
+
+	Node3D *reference_target = Object::cast_to<Node3D>(reference->get_node(NodePath("Target")));
+	Node3D *offscreen_target = Object::cast_to<Node3D>(offscreen->get_node(NodePath("Target")));
+
+	SceneTree::get_singleton()->process(0.05);
+	CHECK(offscreen_target->get_position().is_equal_approx(reference_target->get_position()));
+	Vector3 position = offscreen_target->get_position();
+
+	for (int i = 0; i < 3; i++) {
+		SceneTree::get_singleton()->process(0.05);
+		CHECK_MESSAGE(offscreen_target->get_position() == position, "Offscreen mixers should not blend between two updates.");
+	}
+	CHECK(reference_target->get_position() != position);
+
+	// The skipped time is blended with the next update.
+	SceneTree::get_singleton()->process(0.05);
+	CHECK(offscreen_target->get_position().is_equal_approx(reference_target->get_position()));
+
+	memdelete(reference);
+	memdelete(offscreen);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/enabled", false);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/offscreen_update_interval", 8);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/interpolate_poses", true);
+}
+
+TEST_CASE("[SceneTree][AnimationMixer] Level of detail update interval override") {
+	ProjectSettings::get_singleton()->set_setting("animation/lod/interpolate_poses", false);
+
+	Ref<AnimationLibrary> library = create_walk_library(2);
+	Node3D *reference = create_character(library, 2, 1.0);
+	Node3D *overridden = create_character(library, 2, 1.0);
+	AnimationMixer *mixer = Object::cast_to<AnimationMixer>(overridden->get_node(NodePath("AnimationPlayer")));
+	// Used even though the level of detail is disabled in the project settings.
+	mixer->set_lod_update_interval_override(3);
+	CHECK(mixer->get_lod_update_interval_override() == 3);
+
+	Node3D *reference_target = Object::cast_to<Node3D>(reference->get_node(NodePath("Target")));
+	Node3D *overridden_target = Object::cast_to<Node3D>(overridden->get_node(NodePath("Target")));
+
+	SceneTree::get_singleton()->process(0.05);
+	CHECK(overridden_target->get_position().is_equal_approx(reference_target->get_position()));
+	Vector3 position = overridden_target->get_position();
+
+	for (int i = 0; i < 2; i++) {
+		SceneTree::get_singleton()->process(0.05);
+		CHECK_MESSAGE(overridden_target->get_position() == position, "Mixers should not blend between two updates.");
+	}
+	CHECK(reference_target->get_position() != position);
+
+	SceneTree::get_singleton()->process(0.05);
+	CHECK(overridden_target->get_position().is_equal_approx(reference_target->get_position()));
+
+	// Disabling the level of detail of the mixer also disables the override.
+	mixer->set_lod_enabled(false);
+	position = overridden_target->get_position();
+	SceneTree::get_singleton()->process(0.05);
+	CHECK(overridden_target->get_position() != position);
+	CHECK(overridden_target->get_position().is_equal_approx(reference_target->get_position()));
+
+	memdelete(reference);
+	memdelete(overridden);
+	ProjectSettings::get_singleton()->set_setting("animation/lod/interpolate_poses", true);
+}
+
+TEST_CASE("[Stress][SceneTree][AnimationMixer] Crowd blending") {
+	Array serial = process_crowd(300, 40, 60, false);
+	Array multithreaded = process_crowd(300, 40, 60, true);
+	CHECK_MESSAGE(serial == multithreaded, "Mixers blended on multiple threads should apply the same values as mixers blended one after another.");
+}
+
+} // namespace TestAnimationMixer
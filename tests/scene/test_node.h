@@ -916,4 +916,103 @@ TEST_CASE("[SceneTree][Node] Test the process priority") {
 	memdelete(node4);
 }
 
+class ParallelTestNode : public Node {
+	GDCLASS(ParallelTestNode, Node);
+
+protected:
+	void _notification(int p_what) {
+		switch (p_what) {
+			case NOTIFICATION_PROCESS:
+			case NOTIFICATION_PHYSICS_PROCESS: {
+				process_counter++;
+				processed_in_group = processed_in_group && is_group_processing() && is_accessible_from_caller_thread();
+				for (int i = 0; i < work_iterations; i++) {
+					value = Math::sin(value + 1.0);
+				}
+				if (send_messages) {
+					notify_deferred_thread_group(NOTIFICATION_TEST_MESSAGE);
+				}
+			} break;
+			case NOTIFICATION_TEST_MESSAGE: {
+				message_counter++;
+				processed_in_group = processed_in_group && is_group_processing();
+			} break;
+		}
+	}
+
+public:
+	enum {
+		NOTIFICATION_TEST_MESSAGE = 10000,
+	};
+
+	int process_counter = 0;
+	int message_counter = 0;
+	bool processed_in_group = true;
+	bool send_messages = false;
+	int work_iterations = 0;
+	double value = 0.0;
+};
+
+static Node *create_parallel_nodes(Node::ProcessThreadGroup p_mode, int p_node_count, int p_work_iterations, bool p_send_messages) {
+	Node *group = memnew(Node);
+	group->set_process_thread_group(p_mode);
+	for (int i = 0; i < p_node_count; i++) {
+		ParallelTestNode *node = memnew(ParallelTestNode);
+		node->work_iterations = p_work_iterations;
+		node->send_messages = p_send_messages;
+		node->set_process(true);
+		node->set_physics_process(true);
+		group->add_child(node);
+	}
+	SceneTree::get_singleton()->get_root()->add_child(group);
+	return group;
+}
+
+TEST_CASE("[SceneTree][Node] Parallel process thread group") {
+	Node *group = create_parallel_nodes(Node::PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL, 1000, 8, true);
+
+	SceneTree::get_singleton()->process(0);
+	SceneTree::get_singleton()->physics_process(0);
+	SceneTree::get_singleton()->process(0);
+
+	// Every node is processed once per frame, and messages are delivered within the thread group.
+	bool all_processed = true;
+	for (int i = 0; i < group->get_child_count(); i++) {
+		ParallelTestNode *node = Object::cast_to<ParallelTestNode>(group->get_child(i));
+		all_processed = all_processed && node->process_counter == 3 && node->message_counter == 3 && node->processed_in_group;
+	}
+	CHECK(all_processed);
+
+	SUBCASE("Switching back to a single sub-thread") {
+		group->set_process_thread_group(Node::PROCESS_THREAD_GROUP_SUB_THREAD);
+		SceneTree::get_singleton()->process(0);
+
+		ParallelTestNode *node = Object::cast_to<ParallelTestNode>(group->get_child(0));
+		CHECK(node->process_counter == 4);
+		CHECK(node->message_counter == 4);
+	}
+
+	memdelete(group);
+}
+
+TEST_CASE("[Stress][SceneTree][Node] Parallel process thread group") {
+	const int node_count = 50000;
+	const int frame_count = 10;
+
+	for (Node::ProcessThreadGroup mode : { Node::PROCESS_THREAD_GROUP_MAIN_THREAD, Node::PROCESS_THREAD_GROUP_SUB_THREAD, Node::PROCESS_THREAD_GROUP_SUB_THREAD_PARALLEL }) {
+		Node *group = create_parallel_nodes(mode, node_count, 64, false);
+
+		for (int i = 0; i < frame_count; i++) {
+			SceneTree::get_singleton()->process(0);
+		}
+
+		bool processed_every_frame = true;
+		for (int i = 0; i < node_count; i++) {
+			processed_every_frame = processed_every_frame && Object::cast_to<ParallelTestNode>(group->get_child(i))->process_counter == frame_count;
+		}
+		CHECK_MESSAGE(processed_every_frame, vformat("Every node should be processed once per frame with thread group mode %d.", mode));
+		memdelete(group);
+	}
+}
+
 } // namespace TestNode
@@ -0,0 +1,212 @@
+/**************************************************************************/
+/*  test_node_3d.h                                                        */
+/**************************************************************************/
+/*                         This file is part of:                          */
+/*                             GODOT ENGINE                               */
+/*                        https://godotengine.org                         */
+/**************************************************************************/
+/* Copyright (c) 2014-present Godot Engine contributors (see AUTHORS.md). */
+/* Copyright (c) 2007-2014 Juan Linietsky, Ariel Manzur.                  */
+/*                                                                        */
+/* Permission is hereby granted, free of charge, to any person obtaining  */
+/* a copy of this software and associated documentation files (the        */
+/* "Software"), to deal in the Software without restriction, including    */
+/* without limitation the rights to use, copy, modify, merge, publish,    */
+/* distribute, sublicense, and/or sell copies of the Software, and to     */
+/* permit persons to whom the Software is furnished to do so, subject to  */
+/* the following conditions:                                              */
+/*                                                                        */
+/* The above copyright notice and this permission notice shall be         */
+/* included in all copies or substantial portions of the Software.        */
+/*                                                                        */
+/* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,        */
+/* EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF     */
+/* MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. */
+/* IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY   */
+/* CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,   */
+/* TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE      */
+/* SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.                 */
+/**************************************************************************/
+
+
+#pragma once
+
+#include "scene/3d/node_3d.h"
+#include "scene/main/window.h"
+
+#include "tests/test_macros.h"
+
+namespace TestNode3D {
+
+class TransformNotifiedNode3D : public Node3D {
+	GDCLASS(TransformNotifiedNode3D, Node3D);
+
+protected:
+	void _notification(int p_what) {
+		if (p_what == NOTIFICATION_TRANSFORM_CHANGED) {
+			transform_changed_count++;
+		}
+	}
+
+public:
+	int transform_changed_count = 0;
+
+	TransformNotifiedNode3D() {
+		set_notify_transform(true);
+	}
+};
+
+static Vector<TransformNotifiedNode3D *> create_chain(Node3D *p_parent, int p_length) {
+	Vector<TransformNotifiedNode3D *> chain;
+	Node3D *parent = p_parent;
+	for (int i = 0; i < p_length; i++) {
+		TransformNotifiedNode3D *node = memnew(TransformNotifiedNode3D);
+		node->set_position(Vector3(1, 0, 0));
+		parent->add_child(node);
+		chain.push_back(node);
+		parent = node;
+	}
+	return chain;
+}
+
+TEST_CASE("[SceneTree][Node3D] Transform change propagation") {
+	Node3D *root = memnew(Node3D);
+	SceneTree::get_singleton()->get_root()->add_child(root);
+	Vector<TransformNotifiedNode3D *> chain = create_chain(root, 8);
+	TransformNotifiedNode3D *leaf = chain[chain.size() - 1];
+	SceneTree::get_singleton()->flush_transform_notifications();
+	for (TransformNotifiedNode3D *node : chain) {
+		node->transform_changed_count = 0;
+	}
+
+	SUBCASE("Several changes in a frame notify each node once") {
+		root->set_position(Vector3(0, 1, 0));
+		root->set_rotation(Vector3(0, Math::PI, 0));
+		chain[3]->set_scale(Vector3(2, 2, 2));
+		root->set_position(Vector3(0, 2, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+
+		bool notified_once = true;
+		for (TransformNotifiedNode3D *node : chain) {
+			notified_once = notified_once && node->transform_changed_count == 1;
+		}
+		CHECK(notified_once);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(-12, 2, 0)));
+
+		root->set_position(Vector3());
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 2);
+	}
+
+	SUBCASE("Global transforms read between changes stay up to date") {
+		root->set_position(Vector3(0, 1, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(8, 1, 0)));
+		root->set_position(Vector3(0, 2, 0));
+		CHECK(chain[0]->get_global_position().is_equal_approx(Vector3(1, 2, 0)));
+		root->set_position(Vector3(0, 3, 0));
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(8, 3, 0)));
+	}
+
+	SUBCASE("Nodes enabling notifications after a change are notified of the next change") {
+		leaf->set_notify_transform(false);
+		root->set_position(Vector3(0, 1, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		root->set_position(Vector3(0, 2, 0));
+		leaf->set_notify_transform(true);
+		root->set_position(Vector3(0, 3, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+	}
+
+	SUBCASE("Nodes ignoring a change are notified of the next change") {
+		leaf->call("set_ignore_transform_notification", true);
+		leaf->set_position(Vector3(1, 1, 0));
+		leaf->call("set_ignore_transform_notification", false);
+		leaf->set_position(Vector3(1, 2, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+	}
+
+	SUBCASE("Top level nodes attached after a change follow their parent") {
+		chain[4]->set_as_top_level(true);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		leaf->transform_changed_count = 0;
+
+		root->set_position(Vector3(0, 1, 0));
+		chain[4]->set_as_top_level(false);
+		root->set_position(Vector3(0, 2, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(8, 1, 0)));
+	}
+
+	SUBCASE("Nodes reparented after a change follow their new parent") {
+		Node3D *other = memnew(Node3D);
+		root->add_child(other);
+		SceneTree::get_singleton()->flush_transform_notifications();
+		leaf->transform_changed_count = 0;
+
+		chain[4]->set_position(Vector3(0, 0, 1));
+		chain[4]->reparent(other, false);
+		other->set_position(Vector3(0, 5, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 1);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 5, 1)));
+
+		other->set_position(Vector3(0, 6, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(leaf->transform_changed_count == 2);
+		CHECK(leaf->get_global_position().is_equal_approx(Vector3(3, 6, 1)));
+	}
+
+	SUBCASE("Removing children keeps the remaining children updated") {
+		TransformNotifiedNode3D *sibling = memnew(TransformNotifiedNode3D);
+		chain[0]->add_child(sibling);
+		chain[0]->remove_child(chain[1]);
+		root->set_position(Vector3(0, 1, 0));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		CHECK(sibling->get_global_position().is_equal_approx(Vector3(1, 1, 0)));
+		CHECK(sibling->transform_changed_count == 1);
+		chain[0]->add_child(chain[1]);
+	}
+
+	memdelete(root);
+}
+
+// Moves the root of a hierarchy for a few frames and checks that the leaf follows and is notified once per frame.
+static void check_propagation(Node3D *p_root, TransformNotifiedNode3D *p_leaf, int p_frame_count) {
+	SceneTree::get_singleton()->get_root()->add_child(p_root);
+	SceneTree::get_singleton()->flush_transform_notifications();
+	p_leaf->transform_changed_count = 0;
+	const Vector3 leaf_offset = p_leaf->get_global_position();
+
+	bool leaf_followed = true;
+	for (int i = 0; i < p_frame_count; i++) {
+		// Moving an object usually changes several of its properties in a frame.
+		p_root->set_position(Vector3(i, 0, 0));
+		p_root->set_rotation(Vector3(0, i * 0.01, 0));
+		p_root->set_scale(Vector3(1, 1, 1) * (1.0 + i * 0.001));
+		SceneTree::get_singleton()->flush_transform_notifications();
+		leaf_followed = leaf_followed && p_leaf->get_global_position().is_equal_approx(p_root->get_global_transform().xform(leaf_offset));
+	}
+	CHECK(leaf_followed);
+	CHECK(p_leaf->transform_changed_count == p_frame_count);
+
+	memdelete(p_root);
+}
+
+TEST_CASE("[Stress][SceneTree][Node3D] Transform change propagation") {
+	Node3D *deep_root = memnew(Node3D);
+	Vector<TransformNotifiedNode3D *> deep_chain = create_chain(deep_root, 1000);
+	check_propagation(deep_root, deep_chain[deep_chain.size() - 1], 100);
+
+	Node3D *wide_root = memnew(Node3D);
+	TransformNotifiedNode3D *child = nullptr;
+	for (int i = 0; i < 10000; i++) {
+		child = memnew(TransformNotifiedNode3D);
+		wide_root->add_child(child);
+	}
+	check_propagation(wide_root, child, 100);
+}
+
+} // namespace TestNode3D
@@ -30,6 +30,9 @@
 
 #pragma once
 
+#include "scene/2d/node_2d.h"
+#include "scene/gui/control.h"
+#include "scene/main/window.h"
 #include "scene/resources/packed_scene.h"
 
 #include "tests/test_macros.h"
@@ -215,6 +218,223 @@ TEST_CASE("[PackedScene] Instantiate Packed Scene With Children") {
 	memdelete(instance);
 }
 
+static Node *create_projectile_scene() {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("Projectile");
+	scene->set_position(Vector2(4, 2));
+	scene->add_to_group("projectiles", true);
+
+	Control *label = memnew(Control);
+	label->set_name("Label");
+	label->set_offset(SIDE_LEFT, 8);
+	label->set_unique_name_in_owner(true);
+	scene->add_child(label);
+	label->set_owner(scene);
+
+	Node2D *trail = memnew(Node2D);
+	trail->set_name("Trail");
+	trail->set_rotation(0.5);
+	scene->add_child(trail);
+	trail->set_owner(scene);
+	scene->move_child(trail, 0);
+
+	label->connect("renamed", Callable(trail, "set_visible").bind(false), Object::CONNECT_PERSIST);
+	return scene;
+}
+
+static void check_projectile_instance(Node *p_instance) {
+	Node2D *projectile = Object::cast_to<Node2D>(p_instance);
+	REQUIRE(projectile != nullptr);
+	CHECK(projectile->get_name() == "Projectile");
+	CHECK(projectile->get_position() == Vector2(4, 2));
+	CHECK(projectile->is_in_group("projectiles"));
+	REQUIRE(projectile->get_child_count() == 2);
+
+	Node2D *trail = Object::cast_to<Node2D>(projectile->get_child(0));
+	REQUIRE(trail != nullptr);
+	CHECK(trail->get_name() == "Trail");
+	CHECK(trail->get_rotation() == doctest::Approx(0.5));
+	CHECK(trail->get_owner() == projectile);
+
+	Control *label = Object::cast_to<Control>(projectile->get_node(NodePath("%Label")));
+	REQUIRE(label != nullptr);
+	CHECK(label->get_offset(SIDE_LEFT) == 8);
+	CHECK(label->get_owner() == projectile);
+
+	// The bound argument of the connection is passed to the target.
+	CHECK(trail->is_visible());
+	label->emit_signal("renamed");
+	CHECK_FALSE(trail->is_visible());
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instantiate Many") {
+	Node *scene = create_projectile_scene();
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+
+	TypedArray<Node> instances = packed_scene->instantiate_many(3);
+	REQUIRE(instances.size() == 3);
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		check_projectile_instance(instance);
+		memdelete(instance);
+	}
+
+	// The same scene instantiated for the editor goes through every node record.
+	Node *edited_instance = packed_scene->instantiate(PackedScene::GEN_EDIT_STATE_INSTANCE);
+	check_projectile_instance(edited_instance);
+	memdelete(edited_instance);
+
+	SUBCASE("Packing again updates the instances") {
+		Object::cast_to<Node2D>(scene)->set_position(Vector2(1, 1));
+		packed_scene->pack(scene);
+		Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate());
+		REQUIRE(instance != nullptr);
+		CHECK(instance->get_position() == Vector2(1, 1));
+		memdelete(instance);
+	}
+
+	ERR_PRINT_OFF;
+	CHECK(packed_scene->instantiate_many(-1).is_empty());
+	ERR_PRINT_ON;
+	CHECK(packed_scene->instantiate_many(0).is_empty());
+
+	memdelete(scene);
+}
+
+TEST_CASE("[SceneTree][PackedScene] Instance Pool") {
+	Node *scene = create_projectile_scene();
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(scene);
+	memdelete(scene);
+
+	uint64_t reused_count = PackedScene::get_total_reused_instance_count();
+	Node2D *instance = Object::cast_to<Node2D>(packed_scene->instantiate_pooled());
+	REQUIRE(instance != nullptr);
+	CHECK(PackedScene::get_total_reused_instance_count() == reused_count);
+
+	SceneTree::get_singleton()->get_root()->add_child(instance);
+	instance->set_name("Renamed");
+	instance->set_position(Vector2(10, 10));
+	instance->set_modulate(Color(1, 0, 0));
+	instance->remove_from_group("projectiles");
+	instance->add_to_group("hit");
+	Object::cast_to<Node2D>(instance->get_child(0))->set_rotation(2.0);
+	Object::cast_to<Control>(instance->get_node(NodePath("%Label")))->set_offset(SIDE_LEFT, 20);
+
+	SUBCASE("Released instances are reset and reused") {
+		CHECK(packed_scene->release_instance(instance));
+		CHECK(instance->get_parent() == nullptr);
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+
+		// Releasing the same instance twice must not hand it out twice.
+		ERR_PRINT_OFF;
+		CHECK_FALSE(packed_scene->release_instance(instance));
+		ERR_PRINT_ON;
+		CHECK_FALSE(instance->is_queued_for_deletion());
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+
+		Node *reused = packed_scene->instantiate_pooled();
+		CHECK(reused == instance);
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+		CHECK(PackedScene::get_total_reused_instance_count() == reused_count + 1);
+
+		// Stored values are restored, and properties the scene does not store go back to their defaults.
+		check_projectile_instance(instance);
+		CHECK(instance->get_modulate() == Color(1, 1, 1));
+		CHECK_FALSE(instance->is_in_group("hit"));
+
+		// Ready notifications are sent again when the instance enters the tree.
+		CHECK_FALSE(instance->is_ready());
+		SceneTree::get_singleton()->get_root()->add_child(instance);
+		CHECK(instance->is_ready());
+		memdelete(instance);
+	}
+
+	SUBCASE("Instances with a different structure are not pooled") {
+		instance->add_child(memnew(Node));
+		CHECK_FALSE(packed_scene->release_instance(instance));
+		CHECK(instance->is_queued_for_deletion());
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+
+		Node *new_instance = packed_scene->instantiate_pooled();
+		CHECK(new_instance != instance);
+		memdelete(new_instance);
+	}
+
+	SUBCASE("The pool is limited in size") {
+		packed_scene->set_pool_max_size(2);
+		packed_scene->prewarm_pool(3);
+		CHECK(packed_scene->get_pooled_instance_count() == 2);
+		CHECK_FALSE(packed_scene->release_instance(instance));
+		CHECK(instance->is_queued_for_deletion());
+
+		packed_scene->set_pool_max_size(1);
+		CHECK(packed_scene->get_pooled_instance_count() == 1);
+		packed_scene->clear_pool();
+		CHECK(packed_scene->get_pooled_instance_count() == 0);
+	}
+
+	packed_scene->clear_pool();
+}
+
+static Node *create_deep_scene(int p_depth) {
+	Node2D *scene = memnew(Node2D);
+	scene->set_name("Root");
+	Node2D *parent = scene;
+	for (int i = 0; i < p_depth; i++) {
+		Node2D *child = memnew(Node2D);
+		child->set_name(vformat("Child%d", i));
+		child->set_position(Vector2(i, 1));
+		child->set_rotation(0.1 * i);
+		child->set_scale(Vector2(1.1, 1.1));
+		child->set_z_index(i);
+		child->add_to_group("segments", true);
+		parent->add_child(child);
+		child->set_owner(scene);
+		parent = child;
+	}
+	return scene;
+}
+
+static void check_instantiate_many(Node *p_scene, int p_count) {
+	Ref<PackedScene> packed_scene;
+	packed_scene.instantiate();
+	packed_scene->pack(p_scene);
+
+	TypedArray<Node> instances = packed_scene->instantiate_many(p_count);
+	CHECK(instances.size() == p_count);
+	bool instances_match = true;
+	for (int i = 0; i < instances.size(); i++) {
+		Node *instance = Object::cast_to<Node>(instances[i]);
+		instances_match = instances_match && instance && instance->get_child_count() == p_scene->get_child_count();
+		if (instance) {
+			memdelete(instance);
+		}
+	}
+	CHECK_MESSAGE(instances_match, "Instances created from the instantiation plan should match the packed scene.");
+
+	// Instances for the editor do not use the instantiation plan.
+	bool editor_instances_match = true;
+	for (int i = 0; i < p_count; i++) {
+		Node *instance = packed_scene->instantiate(PackedScene::GEN_EDIT_STATE_INSTANCE);
+		editor_instances_match = editor_instances_match && instance && instance->get_child_count() == p_scene->get_child_count();
+		if (instance) {
+			memdelete(instance);
+		}
+	}
+	CHECK_MESSAGE(editor_instances_match, "Instances created for the editor should match the packed scene.");
+
+	memdelete(p_scene);
+}
+
+TEST_CASE("[Stress][SceneTree][PackedScene] Instantiate Many") {
+	check_instantiate_many(create_projectile_scene(), 5000);
+	check_instantiate_many(create_deep_scene(32), 1000);
+}
+
 TEST_CASE("[PackedScene] Set Path") {
 	// Create a scene to pack.
 	Node *scene = memnew(Node);
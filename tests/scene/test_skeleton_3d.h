@@ -32,7 +32,25 @@
 
 #include "tests/test_macros.h"
 
+#include "core/config/project_settings.h"
 #include "scene/3d/skeleton_3d.h"
+#include "scene/main/window.h"
+
+class TestSkeleton3DInternalsAccessor {
+public:
+	static bool has_dirty_bone_global_poses(const Skeleton3D *p_skeleton) {
+		for (bool dirty : p_skeleton->bone_global_pose_dirty) {
+			if (dirty) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	static const LocalVector<Transform3D> &skin_transforms(const Ref<SkinReference> &p_skin_reference) {
+		return p_skin_reference->skin_transforms;
+	}
+};
 
 namespace TestSkeleton3D {
 
@@ -72,4 +90,104 @@ TEST_CASE("[Skeleton3D] Test per-bone meta") {
 	skeleton->set_bone_meta(0, "non-existing-key", Variant());
 	memdelete(skeleton);
 }
+
+// Poses a crowd of skinned skeletons for a few frames and returns the skin transforms of the last frame.
+static Array update_skeletons(int p_skeleton_count, int p_bone_count, int p_frame_count, bool p_multithreaded) {
+	ProjectSettings::get_singleton()->set_setting("animation/skeleton/multithreaded_update", p_multithreaded);
+
+	Ref<Skin> skin;
+	skin.instantiate();
+	for (int i = 0; i < p_bone_count; i++) {
+		skin->add_named_bind(vformat("bone_%d", i), Transform3D(Basis(), Vector3(0, -i, 0)));
+	}
+
+	LocalVector<Skeleton3D *> skeletons;
+	LocalVector<Ref<SkinReference>> skin_references;
+	for (int i = 0; i < p_skeleton_count; i++) {
+		Skeleton3D *skeleton = memnew(Skeleton3D);
+		for (int j = 0; j < p_bone_count; j++) {
+			skeleton->add_bone(vformat("bone_%d", j));
+			skeleton->set_bone_rest(j, Transform3D(Basis(), Vector3(0, j > 0 ? 1 : 0, 0)));
+			if (j > 0) {
+				skeleton->set_bone_parent(j, j - 1);
+			}
+		}
+		SceneTree::get_singleton()->get_root()->add_child(skeleton);
+		skin_references.push_back(skeleton->register_skin(skin));
+		skeletons.push_back(skeleton);
+	}
+
+	for (int frame = 0; frame < p_frame_count; frame++) {
+		for (uint32_t i = 0; i < skeletons.size(); i++) {
+			for (int j = 0; j < p_bone_count; j++) {
+				skeletons[i]->set_bone_pose_rotation(j, Quaternion(Vector3(0, 0, 1), 0.01 * (frame + 1) * (i + j + 1)));
+			}
+		}
+		SceneTree::get_singleton()->process(0.016);
+	}
+
+	// Read what the update produced, the global pose getters would update dirty bones themselves.
+	Array result;
+	bool poses_updated = true;
+	for (uint32_t i = 0; i < skeletons.size(); i++) {
+		poses_updated = poses_updated && !TestSkeleton3DInternalsAccessor::has_dirty_bone_global_poses(skeletons[i]);
+		for (const Transform3D &transform : TestSkeleton3DInternalsAccessor::skin_transforms(skin_references[i])) {
+			result.push_back(transform);
+		}
+	}
+	CHECK_MESSAGE(poses_updated, "All global bone poses should be up to date after the skeletons have been updated.");
+	CHECK(result.size() == p_skeleton_count * p_bone_count);
+	skin_references.clear();
+	for (Skeleton3D *skeleton : skeletons) {
+		memdelete(skeleton);
+	}
+
+	ProjectSettings::get_singleton()->set_setting("animation/skeleton/multithreaded_update", false);
+	return result;
+}
+
+TEST_CASE("[SceneTree][Skeleton3D] Multithreaded update") {
+	Array serial = update_skeletons(16, 12, 4, false);
+	Array multithreaded = update_skeletons(16, 12, 4, true);
+	CHECK_MESSAGE(serial == multithreaded, "Skeletons updated on multiple threads should compute the same skin transforms as skeletons updated one after another.");
+
+	ProjectSettings::get_singleton()->set_setting("animation/skeleton/multithreaded_update", true);
+	Skeleton3D *skeleton = memnew(Skeleton3D);
+	skeleton->add_bone("root");
+	skeleton->add_bone("child");
+	skeleton->set_bone_parent(1, 0);
+	skeleton->set_bone_rest(1, Transform3D(Basis(), Vector3(0, 1, 0)));
+	SceneTree::get_singleton()->get_root()->add_child(skeleton);
+	Ref<Skin> skin;
+	skin.instantiate();
+	skin->add_named_bind("root", Transform3D());
+	skin->add_named_bind("child", Transform3D());
+	Ref<SkinReference> skin_reference = skeleton->register_skin(skin);
+	SceneTree::get_singleton()->process(0.0);
+
+	SIGNAL_WATCH(skeleton, SceneStringName(skeleton_updated));
+	SIGNAL_WATCH(skeleton, SceneStringName(pose_updated));
+	skeleton->set_bone_pose_position(0, Vector3(2, 0, 0));
+	SceneTree::get_singleton()->process(0.0);
+
+	Array empty_signal_args = { {} };
+	SIGNAL_CHECK(SceneStringName(pose_updated), empty_signal_args);
+	SIGNAL_CHECK(SceneStringName(skeleton_updated), empty_signal_args);
+	CHECK_FALSE(TestSkeleton3DInternalsAccessor::has_dirty_bone_global_poses(skeleton));
+	CHECK(TestSkeleton3DInternalsAccessor::skin_transforms(skin_reference)[1].origin.is_equal_approx(Vector3(2, 1, 0)));
+	CHECK(skeleton->get_bone_global_pose(1).origin.is_equal_approx(Vector3(2, 1, 0)));
+
+	SIGNAL_UNWATCH(skeleton, SceneStringName(skeleton_updated));
+	SIGNAL_UNWATCH(skeleton, SceneStringName(pose_updated));
+	skin_reference.unref();
+	memdelete(skeleton);
+	ProjectSettings::get_singleton()->set_setting("animation/skeleton/multithreaded_update", false);
+}
+
+TEST_CASE("[Stress][SceneTree][Skeleton3D] Many skeletons") {
+	Array serial = update_skeletons(500, 60, 30, false);
+	Array multithreaded = update_skeletons(500, 60, 30, true);
+	CHECK_MESSAGE(serial == multithreaded, "Skeletons updated on multiple threads should compute the same skin transforms as skeletons updated one after another.");
+}
+
 } // namespace TestSkeleton3D
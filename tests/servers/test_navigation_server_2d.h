@@ -104,6 +104,7 @@ TEST_SUITE("[Navigation2D]") {
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer2D::INFO_EDGE_MERGE_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer2D::INFO_EDGE_CONNECTION_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer2D::INFO_EDGE_FREE_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer2D::INFO_ITERATION_BUILD_TIME), 0);
 		}
 	}
 
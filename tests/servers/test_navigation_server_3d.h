@@ -75,6 +75,9 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_CONNECTION_COUNT), 0);
 			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_FREE_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_ITERATION_BUILD_TIME), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 0);
 		}
 	}
 
@@ -426,6 +429,69 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->free(map);
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should only make agents avoid neighbors within neighbor distance") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+
+		RID map = navigation_server->map_create();
+		navigation_server->map_set_active(map, true);
+
+		// A sparse crowd where no agent is within the neighbor distance of another,
+		// and one pair in the middle that is heading into each other.
+		const int crowd_size = 8;
+		LocalVector<RID> agents;
+		LocalVector<CallableMock *> agent_avoidance_callback_mocks;
+		for (int x = 0; x < crowd_size; x++) {
+			for (int z = 0; z < crowd_size; z++) {
+				RID agent = navigation_server->agent_create();
+				navigation_server->agent_set_map(agent, map);
+				navigation_server->agent_set_avoidance_enabled(agent, true);
+				navigation_server->agent_set_position(agent, Vector3(x * 20, 0, z * 20));
+				navigation_server->agent_set_radius(agent, 1);
+				navigation_server->agent_set_neighbor_distance(agent, 5);
+				navigation_server->agent_set_velocity(agent, Vector3(1, 0, 0));
+				CallableMock *agent_avoidance_callback_mock = memnew(CallableMock);
+				navigation_server->agent_set_avoidance_callback(agent, callable_mp(agent_avoidance_callback_mock, &CallableMock::function1));
+				agents.push_back(agent);
+				agent_avoidance_callback_mocks.push_back(agent_avoidance_callback_mock);
+			}
+		}
+
+		RID oncoming_agent = navigation_server->agent_create();
+		navigation_server->agent_set_map(oncoming_agent, map);
+		navigation_server->agent_set_avoidance_enabled(oncoming_agent, true);
+		navigation_server->agent_set_position(oncoming_agent, Vector3(82.5, 0, 80.5));
+		navigation_server->agent_set_radius(oncoming_agent, 1);
+		navigation_server->agent_set_neighbor_distance(oncoming_agent, 5);
+		navigation_server->agent_set_velocity(oncoming_agent, Vector3(-1, 0, 0));
+		CallableMock oncoming_agent_avoidance_callback_mock;
+		navigation_server->agent_set_avoidance_callback(oncoming_agent, callable_mp(&oncoming_agent_avoidance_callback_mock, &CallableMock::function1));
+
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		CHECK_EQ(oncoming_agent_avoidance_callback_mock.function1_calls, 1);
+		Vector3 oncoming_agent_safe_velocity = oncoming_agent_avoidance_callback_mock.function1_latest_arg0;
+		CHECK_MESSAGE(oncoming_agent_safe_velocity.z > 0, "Oncoming agent should move a bit to the side so that it avoids the agent in front of it.");
+
+		const int avoiding_agent_index = 4 * crowd_size + 4;
+		for (uint32_t i = 0; i < agents.size(); i++) {
+			CHECK_EQ(agent_avoidance_callback_mocks[i]->function1_calls, 1);
+			Vector3 agent_safe_velocity = agent_avoidance_callback_mocks[i]->function1_latest_arg0;
+			if (int(i) == avoiding_agent_index) {
+				CHECK_MESSAGE(agent_safe_velocity.z < 0, "Agent in front of the oncoming agent should move a bit to the side.");
+			} else {
+				CHECK_MESSAGE(agent_safe_velocity.is_equal_approx(Vector3(1, 0, 0)), "Agents without neighbors should keep their velocity.");
+			}
+		}
+
+		navigation_server->free(oncoming_agent);
+		for (uint32_t i = 0; i < agents.size(); i++) {
+			navigation_server->free(agents[i]);
+			memdelete(agent_avoidance_callback_mocks[i]);
+		}
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	TEST_CASE("[NavigationServer3D] Server should make agents avoid dynamic obstacles when avoidance enabled") {
 		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
 
@@ -737,6 +803,136 @@ TEST_SUITE("[Navigation3D]") {
 			CHECK_NE(query_result->get_path_owner_ids().size(), 0);
 		}
 
+		SUBCASE("Elaborate query with 'HIERARCHICAL_ASTAR' pathfinding should yield the same path as 'ASTAR' on a small map") {
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(0, 0, 0));
+			query_parameters->set_target_position(Vector3(10, 0, 10));
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> astar_path = query_result->get_path();
+			query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_NE(query_result->get_path().size(), 0);
+			CHECK_EQ(query_result->get_path(), astar_path);
+		}
+
+		SUBCASE("Elaborate query with 'HIERARCHICAL_ASTAR' pathfinding should yield the same path as 'ASTAR' on a map with several clusters") {
+			// A U-shaped corridor one polygon wide, long enough to be split into several clusters of 64 polygons.
+			const int corridor_length = 80;
+			PackedVector3Array corridor_vertices;
+			for (int z = 0; z <= corridor_length; z++) {
+				for (int x = 0; x <= corridor_length; x++) {
+					corridor_vertices.push_back(Vector3(x, 0, z));
+				}
+			}
+			Ref<NavigationMesh> corridor_mesh = memnew(NavigationMesh);
+			corridor_mesh->set_vertices(corridor_vertices);
+			for (int z = 0; z < corridor_length; z++) {
+				for (int x = 0; x < corridor_length; x++) {
+					if (z != 0 && z != corridor_length - 1 && x != corridor_length - 1) {
+						continue;
+					}
+					const int vertex = z * (corridor_length + 1) + x;
+					corridor_mesh->add_polygon({ vertex, vertex + corridor_length + 1, vertex + corridor_length + 2, vertex + 1 });
+				}
+			}
+			CHECK_GT(corridor_mesh->get_polygon_count(), 3 * 64);
+
+			RID corridor_map = navigation_server->map_create();
+			RID corridor_region = navigation_server->region_create();
+			navigation_server->map_set_active(corridor_map, true);
+			navigation_server->map_set_use_async_iterations(corridor_map, false);
+			navigation_server->region_set_map(corridor_region, corridor_map);
+			navigation_server->region_set_navigation_mesh(corridor_region, corridor_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(corridor_map);
+			query_parameters->set_start_position(Vector3(0.5, 0, 0.5));
+			query_parameters->set_target_position(Vector3(0.5, 0, corridor_length - 0.5));
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+			Vector<Vector3> astar_path = query_result->get_path();
+			REQUIRE_GT(astar_path.size(), 2);
+			CHECK(astar_path[astar_path.size() - 1].is_equal_approx(Vector3(0.5, 0, corridor_length - 0.5)));
+
+			query_parameters->set_pathfinding_algorithm(NavigationPathQueryParameters3D::PATHFINDING_ALGORITHM_HIERARCHICAL_ASTAR);
+			navigation_server->query_path(query_parameters, query_result);
+			CHECK_EQ(query_result->get_path(), astar_path);
+
+			navigation_server->free(corridor_region);
+			navigation_server->free(corridor_map);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+		}
+
+		SUBCASE("Asynchronous query should yield the same result as 'query_path' after a physics step") {
+			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
+			query_parameters->set_map(map);
+			query_parameters->set_start_position(Vector3(0, 0, 0));
+			query_parameters->set_target_position(Vector3(10, 0, 10));
+			Ref<NavigationPathQueryResult3D> query_result = memnew(NavigationPathQueryResult3D);
+			navigation_server->query_path(query_parameters, query_result);
+
+			Ref<NavigationPathQueryResult3D> async_query_result = memnew(NavigationPathQueryResult3D);
+			CallableMock query_callback_mock;
+			navigation_server->query_path_async(query_parameters, async_query_result, callable_mp(&query_callback_mock, &CallableMock::function1).bind(1));
+			CHECK_EQ(async_query_result->get_path().size(), 0);
+			CHECK_EQ(query_callback_mock.function1_calls, 0);
+			navigation_server->physics_process(0.0); // Give server some cycles to process the queue.
+			CHECK_EQ(query_callback_mock.function1_calls, 1);
+			CHECK_NE(async_query_result->get_path().size(), 0);
+			CHECK_EQ(async_query_result->get_path(), query_result->get_path());
+		}
+
+		SUBCASE("Repeated query with path cache should yield the same path and report the cache hit") {
+			navigation_server->map_set_path_cache_size(map, 16);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->map_get_path_cache_size(map), 16);
+
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, -3), Vector3(4, 0, 3), true);
+			CHECK_NE(path.size(), 0);
+			CHECK_EQ(navigation_server->map_get_path(map, Vector3(-4, 0, -3), Vector3(4, 0, 3), true), path);
+			navigation_server->physics_process(0.0); // Give server some cycles to update the process info.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_MISS_COUNT), 1);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_PATH_CACHE_HIT_COUNT), 1);
+		}
+
+		SUBCASE("Following the flow field should reach the end of the path") {
+			const Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(10, 0, 10), true);
+			CHECK_NE(path.size(), 0);
+
+			Vector3 position = Vector3(-4, 0, -4);
+			for (int i = 0; i < 100; i++) {
+				const Vector3 next_position = navigation_server->map_get_flow_field_next_position(map, position, Vector3(10, 0, 10));
+				if (next_position == position) {
+					break;
+				}
+				position = next_position;
+			}
+			CHECK(position.is_equal_approx(path[path.size() - 1]));
+
+			// Unreachable without a matching navigation layer.
+			CHECK_EQ(navigation_server->map_get_flow_field_next_position(map, Vector3(-4, 0, -4), Vector3(10, 0, 10), 2), Vector3(-4, 0, -4));
+		}
+
+		SUBCASE("Re-enabled region should merge the same edges as before") {
+			const int polygon_count = navigation_server->get_process_info(NavigationServer3D::INFO_POLYGON_COUNT);
+			const int edge_merge_count = navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT);
+			CHECK_NE(polygon_count, 0);
+			CHECK_NE(edge_merge_count, 0);
+
+			navigation_server->region_set_enabled(region, false);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_POLYGON_COUNT), 0);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), 0);
+
+			navigation_server->region_set_enabled(region, true);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_POLYGON_COUNT), polygon_count);
+			CHECK_EQ(navigation_server->get_process_info(NavigationServer3D::INFO_EDGE_MERGE_COUNT), edge_merge_count);
+		}
+
 		SUBCASE("Elaborate query with non-matching navigation layer mask should yield empty result") {
 			Ref<NavigationPathQueryParameters3D> query_parameters = memnew(NavigationPathQueryParameters3D);
 			query_parameters->set_map(map);
@@ -810,6 +1006,90 @@ TEST_SUITE("[Navigation3D]") {
 		navigation_server->physics_process(0.0); // Give server some cycles to commit.
 	}
 
+	TEST_CASE("[NavigationServer3D] Server should bake and rebake tiled navigation mesh") {
+		NavigationServer3D *navigation_server = NavigationServer3D::get_singleton();
+		Ref<NavigationMesh> navigation_mesh = memnew(NavigationMesh);
+		navigation_mesh->set_tile_size(2.5);
+		Ref<NavigationMeshSourceGeometryData3D> source_geometry = memnew(NavigationMeshSourceGeometryData3D);
+
+		Array arr;
+		arr.resize(RS::ARRAY_MAX);
+		BoxMesh::create_mesh_array(arr, Vector3(10.0, 0.001, 10.0));
+		source_geometry->add_mesh_array(arr, Transform3D());
+		navigation_server->bake_from_source_geometry_data(navigation_mesh, source_geometry, Callable());
+		CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+		RID map = navigation_server->map_create();
+		RID region = navigation_server->region_create();
+		navigation_server->map_set_active(map, true);
+		navigation_server->map_set_use_async_iterations(map, false);
+		navigation_server->region_set_map(region, map);
+		navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+
+		// The path crosses several tiles and only reaches the target if the tiles are stitched together.
+		Vector<Vector3> path = navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(4, 0, 4), true);
+		REQUIRE_NE(path.size(), 0);
+		CHECK_LT(Vector2(path[path.size() - 1].x, path[path.size() - 1].z).distance_to(Vector2(4, 4)), 0.1);
+
+		SUBCASE("Rebaking a dirty area should keep the navigation mesh connected") {
+			Array obstacle_arr;
+			obstacle_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(obstacle_arr, Vector3(1.0, 2.0, 1.0));
+			source_geometry->add_mesh_array(obstacle_arr, Transform3D(Basis(), Vector3(1.0, 0.0, 1.0)));
+
+			navigation_server->rebake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(0.5, -1.0, 0.5), Vector3(1.0, 2.0, 1.0)), Callable());
+			CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			path = navigation_server->map_get_path(map, Vector3(-4, 0, -4), Vector3(4, 0, 4), true);
+			REQUIRE_NE(path.size(), 0);
+			CHECK_LT(Vector2(path[path.size() - 1].x, path[path.size() - 1].z).distance_to(Vector2(4, 4)), 0.1);
+
+			// The rebaked tile should contain the hole cut by the new obstacle.
+			const Vector3 closest_point = navigation_server->map_get_closest_point(map, Vector3(1, 0, 1));
+			CHECK_GT(Vector2(closest_point.x, closest_point.z).distance_to(Vector2(1, 1)), 0.4);
+		}
+
+		SUBCASE("Rebaking a dirty area next to a tile edge should rebake the neighboring tile") {
+			// The obstacle ends before the edge at x = 2.5, but the agent radius pushes its hole into the next tile.
+			Array obstacle_arr;
+			obstacle_arr.resize(RS::ARRAY_MAX);
+			BoxMesh::create_mesh_array(obstacle_arr, Vector3(1.0, 2.0, 1.0));
+			source_geometry->add_mesh_array(obstacle_arr, Transform3D(Basis(), Vector3(1.75, 0.0, 1.0)));
+
+			navigation_server->rebake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(1.25, -1.0, 0.5), Vector3(1.0, 2.0, 1.0)), Callable());
+			CHECK_NE(navigation_mesh->get_polygon_count(), 0);
+
+			navigation_server->region_set_navigation_mesh(region, navigation_mesh);
+			navigation_server->physics_process(0.0); // Give server some cycles to commit.
+			const Vector3 closest_point = navigation_server->map_get_closest_point(map, Vector3(2.5, 0, 1));
+			CHECK_GT(Vector2(closest_point.x, closest_point.z).distance_to(Vector2(2.5, 1)), 0.1);
+		}
+
+		SUBCASE("Rebaking a dirty area after the tile size changed should bake the whole navigation mesh") {
+			CHECK(navigation_mesh->get_baked_tile_width() == doctest::Approx(2.5));
+			navigation_mesh->set_tile_size(4.0);
+			navigation_server->rebake_tiles_from_source_geometry_data(navigation_mesh, source_geometry, AABB(Vector3(0.5, -1.0, 0.5), Vector3(1.0, 2.0, 1.0)), Callable());
+			CHECK(navigation_mesh->get_baked_tile_width() == doctest::Approx(4.0));
+
+			Ref<NavigationMesh> full_navigation_mesh = memnew(NavigationMesh);
+			full_navigation_mesh->set_tile_size(4.0);
+			navigation_server->bake_from_source_geometry_data(full_navigation_mesh, source_geometry, Callable());
+			CHECK_EQ(navigation_mesh->get_vertices(), full_navigation_mesh->get_vertices());
+			CHECK_EQ(navigation_mesh->get_polygon_count(), full_navigation_mesh->get_polygon_count());
+
+			// Polygons that were not baked by the generator are never kept either.
+			navigation_mesh->set_polygons(navigation_mesh->get_polygons());
+			CHECK(navigation_mesh->get_baked_tile_width() == 0.0);
+		}
+
+		navigation_server->free(region);
+		navigation_server->free(map);
+		navigation_server->physics_process(0.0); // Give server some cycles to commit.
+	}
+
 	// FIXME: The race condition mentioned below is actually a problem and fails on CI (GH-90613).
 	/*
 	TEST_CASE("[NavigationServer3D] Server should be able to bake asynchronously") {
@@ -167,9 +167,11 @@
 
 #ifndef _3D_DISABLED
 #include "tests/core/math/test_triangle_mesh.h"
+#include "tests/scene/test_animation_mixer.h"
 #include "tests/scene/test_arraymesh.h"
 #include "tests/scene/test_camera_3d.h"
 #include "tests/scene/test_gltf_document.h"
+#include "tests/scene/test_node_3d.h"
 #include "tests/scene/test_path_3d.h"
 #include "tests/scene/test_path_follow_3d.h"
 #include "tests/scene/test_primitives.h"
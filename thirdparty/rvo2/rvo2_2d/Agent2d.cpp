@@ -40,18 +40,23 @@ namespace RVO2D {
 
 	void Agent2D::computeNeighbors(RVOSimulator2D *sim_)
 	{
-		obstacleNeighbors_.clear();
-		float rangeSq = sqr(timeHorizonObst_ * maxSpeed_ + radius_);
-		sim_->kdTree_->computeObstacleNeighbors(this, rangeSq);
+		computeObstacleNeighbors(sim_);
 
 		agentNeighbors_.clear();
 
 		if (maxNeighbors_ > 0) {
-			rangeSq = sqr(neighborDist_);
+			float rangeSq = sqr(neighborDist_);
 			sim_->kdTree_->computeAgentNeighbors(this, rangeSq);
 		}
 	}
 
+	void Agent2D::computeObstacleNeighbors(RVOSimulator2D *sim_)
+	{
+		obstacleNeighbors_.clear();
+		const float rangeSq = sqr(timeHorizonObst_ * maxSpeed_ + radius_);
+		sim_->kdTree_->computeObstacleNeighbors(this, rangeSq);
+	}
+
 	/* Search for the best new velocity. */
 	void Agent2D::computeNewVelocity(RVOSimulator2D *sim_)
 	{
@@ -58,6 +58,11 @@ namespace RVO2D {
 		 */
 		void computeNeighbors(RVOSimulator2D *sim_);
 
+		/**
+		 * \brief      Computes the static obstacle neighbors of this agent.
+		 */
+		void computeObstacleNeighbors(RVOSimulator2D *sim_);
+
 		/**
 		 * \brief      Computes the new velocity of this agent.
 		 */